@@ -64,17 +64,16 @@ template<class GridType, class T> void importVDB(typename GridType::Ptr from, Gr
       to->set(coord.x(), coord.y(), coord.z(), toMantaValue);
     }
   }
-  // When importing all grid cells, using a grid accessor is usually faster than a value iterator
+  // When importing all grid cells, copy the vdb grid into a vdb dense structure that wraps the
+  // grid data. This is the counterpart of exportVDB() and runs multithreaded, unlike reading every
+  // cell with a grid accessor
   else {
-    typename GridType::Accessor accessor = from->getAccessor();
-    FOR_IJK(*to)
-    {
-      openvdb::Coord xyz(i, j, k);
-      ValueT vdbValue = accessor.getValue(xyz);
-      T toMantaValue;
-      convertFrom(vdbValue, &toMantaValue);
-      to->set(i, j, k, toMantaValue);
-    }
+    ValueT *data = (ValueT *)to->getData();
+    openvdb::math::CoordBBox bbox(
+        openvdb::Coord(0),
+        openvdb::Coord(to->getSizeX() - 1, to->getSizeY() - 1, to->getSizeZ() - 1));
+    openvdb::tools::Dense<ValueT, openvdb::tools::MemoryLayout::LayoutXYZ> dense(bbox, data);
+    openvdb::tools::copyToDense(*from, dense);
   }
 }
 
@@ -571,6 +571,8 @@ void BlenderSync::sync_objects(BL::Depsgraph &b_depsgraph,
                                BL::SpaceView3D &b_v3d,
                                float motion_time)
 {
+  BLI_PROFILE_SCOPE_NAMED("Cycles", "Sync Objects");
+
   /* Task pool for multithreaded geometry sync. */
   TaskPool geom_task_pool;
 
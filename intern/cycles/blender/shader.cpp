@@ -1581,6 +1581,7 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
 
 void BlenderSync::sync_shaders(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all)
 {
+  BLI_PROFILE_SCOPE_NAMED("Cycles", "Sync Shaders");
   shader_map.pre_sync();
 
   sync_world(b_depsgraph, b_v3d, update_all);
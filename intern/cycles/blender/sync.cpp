@@ -256,6 +256,7 @@ void BlenderSync::sync_data(BL::RenderSettings &b_render,
   }
 
   scoped_timer timer;
+  BLI_PROFILE_SCOPE_NAMED("Cycles", "Sync Data");
 
   BL::ViewLayer b_view_layer = b_depsgraph.view_layer_eval();
 
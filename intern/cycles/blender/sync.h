@@ -4,6 +4,7 @@
 #ifndef __BLENDER_SYNC_H__
 #define __BLENDER_SYNC_H__
 
+#include "BLI_profile.hh"
 #include "MEM_guardedalloc.h"
 #include "RNA_access.h"
 #include "RNA_blender_cpp.h"
@@ -963,10 +963,12 @@ bool RenderScheduler::work_need_denoise(bool &delayed, bool &ready_to_display)
   }
 
   /* Avoid excessive denoising in viewport after reaching a certain sample count and render time.
-   */
+   * The interval grows with the denoising time, so that a slow denoiser (high resolution, CPU)
+   * does not take more than about a quarter of the time which could be spent on sampling. */
   /* TODO(sergey): Consider making time interval and sample configurable. */
+  const double denoise_interval = max(1.0, 3.0 * denoise_time_.get_average());
   delayed = (path_trace_time_.get_wall() > 4 && num_samples_finished >= 20 &&
-             (time_dt() - state_.last_display_update_time) < 1.0);
+             (time_dt() - state_.last_display_update_time) < denoise_interval);
 
   return !delayed;
 }
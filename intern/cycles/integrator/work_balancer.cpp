@@ -35,8 +35,8 @@ static double calculate_total_time(const vector<WorkBalanceInfo> &work_balance_i
 }
 
 /* The balance is based on equalizing time which devices spent performing a task. Assume that
- * average of the observed times is usable for estimating whether more or less work is to be
- * scheduled, and how difference in the work scheduling is needed. */
+ * the throughput of every device stays the same for the next task, so that the weights which
+ * make all devices finish at the same time can be calculated directly from the observed times. */
 
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
@@ -45,26 +45,25 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
   const double total_time = calculate_total_time(work_balance_infos);
   const double time_average = total_time / num_infos;
 
-  double total_weight = 0;
-  vector<double> new_weights;
-  new_weights.reserve(num_infos);
-
-  /* Equalize the overall average time. This means that we don't make it so every work will perform
-   * amount of work based on the current average, but that after the weights changes the time will
-   * equalize.
-   * Can think of it that if one of the devices is 10% faster than another, then one device needs
-   * to do 5% less of the current work, and another needs to do 5% more. */
-  const double lerp_weight = 1.0 / num_infos;
+  double total_throughput = 0;
+  vector<double> throughputs;
+  throughputs.reserve(num_infos);
 
   bool has_big_difference = false;
 
   for (const WorkBalanceInfo &info : work_balance_infos) {
-    const double time_target = lerp(info.time_spent, time_average, lerp_weight);
-    const double new_weight = info.weight * time_target / info.time_spent;
-    new_weights.push_back(new_weight);
-    total_weight += new_weight;
+    if (info.time_spent <= 0.0) {
+      /* Device did not perform any work since the previous balance, so there is nothing known
+       * about its performance. Keep the current distribution. */
+      return false;
+    }
+
+    /* Fraction of the work which the device performs per second. */
+    const double throughput = info.weight / info.time_spent;
+    throughputs.push_back(throughput);
+    total_throughput += throughput;
 
-    if (std::fabs(1.0 - time_target / time_average) > 0.02) {
+    if (std::fabs(1.0 - info.time_spent / time_average) > 0.02) {
       has_big_difference = true;
     }
   }
@@ -73,10 +72,13 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
     return false;
   }
 
-  const double total_weight_inv = 1.0 / total_weight;
+  /* Distribute the work proportionally to the throughput. This converges in a single step when
+   * the throughput does not change, which avoids the cost of re-balancing the render buffers
+   * multiple times while the weights slowly approach their final values. */
+  const double total_throughput_inv = 1.0 / total_throughput;
   for (int i = 0; i < num_infos; ++i) {
     WorkBalanceInfo &info = work_balance_infos[i];
-    info.weight = new_weights[i] * total_weight_inv;
+    info.weight = throughputs[i] * total_throughput_inv;
     info.time_spent = 0;
   }
 
@@ -29,6 +29,7 @@
 #include "util/log.h"
 #include "util/progress.h"
 #include "util/task.h"
+#include "util/tbb.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -1142,31 +1143,42 @@ void GeometryManager::device_update_mesh(Device *,
                                dscene->tri_patch.need_realloc() ||
                                dscene->tri_patch_uv.need_realloc();
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->geometry_type == Geometry::MESH || geom->geometry_type == Geometry::VOLUME) {
-        Mesh *mesh = static_cast<Mesh *>(geom);
-
-        if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
-            mesh->triangles_is_modified() || copy_all_data) {
-          mesh->pack_shaders(scene, &tri_shader[mesh->prim_offset]);
-        }
-
-        if (mesh->verts_is_modified() || copy_all_data) {
-          mesh->pack_normals(&vnormal[mesh->vert_offset]);
-        }
-
-        if (mesh->verts_is_modified() || mesh->triangles_is_modified() ||
-            mesh->vert_patch_uv_is_modified() || copy_all_data) {
-          mesh->pack_verts(&tri_verts[mesh->prim_offset * 3],
-                           &tri_vindex[mesh->prim_offset],
-                           &tri_patch[mesh->prim_offset],
-                           &tri_patch_uv[mesh->vert_offset]);
-        }
-
-        if (progress.get_cancel())
-          return;
-      }
-    }
+    /* Every mesh writes to its own range of the arrays, so they can be packed in parallel. */
+    parallel_for(blocked_range<size_t>(0, scene->geometry.size(), 1),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     Geometry *geom = scene->geometry[i];
+                     if (geom->geometry_type != Geometry::MESH &&
+                         geom->geometry_type != Geometry::VOLUME) {
+                       continue;
+                     }
+                     if (progress.get_cancel()) {
+                       return;
+                     }
+
+                     Mesh *mesh = static_cast<Mesh *>(geom);
+
+                     if (mesh->shader_is_modified() || mesh->smooth_is_modified() ||
+                         mesh->triangles_is_modified() || copy_all_data) {
+                       mesh->pack_shaders(scene, &tri_shader[mesh->prim_offset]);
+                     }
+
+                     if (mesh->verts_is_modified() || copy_all_data) {
+                       mesh->pack_normals(&vnormal[mesh->vert_offset]);
+                     }
+
+                     if (mesh->verts_is_modified() || mesh->triangles_is_modified() ||
+                         mesh->vert_patch_uv_is_modified() || copy_all_data) {
+                       mesh->pack_verts(&tri_verts[mesh->prim_offset * 3],
+                                        &tri_vindex[mesh->prim_offset],
+                                        &tri_patch[mesh->prim_offset],
+                                        &tri_patch_uv[mesh->vert_offset]);
+                     }
+                   }
+                 });
+
+    if (progress.get_cancel())
+      return;
 
     /* vertex coordinates */
     progress.set_status("Updating Mesh", "Copying Mesh to device");
@@ -1190,27 +1202,37 @@ void GeometryManager::device_update_mesh(Device *,
                                dscene->curves.need_realloc() ||
                                dscene->curve_segments.need_realloc();
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->is_hair()) {
-        Hair *hair = static_cast<Hair *>(geom);
-
-        bool curve_keys_co_modified = hair->curve_radius_is_modified() ||
-                                      hair->curve_keys_is_modified();
-        bool curve_data_modified = hair->curve_shader_is_modified() ||
-                                   hair->curve_first_key_is_modified();
-
-        if (!curve_keys_co_modified && !curve_data_modified && !copy_all_data) {
-          continue;
-        }
-
-        hair->pack_curves(scene,
-                          &curve_keys[hair->curve_key_offset],
-                          &curves[hair->prim_offset],
-                          &curve_segments[hair->curve_segment_offset]);
-        if (progress.get_cancel())
-          return;
-      }
-    }
+    parallel_for(blocked_range<size_t>(0, scene->geometry.size(), 1),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     Geometry *geom = scene->geometry[i];
+                     if (!geom->is_hair()) {
+                       continue;
+                     }
+                     if (progress.get_cancel()) {
+                       return;
+                     }
+
+                     Hair *hair = static_cast<Hair *>(geom);
+
+                     bool curve_keys_co_modified = hair->curve_radius_is_modified() ||
+                                                   hair->curve_keys_is_modified();
+                     bool curve_data_modified = hair->curve_shader_is_modified() ||
+                                                hair->curve_first_key_is_modified();
+
+                     if (!curve_keys_co_modified && !curve_data_modified && !copy_all_data) {
+                       continue;
+                     }
+
+                     hair->pack_curves(scene,
+                                       &curve_keys[hair->curve_key_offset],
+                                       &curves[hair->prim_offset],
+                                       &curve_segments[hair->curve_segment_offset]);
+                   }
+                 });
+
+    if (progress.get_cancel())
+      return;
 
     dscene->curve_keys.copy_to_device_if_modified();
     dscene->curves.copy_to_device_if_modified();
@@ -1223,15 +1245,23 @@ void GeometryManager::device_update_mesh(Device *,
     float4 *points = dscene->points.alloc(point_size);
     uint *points_shader = dscene->points_shader.alloc(point_size);
 
-    foreach (Geometry *geom, scene->geometry) {
-      if (geom->is_pointcloud()) {
-        PointCloud *pointcloud = static_cast<PointCloud *>(geom);
-        pointcloud->pack(
-            scene, &points[pointcloud->prim_offset], &points_shader[pointcloud->prim_offset]);
-        if (progress.get_cancel())
-          return;
-      }
-    }
+    parallel_for(blocked_range<size_t>(0, scene->geometry.size(), 1),
+                 [&](const blocked_range<size_t> &r) {
+                   for (size_t i = r.begin(); i != r.end(); i++) {
+                     Geometry *geom = scene->geometry[i];
+                     if (!geom->is_pointcloud() || progress.get_cancel()) {
+                       continue;
+                     }
+
+                     PointCloud *pointcloud = static_cast<PointCloud *>(geom);
+                     pointcloud->pack(scene,
+                                      &points[pointcloud->prim_offset],
+                                      &points_shader[pointcloud->prim_offset]);
+                   }
+                 });
+
+    if (progress.get_cancel())
+      return;
 
     dscene->points.copy_to_device();
     dscene->points_shader.copy_to_device();
@@ -1284,9 +1314,25 @@ void GeometryManager::device_update_bvh(Device *device,
 
   VLOG(1) << "Using " << bvh_layout_name(bparams.bvh_layout) << " layout.";
 
-  const bool can_refit = scene->bvh != nullptr &&
-                         (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX ||
-                          bparams.bvh_layout == BVHLayout::BVH_LAYOUT_METAL);
+  bool can_refit = scene->bvh != nullptr &&
+                   (bparams.bvh_layout == BVHLayout::BVH_LAYOUT_OPTIX ||
+                    bparams.bvh_layout == BVHLayout::BVH_LAYOUT_METAL);
+
+  /* An Embree scene can be refit in place when only the vertices of geometry which is not
+   * instanced or the transforms of instances changed. Added or removed primitives already deleted
+   * the scene BVH. Visibility changes can add or remove objects from the scene, and updates of the
+   * BVHs of instanced geometry are not handled by the refit. */
+  if (scene->bvh != nullptr && bparams.bvh_layout == BVHLayout::BVH_LAYOUT_EMBREE &&
+      bparams.bvh_type == BVH_TYPE_DYNAMIC && (update_flags & VISIBILITY_MODIFIED) == 0 &&
+      scene->bvh->objects == scene->objects) {
+    can_refit = true;
+    foreach (Geometry *geom, scene->geometry) {
+      if (geom->is_instanced() && (geom->is_modified() || geom->need_update_bvh_for_offset)) {
+        can_refit = false;
+        break;
+      }
+    }
+  }
 
   BVH *bvh = scene->bvh;
   if (!scene->bvh) {
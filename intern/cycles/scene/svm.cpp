@@ -32,6 +32,7 @@ SVMShaderManager::~SVMShaderManager()
 
 void SVMShaderManager::reset(Scene * /*scene*/)
 {
+  compiled_shaders_.clear();
 }
 
 void SVMShaderManager::device_update_shader(Scene *scene,
@@ -79,16 +80,32 @@ void SVMShaderManager::device_update_specific(Device *device,
   /* test if we need to update */
   device_free(device, dscene, scene);
 
-  /* Build all shaders. */
+  const Shader *background_shader = scene->background->get_shader(scene);
+  const bool integrator_modified = (update_flags & INTEGRATOR_MODIFIED) != 0;
+
+  /* Build all shaders, reusing the nodes of the ones which did not change. */
   TaskPool task_pool;
   vector<array<int4>> shader_svm_nodes(num_shaders);
+  int num_compiled_shaders = 0;
   for (int i = 0; i < num_shaders; i++) {
+    Shader *shader = scene->shaders[i];
+
+    const auto compiled = compiled_shaders_.find(shader);
+    if (compiled != compiled_shaders_.end() && !shader->is_modified() &&
+        compiled->second.graph == shader->graph &&
+        compiled->second.background == (shader == background_shader) &&
+        !(integrator_modified && shader->has_integrator_dependency)) {
+      shader_svm_nodes[i] = compiled->second.svm_nodes;
+      continue;
+    }
+
     task_pool.push(function_bind(&SVMShaderManager::device_update_shader,
                                  this,
                                  scene,
-                                 scene->shaders[i],
+                                 shader,
                                  &progress,
                                  &shader_svm_nodes[i]));
+    num_compiled_shaders++;
   }
   task_pool.wait_work();
 
@@ -138,6 +155,16 @@ void SVMShaderManager::device_update_specific(Device *device,
     svm_nodes += shader_size;
   }
 
+  /* Remember the compiled nodes for the next update, forgetting shaders which were removed. */
+  compiled_shaders_.clear();
+  for (int i = 0; i < num_shaders; i++) {
+    const Shader *shader = scene->shaders[i];
+    CompiledShader &compiled = compiled_shaders_[shader];
+    compiled.graph = shader->graph;
+    compiled.background = (shader == background_shader);
+    compiled.svm_nodes.steal_data(shader_svm_nodes[i]);
+  }
+
   if (progress.get_cancel()) {
     return;
   }
@@ -148,8 +175,8 @@ void SVMShaderManager::device_update_specific(Device *device,
 
   update_flags = UPDATE_NONE;
 
-  VLOG(1) << "Shader manager updated " << num_shaders << " shaders in " << time_dt() - start_time
-          << " seconds.";
+  VLOG(1) << "Shader manager updated " << num_shaders << " shaders (" << num_compiled_shaders
+          << " compiled) in " << time_dt() - start_time << " seconds.";
 }
 
 void SVMShaderManager::device_free(Device *device, DeviceScene *dscene, Scene *scene)
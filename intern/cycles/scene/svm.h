@@ -9,6 +9,7 @@
 #include "scene/shader_graph.h"
 
 #include "util/array.h"
+#include "util/map.h"
 #include "util/set.h"
 #include "util/string.h"
 #include "util/thread.h"
@@ -44,6 +45,15 @@ class SVMShaderManager : public ShaderManager {
                             Shader *shader,
                             Progress *progress,
                             array<int4> *svm_nodes);
+
+  /* Nodes of a shader from the previous update, so shaders which did not change are not compiled
+   * again when other shaders in the scene are modified. */
+  struct CompiledShader {
+    const ShaderGraph *graph = nullptr;
+    bool background = false;
+    array<int4> svm_nodes;
+  };
+  unordered_map<const Shader *, CompiledShader> compiled_shaders_;
 };
 
 /* Graph Compiler */
@@ -0,0 +1,53 @@
+/* SPDX-License-Identifier: Apache-2.0
+ * Copyright 2011-2022 Blender Foundation */
+
+#include "testing/testing.h"
+
+#include "integrator/work_balancer.h"
+
+CCL_NAMESPACE_BEGIN
+
+static vector<WorkBalanceInfo> make_balance_infos(const vector<double> &weights,
+                                                  const vector<double> &times)
+{
+  vector<WorkBalanceInfo> infos(weights.size());
+  for (int i = 0; i < weights.size(); ++i) {
+    infos[i].weight = weights[i];
+    infos[i].time_spent = times[i];
+  }
+  return infos;
+}
+
+TEST(work_balance_do_rebalance, Equal)
+{
+  vector<WorkBalanceInfo> infos = make_balance_infos({0.5, 0.5}, {1.0, 1.01});
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.5, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.5, 1e-6);
+}
+
+TEST(work_balance_do_rebalance, Throughput)
+{
+  /* First device is twice as fast as the second one. */
+  vector<WorkBalanceInfo> infos = make_balance_infos({0.5, 0.5}, {1.0, 2.0});
+  EXPECT_TRUE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 2.0 / 3.0, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 1.0 / 3.0, 1e-6);
+  EXPECT_EQ(infos[0].time_spent, 0.0);
+  EXPECT_EQ(infos[1].time_spent, 0.0);
+
+  /* With the same throughput the devices now finish at the same time. */
+  infos[0].time_spent = infos[0].weight;
+  infos[1].time_spent = infos[1].weight * 2.0;
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+}
+
+TEST(work_balance_do_rebalance, NoStatistics)
+{
+  vector<WorkBalanceInfo> infos = make_balance_infos({0.5, 0.5}, {1.0, 0.0});
+  EXPECT_FALSE(work_balance_do_rebalance(infos));
+  EXPECT_NEAR(infos[0].weight, 0.5, 1e-6);
+  EXPECT_NEAR(infos[1].weight, 0.5, 1e-6);
+}
+
+CCL_NAMESPACE_END
@@ -172,6 +172,34 @@ extern void (*MEM_reset_peak_memory)(void);
 /** Get the peak memory usage in bytes, including mmap allocations. */
 extern size_t (*MEM_get_peak_memory)(void) ATTR_WARN_UNUSED_RESULT;
 
+/**
+ * Categories that allocations are accounted to, to find out which part of Blender uses the
+ * memory. A block belongs to the category that was active on the allocating thread, see
+ * #MEM_category_push.
+ */
+typedef enum eMEMCategory {
+  MEM_CATEGORY_GENERAL = 0,
+  MEM_CATEGORY_DEPSGRAPH,
+  MEM_CATEGORY_DRAW,
+  MEM_CATEGORY_UNDO,
+  MEM_CATEGORY_IMAGE,
+} eMEMCategory;
+#define MEM_CATEGORY_NUM 5
+
+/**
+ * Account all following allocations of the calling thread to `category`. Returns the previously
+ * active category, which has to be passed to #MEM_category_pop.
+ *
+ * \note Tasks started on other threads don't inherit the category.
+ */
+eMEMCategory MEM_category_push(eMEMCategory category);
+void MEM_category_pop(eMEMCategory previous_category);
+const char *MEM_category_name(eMEMCategory category);
+/** Memory usage of a category in bytes. */
+extern size_t (*MEM_get_category_memory_in_use)(eMEMCategory category) ATTR_WARN_UNUSED_RESULT;
+/** Peak memory usage of a category in bytes, since the last #MEM_reset_peak_memory. */
+extern size_t (*MEM_get_category_peak_memory)(eMEMCategory category) ATTR_WARN_UNUSED_RESULT;
+
 #ifdef __GNUC__
 #  define MEM_SAFE_FREE(v) \
     do { \
@@ -311,6 +339,27 @@ template<typename T> inline void MEM_delete(const T *ptr)
   MEM_freeN(const_cast<T *>(ptr));
 }
 
+/**
+ * Accounts all allocations of the current thread to a category while it is in scope.
+ */
+class MEM_CategoryScope {
+ private:
+  eMEMCategory previous_category_;
+
+ public:
+  MEM_CategoryScope(const eMEMCategory category) : previous_category_(MEM_category_push(category))
+  {
+  }
+
+  ~MEM_CategoryScope()
+  {
+    MEM_category_pop(previous_category_);
+  }
+
+  MEM_CategoryScope(const MEM_CategoryScope &other) = delete;
+  MEM_CategoryScope &operator=(const MEM_CategoryScope &other) = delete;
+};
+
 /* Allocation functions (for C++ only). */
 #  define MEM_CXX_CLASS_ALLOC_FUNCS(_id) \
    public: \
@@ -62,6 +62,9 @@ void MEM_init_memleak_detection()
    * construction. Therefore, all static variables that own memory have to be constructed after
    * this function has been called.
    */
+  /* The memory usage counters have to outlive the leak detection, so construct them first. */
+  memory_usage_init();
+
   static MemLeakPrinter printer;
 }
 
@@ -81,7 +81,8 @@ typedef struct MemHead {
   const char *name;
   const char *nextname;
   int tag2;
-  short pad1;
+  /* #eMEMCategory the block is accounted to. */
+  short category;
   /* if non-zero aligned allocation was used and alignment is stored here. */
   short alignment;
 #ifdef DEBUG_MEMCOUNTER
@@ -146,6 +147,8 @@ static const char *check_memlist(MemHead *memh);
 
 static unsigned int totblock = 0;
 static size_t mem_in_use = 0, peak_mem = 0;
+static size_t mem_in_use_category[MEM_CATEGORY_NUM] = {0};
+static size_t peak_mem_category[MEM_CATEGORY_NUM] = {0};
 
 static volatile struct localListBase _membase;
 static volatile struct localListBase *membase = &_membase;
@@ -402,7 +405,7 @@ static void make_memhead_header(MemHead *memh, size_t len, const char *str)
   memh->name = str;
   memh->nextname = NULL;
   memh->len = len;
-  memh->pad1 = 0;
+  memh->category = (short)memory_usage_category();
   memh->alignment = 0;
   memh->tag2 = MEMTAG2;
 
@@ -419,6 +422,7 @@ static void make_memhead_header(MemHead *memh, size_t len, const char *str)
 
   atomic_add_and_fetch_u(&totblock, 1);
   atomic_add_and_fetch_z(&mem_in_use, len);
+  atomic_add_and_fetch_z(&mem_in_use_category[memh->category], len);
 
   mem_lock_thread();
   addtail(membase, &memh->next);
@@ -426,6 +430,9 @@ static void make_memhead_header(MemHead *memh, size_t len, const char *str)
     memh->nextname = MEMNEXT(memh->next)->name;
   }
   peak_mem = mem_in_use > peak_mem ? mem_in_use : peak_mem;
+  if (mem_in_use_category[memh->category] > peak_mem_category[memh->category]) {
+    peak_mem_category[memh->category] = mem_in_use_category[memh->category];
+  }
   mem_unlock_thread();
 }
 
@@ -684,6 +691,12 @@ void MEM_guarded_printmemlist_stats(void)
   printf("\ntotal memory len: %.3f MB\n", (double)mem_in_use / (double)(1024 * 1024));
   printf("peak memory len: %.3f MB\n", (double)peak_mem / (double)(1024 * 1024));
   printf("slop memory len: %.3f MB\n", (double)mem_in_use_slop / (double)(1024 * 1024));
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    printf("  %s: %.3f MB, peak %.3f MB\n",
+           MEM_category_name((eMEMCategory)i),
+           (double)mem_in_use_category[i] / (double)(1024 * 1024),
+           (double)peak_mem_category[i] / (double)(1024 * 1024));
+  }
   printf(" ITEMS TOTAL-MiB AVERAGE-KiB TYPE\n");
   for (a = 0, pb = printblock; a < totpb; a++, pb++) {
     printf("%6d (%8.3f  %8.3f) %s\n",
@@ -990,6 +1003,7 @@ static void rem_memblock(MemHead *memh)
 
   atomic_sub_and_fetch_u(&totblock, 1);
   atomic_sub_and_fetch_z(&mem_in_use, memh->len);
+  atomic_sub_and_fetch_z(&mem_in_use_category[memh->category], memh->len);
 
 #ifdef DEBUG_MEMDUPLINAME
   if (memh->need_free_name)
@@ -1163,9 +1177,34 @@ void MEM_guarded_reset_peak_memory(void)
 {
   mem_lock_thread();
   peak_mem = mem_in_use;
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    peak_mem_category[i] = mem_in_use_category[i];
+  }
   mem_unlock_thread();
 }
 
+size_t MEM_guarded_get_category_memory_in_use(eMEMCategory category)
+{
+  size_t _mem_in_use;
+
+  mem_lock_thread();
+  _mem_in_use = mem_in_use_category[category];
+  mem_unlock_thread();
+
+  return _mem_in_use;
+}
+
+size_t MEM_guarded_get_category_peak_memory(eMEMCategory category)
+{
+  size_t _peak_mem;
+
+  mem_lock_thread();
+  _peak_mem = peak_mem_category[category];
+  mem_unlock_thread();
+
+  return _peak_mem;
+}
+
 size_t MEM_guarded_get_memory_in_use(void)
 {
   size_t _mem_in_use;
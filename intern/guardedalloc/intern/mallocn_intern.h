@@ -90,6 +90,18 @@ void aligned_free(void *ptr);
 extern bool leak_detector_has_run;
 extern char free_after_leak_detection_message[];
 
+/* Per-thread memory usage counters of the lock-free allocator, see `memory_usage.cc`. */
+void memory_usage_init(void);
+eMEMCategory memory_usage_category(void);
+void memory_usage_block_alloc(size_t size, eMEMCategory category);
+void memory_usage_block_free(size_t size, eMEMCategory category);
+size_t memory_usage_block_num(void);
+size_t memory_usage_current(void);
+size_t memory_usage_peak(void);
+size_t memory_usage_category_current(eMEMCategory category);
+size_t memory_usage_category_peak(eMEMCategory category);
+void memory_usage_peak_reset(void);
+
 /* Prototypes for counted allocator functions */
 size_t MEM_lockfree_allocN_len(const void *vmemh) ATTR_WARN_UNUSED_RESULT;
 void MEM_lockfree_freeN(void *vmemh);
@@ -129,6 +141,8 @@ size_t MEM_lockfree_get_memory_in_use(void);
 unsigned int MEM_lockfree_get_memory_blocks_in_use(void);
 void MEM_lockfree_reset_peak_memory(void);
 size_t MEM_lockfree_get_peak_memory(void) ATTR_WARN_UNUSED_RESULT;
+size_t MEM_lockfree_get_category_memory_in_use(eMEMCategory category) ATTR_WARN_UNUSED_RESULT;
+size_t MEM_lockfree_get_category_peak_memory(eMEMCategory category) ATTR_WARN_UNUSED_RESULT;
 #ifndef NDEBUG
 const char *MEM_lockfree_name_ptr(void *vmemh);
 #endif
@@ -172,6 +186,8 @@ size_t MEM_guarded_get_memory_in_use(void);
 unsigned int MEM_guarded_get_memory_blocks_in_use(void);
 void MEM_guarded_reset_peak_memory(void);
 size_t MEM_guarded_get_peak_memory(void) ATTR_WARN_UNUSED_RESULT;
+size_t MEM_guarded_get_category_memory_in_use(eMEMCategory category) ATTR_WARN_UNUSED_RESULT;
+size_t MEM_guarded_get_category_peak_memory(eMEMCategory category) ATTR_WARN_UNUSED_RESULT;
 #ifndef NDEBUG
 const char *MEM_guarded_name_ptr(void *vmemh);
 #endif
@@ -0,0 +1,288 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup intern_mem
+ *
+ * Memory usage counters of the lock-free allocator. Every thread counts its own allocations, so
+ * that threads don't compete for the same cache line on every allocation and free. The counters
+ * are only summed up when the total memory usage is requested.
+ *
+ * Besides the total, the memory usage is also counted per #eMEMCategory.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <mutex>
+#include <vector>
+
+#include "MEM_guardedalloc.h"
+#include "mallocn_intern.h"
+
+/* The lock-free allocator stores the category in the highest byte of the block length. */
+static_assert(sizeof(size_t) == 8, "Memory categories require a 64-bit size_t");
+
+namespace {
+
+/**
+ * Counters of a single thread. Aligned to the cache line size to avoid false sharing between
+ * threads.
+ */
+struct alignas(64) Local {
+  /** Helps to find accidental uses of the counters of a thread that has exited. */
+  bool destructed = false;
+  /**
+   * True for the first #Local that is created, which is the one of the main thread when
+   * #memory_usage_init is called at startup. When it is destructed the process is exiting and
+   * thread-locals can't be relied on anymore.
+   */
+  bool is_main = false;
+  /**
+   * Number of bytes. This can be negative when one thread allocates memory that another thread
+   * frees. It is atomic because other threads read it when the total memory usage is computed.
+   */
+  std::atomic<int64_t> mem_in_use = 0;
+  /** Number of allocated blocks, can be negative and is atomic for the same reason as above. */
+  std::atomic<int64_t> blocks_num = 0;
+  /** Number of bytes per category, the sum of these is #mem_in_use. */
+  std::atomic<int64_t> category_mem_in_use[MEM_CATEGORY_NUM] = {};
+  /**
+   * Value of #mem_in_use when the peak was last updated. The peak is only updated once a thread
+   * allocated "a lot" of new memory, instead of after every allocation.
+   */
+  int64_t mem_in_use_during_peak_update = 0;
+
+  Local();
+  ~Local();
+};
+
+struct Global {
+  /** Protects #locals. */
+  std::mutex locals_mutex;
+  /** All currently alive #Local, threads add and remove themselves. */
+  std::vector<Local *> locals;
+  /**
+   * Counts that are not stored in any #Local. When a thread exits its counts may not be zero,
+   * since memory allocated by one thread can be freed by another one. Those counts are moved here.
+   * These counters are also used directly once the process is exiting.
+   */
+  std::atomic<int64_t> mem_in_use_outside_locals = 0;
+  std::atomic<int64_t> blocks_num_outside_locals = 0;
+  std::atomic<int64_t> category_mem_in_use_outside_locals[MEM_CATEGORY_NUM] = {};
+  /** Peak memory usage since the last reset. */
+  std::atomic<size_t> peak = 0;
+  std::atomic<size_t> category_peak[MEM_CATEGORY_NUM] = {};
+};
+
+}  // namespace
+
+/**
+ * True for most of the lifetime of the program. Only when it starts to exit this becomes false and
+ * the global counters are used instead.
+ */
+static std::atomic<bool> use_local_counters = true;
+/**
+ * The peak memory usage is updated when a thread allocated this amount of new memory since the
+ * last update.
+ */
+static constexpr int64_t peak_update_threshold = 1024 * 1024;
+/** Category that new allocations of the current thread are accounted to. */
+static thread_local eMEMCategory current_category = MEM_CATEGORY_GENERAL;
+
+static const char *category_names[MEM_CATEGORY_NUM] = {
+    "General",
+    "Dependency Graph",
+    "Draw",
+    "Undo",
+    "Image",
+};
+
+static Global &get_global()
+{
+  static Global global;
+  return global;
+}
+
+static Local &get_local_data()
+{
+  static thread_local Local local;
+  assert(!local.destructed);
+  return local;
+}
+
+Local::Local()
+{
+  Global &global = get_global();
+  std::lock_guard<std::mutex> lock{global.locals_mutex};
+
+  if (global.locals.empty()) {
+    this->is_main = true;
+  }
+  global.locals.push_back(this);
+}
+
+Local::~Local()
+{
+  Global &global = get_global();
+  std::lock_guard<std::mutex> lock{global.locals_mutex};
+
+  global.locals.erase(std::find(global.locals.begin(), global.locals.end(), this));
+  global.blocks_num_outside_locals.fetch_add(this->blocks_num, std::memory_order_relaxed);
+  global.mem_in_use_outside_locals.fetch_add(this->mem_in_use, std::memory_order_relaxed);
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    global.category_mem_in_use_outside_locals[i].fetch_add(this->category_mem_in_use[i],
+                                                          std::memory_order_relaxed);
+  }
+
+  if (this->is_main) {
+    /* The main thread is exiting, other thread-locals may be destructed already. */
+    use_local_counters.store(false, std::memory_order_relaxed);
+  }
+  this->destructed = true;
+}
+
+static void update_maximum(std::atomic<size_t> &maximum, const size_t value)
+{
+  size_t old_value = maximum.load(std::memory_order_relaxed);
+  while (old_value < value && !maximum.compare_exchange_weak(old_value, value)) {
+  }
+}
+
+static void update_global_peak()
+{
+  Global &global = get_global();
+  update_maximum(global.peak, memory_usage_current());
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    update_maximum(global.category_peak[i], memory_usage_category_current(eMEMCategory(i)));
+  }
+
+  std::lock_guard<std::mutex> lock{global.locals_mutex};
+  for (Local *local : global.locals) {
+    assert(!local->destructed);
+    local->mem_in_use_during_peak_update = local->mem_in_use;
+  }
+}
+
+void memory_usage_init()
+{
+  /* Make sure the global data and the counters of the main thread are constructed first. */
+  get_local_data();
+}
+
+eMEMCategory memory_usage_category()
+{
+  return current_category;
+}
+
+void memory_usage_block_alloc(const size_t size, const eMEMCategory category)
+{
+  if (LIKELY(use_local_counters.load(std::memory_order_relaxed))) {
+    Local &local = get_local_data();
+    /* Only the counters of this thread are touched, which are on their own cache line. */
+    local.blocks_num.fetch_add(1, std::memory_order_relaxed);
+    local.mem_in_use.fetch_add(int64_t(size), std::memory_order_relaxed);
+    local.category_mem_in_use[category].fetch_add(int64_t(size), std::memory_order_relaxed);
+
+    if (local.mem_in_use - local.mem_in_use_during_peak_update > peak_update_threshold) {
+      update_global_peak();
+    }
+  }
+  else {
+    Global &global = get_global();
+    global.blocks_num_outside_locals.fetch_add(1, std::memory_order_relaxed);
+    global.mem_in_use_outside_locals.fetch_add(int64_t(size), std::memory_order_relaxed);
+    global.category_mem_in_use_outside_locals[category].fetch_add(int64_t(size),
+                                                                  std::memory_order_relaxed);
+  }
+}
+
+void memory_usage_block_free(const size_t size, const eMEMCategory category)
+{
+  if (LIKELY(use_local_counters.load(std::memory_order_relaxed))) {
+    Local &local = get_local_data();
+    local.mem_in_use.fetch_sub(int64_t(size), std::memory_order_relaxed);
+    local.blocks_num.fetch_sub(1, std::memory_order_relaxed);
+    local.category_mem_in_use[category].fetch_sub(int64_t(size), std::memory_order_relaxed);
+  }
+  else {
+    Global &global = get_global();
+    global.blocks_num_outside_locals.fetch_sub(1, std::memory_order_relaxed);
+    global.mem_in_use_outside_locals.fetch_sub(int64_t(size), std::memory_order_relaxed);
+    global.category_mem_in_use_outside_locals[category].fetch_sub(int64_t(size),
+                                                                  std::memory_order_relaxed);
+  }
+}
+
+size_t memory_usage_block_num()
+{
+  Global &global = get_global();
+  std::lock_guard<std::mutex> lock{global.locals_mutex};
+
+  int64_t blocks_num = global.blocks_num_outside_locals;
+  for (Local *local : global.locals) {
+    blocks_num += local->blocks_num;
+  }
+  return size_t(blocks_num);
+}
+
+size_t memory_usage_current()
+{
+  Global &global = get_global();
+  std::lock_guard<std::mutex> lock{global.locals_mutex};
+
+  int64_t mem_in_use = global.mem_in_use_outside_locals;
+  for (Local *local : global.locals) {
+    mem_in_use += local->mem_in_use;
+  }
+  return size_t(mem_in_use);
+}
+
+size_t memory_usage_category_current(const eMEMCategory category)
+{
+  Global &global = get_global();
+  std::lock_guard<std::mutex> lock{global.locals_mutex};
+
+  int64_t mem_in_use = global.category_mem_in_use_outside_locals[category];
+  for (Local *local : global.locals) {
+    mem_in_use += local->category_mem_in_use[category];
+  }
+  return size_t(std::max<int64_t>(mem_in_use, 0));
+}
+
+size_t memory_usage_peak()
+{
+  update_global_peak();
+  return get_global().peak;
+}
+
+size_t memory_usage_category_peak(const eMEMCategory category)
+{
+  update_global_peak();
+  return get_global().category_peak[category];
+}
+
+void memory_usage_peak_reset()
+{
+  Global &global = get_global();
+  global.peak = memory_usage_current();
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    global.category_peak[i] = memory_usage_category_current(eMEMCategory(i));
+  }
+}
+
+eMEMCategory MEM_category_push(const eMEMCategory category)
+{
+  const eMEMCategory previous_category = current_category;
+  current_category = category;
+  return previous_category;
+}
+
+void MEM_category_pop(const eMEMCategory previous_category)
+{
+  current_category = previous_category;
+}
+
+const char *MEM_category_name(const eMEMCategory category)
+{
+  return category_names[category];
+}
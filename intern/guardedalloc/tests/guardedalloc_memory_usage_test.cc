@@ -0,0 +1,94 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include <thread>
+#include <vector>
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "guardedalloc_test_base.h"
+
+TEST_F(LockFreeAllocatorTest, MemoryUsageAcrossThreads)
+{
+  const size_t mem_in_use = MEM_get_memory_in_use();
+  const unsigned int blocks_in_use = MEM_get_memory_blocks_in_use();
+
+  /* Allocate on other threads and free on this one, after the threads have exited. */
+  std::vector<void *> blocks(8, nullptr);
+  std::vector<std::thread> threads;
+  for (void *&block : blocks) {
+    threads.emplace_back([&block]() { block = MEM_mallocN(1000, __func__); });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(MEM_get_memory_in_use(), mem_in_use + 8 * 1000);
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_in_use + 8);
+
+  for (void *block : blocks) {
+    MEM_freeN(block);
+  }
+
+  EXPECT_EQ(MEM_get_memory_in_use(), mem_in_use);
+  EXPECT_EQ(MEM_get_memory_blocks_in_use(), blocks_in_use);
+}
+
+TEST_F(LockFreeAllocatorTest, PeakMemory)
+{
+  MEM_reset_peak_memory();
+  const size_t mem_in_use = MEM_get_memory_in_use();
+
+  void *block = MEM_mallocN(4 * 1024 * 1024, __func__);
+  MEM_freeN(block);
+
+  EXPECT_GE(MEM_get_peak_memory(), mem_in_use + 4 * 1024 * 1024);
+}
+
+TEST_F(LockFreeAllocatorTest, MemoryCategories)
+{
+  const size_t undo_in_use = MEM_get_category_memory_in_use(MEM_CATEGORY_UNDO);
+  const size_t image_in_use = MEM_get_category_memory_in_use(MEM_CATEGORY_IMAGE);
+
+  void *undo_block;
+  void *image_block;
+  {
+    MEM_CategoryScope undo_scope(MEM_CATEGORY_UNDO);
+    undo_block = MEM_mallocN(1000, __func__);
+    {
+      MEM_CategoryScope image_scope(MEM_CATEGORY_IMAGE);
+      image_block = MEM_callocN(2000, __func__);
+    }
+  }
+  void *general_block = MEM_mallocN(3000, __func__);
+
+  EXPECT_EQ(MEM_get_category_memory_in_use(MEM_CATEGORY_UNDO), undo_in_use + 1000);
+  EXPECT_EQ(MEM_get_category_memory_in_use(MEM_CATEGORY_IMAGE), image_in_use + 2000);
+  EXPECT_EQ(MEM_allocN_len(image_block), 2000);
+
+  /* Freeing accounts to the category the block was allocated in, not the active one. */
+  MEM_freeN(undo_block);
+  MEM_freeN(image_block);
+  MEM_freeN(general_block);
+
+  EXPECT_EQ(MEM_get_category_memory_in_use(MEM_CATEGORY_UNDO), undo_in_use);
+  EXPECT_EQ(MEM_get_category_memory_in_use(MEM_CATEGORY_IMAGE), image_in_use);
+  EXPECT_GE(MEM_get_category_peak_memory(MEM_CATEGORY_IMAGE), image_in_use);
+}
+
+TEST_F(GuardedAllocatorTest, MemoryCategories)
+{
+  const size_t draw_in_use = MEM_get_category_memory_in_use(MEM_CATEGORY_DRAW);
+
+  void *draw_block;
+  {
+    MEM_CategoryScope draw_scope(MEM_CATEGORY_DRAW);
+    draw_block = MEM_mallocN(1000, __func__);
+  }
+  EXPECT_EQ(MEM_get_category_memory_in_use(MEM_CATEGORY_DRAW), draw_in_use + 1000);
+  EXPECT_GE(MEM_get_category_peak_memory(MEM_CATEGORY_DRAW), draw_in_use + 1000);
+
+  MEM_freeN(draw_block);
+  EXPECT_EQ(MEM_get_category_memory_in_use(MEM_CATEGORY_DRAW), draw_in_use);
+}
@@ -283,6 +283,11 @@ def enable(module_name, *, default_set=False, persistent=False, handle_error=Non
             import traceback
             traceback.print_exc()
 
+    use_time = _bpy.app.debug_python
+    if use_time:
+        import time
+        t_import = time.time()
+
     # reload if the mtime changes
     mod = sys.modules.get(module_name)
     # chances of the file _not_ existing are low, but it could be removed
@@ -359,6 +364,9 @@ def enable(module_name, *, default_set=False, persistent=False, handle_error=Non
                 print("Warning: Add-on '%s' was not upgraded for 2.80, ignoring" % module_name)
             return None
 
+        if use_time:
+            t_register = time.time()
+
         # 2) Try register collected modules.
         # Removed register_module, addons need to handle their own registration now.
 
@@ -386,8 +394,12 @@ def enable(module_name, *, default_set=False, persistent=False, handle_error=Non
     mod.__addon_enabled__ = True
     mod.__addon_persistent__ = persistent
 
-    if _bpy.app.debug_python:
-        print("\taddon_utils.enable", mod.__name__)
+    if use_time:
+        t_end = time.time()
+        print(
+            "\taddon_utils.enable %s (import %.4f, register %.4f)" %
+            (mod.__name__, t_register - t_import, t_end - t_register)
+        )
 
     return mod
 
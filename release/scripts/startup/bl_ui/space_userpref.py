@@ -1457,6 +1457,8 @@ class USERPREF_PT_saveload_blend(SaveLoadPanel, CenterAlignMixIn, Panel):
         col = layout.column()
         col.prop(paths, "save_version")
         col.prop(paths, "recent_files")
+        col.prop(paths, "file_compression_threads")
+        col.prop(paths, "file_compression_frame_size")
 
 
 class USERPREF_PT_saveload_blend_autosave(SaveLoadPanel, CenterAlignMixIn, Panel):
@@ -2278,6 +2280,7 @@ class USERPREF_PT_experimental_prototypes(ExperimentalPanel, Panel):
                 ({"property": "use_new_point_cloud_type"}, "T75717"),
                 ({"property": "use_full_frame_compositor"}, "T88150"),
                 ({"property": "enable_eevee_next"}, "T93220"),
+                ({"property": "use_undo_skip_unchanged_ids"}, None),
             ),
         )
 
@@ -198,10 +198,20 @@ static GPUTexture *blf_batch_cache_texture_load(void)
     int offset_x = bitmap_len_landed % tex_width;
     int offset_y = bitmap_len_landed / tex_width;
 
-    /* TODO(germano): Update more than one row in a single call. */
+    /* The bitmap rows have the same width as the texture, so the pending glyphs are uploaded
+     * in at most three calls: the end of the partially filled row, all full rows and the start
+     * of the last row. */
     while (remain) {
-      int remain_row = tex_width - offset_x;
-      int width = remain > remain_row ? remain_row : remain;
+      const int remain_row = tex_width - offset_x;
+      int width, height;
+      if (offset_x != 0 || remain < tex_width) {
+        width = remain > remain_row ? remain_row : remain;
+        height = 1;
+      }
+      else {
+        width = tex_width;
+        height = remain / tex_width;
+      }
       GPU_texture_update_sub(gc->texture,
                              GPU_DATA_UBYTE,
                              &gc->bitmap_result[bitmap_len_landed],
@@ -209,13 +219,13 @@ static GPUTexture *blf_batch_cache_texture_load(void)
                              offset_y,
                              0,
                              width,
-                             1,
+                             height,
                              0);
 
-      bitmap_len_landed += width;
-      remain -= width;
-      offset_x = 0;
-      offset_y += 1;
+      bitmap_len_landed += width * height;
+      remain -= width * height;
+      offset_x = (offset_x + width) % tex_width;
+      offset_y += (offset_x == 0) ? height : 0;
     }
 
     gc->bitmap_len_landed = bitmap_len_landed;
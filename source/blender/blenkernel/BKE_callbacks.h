@@ -105,6 +105,11 @@ typedef struct bCallbackFuncStore {
   void (*func)(struct Main *, struct PointerRNA **, int num_pointers, void *arg);
   void *arg;
   short alloc;
+  /**
+   * Optional, returns false when `func` has nothing to run, for stores that forward the event to
+   * handlers which are registered elsewhere. See #BKE_callback_has_handlers.
+   */
+  bool (*poll)(void *arg);
 } bCallbackFuncStore;
 
 void BKE_callback_exec(struct Main *bmain,
@@ -119,6 +124,11 @@ void BKE_callback_exec_id_depsgraph(struct Main *bmain,
                                     eCbEvent evt);
 void BKE_callback_add(bCallbackFuncStore *funcstore, eCbEvent evt);
 void BKE_callback_remove(bCallbackFuncStore *funcstore, eCbEvent evt);
+/**
+ * Check whether executing the event would run any handler, to skip work that is only needed
+ * to keep handlers working.
+ */
+bool BKE_callback_has_handlers(eCbEvent evt);
 
 void BKE_callback_global_init(void);
 /**
@@ -68,7 +68,13 @@ class CurvesGeometryRuntime {
   mutable std::mutex offsets_cache_mutex;
   mutable bool offsets_cache_dirty = true;
 
+  /**
+   * NURBS basis caches, shared by all curves with the same number of control points and
+   * evaluated points, order, cyclic and knots mode. #nurbs_basis_cache_indices contains the index
+   * of the cache used by every NURBS curve.
+   */
   mutable Vector<curves::nurbs::BasisCache> nurbs_basis_cache;
+  mutable Vector<int> nurbs_basis_cache_indices;
   mutable std::mutex nurbs_basis_cache_mutex;
   mutable bool nurbs_basis_cache_dirty = true;
 
@@ -165,6 +171,10 @@ class CurvesGeometry : public ::CurvesGeometry {
 
   /** Return true if all of the curves have the provided type. */
   bool is_single_type(CurveType type) const;
+  /**
+   * All of the curve indices for curves with a specific type.
+   */
+  IndexMask indices_for_curve_type(CurveType type, Vector<int64_t> &r_indices) const;
 
   Span<float3> positions() const;
   MutableSpan<float3> positions_for_write();
@@ -261,17 +271,10 @@ class CurvesGeometry : public ::CurvesGeometry {
    */
   bool bounds_min_max(float3 &min, float3 &max) const;
 
- private:
-  /**
-   * All of the curve indices for curves with a specific type.
-   */
-  IndexMask indices_for_curve_type(CurveType type, Vector<int64_t> &r_indices) const;
-
   /* --------------------------------------------------------------------
    * Evaluation.
    */
 
- public:
   /**
    * The total number of points in the evaluated poly curve.
    * This can depend on the resolution attribute if it exists.
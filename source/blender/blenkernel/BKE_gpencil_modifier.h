@@ -69,6 +69,11 @@ typedef enum {
   eGpencilModifierTypeFlag_NoUserAdd = (1 << 5),
   /** Can't be applied. */
   eGpencilModifierTypeFlag_NoApply = (1 << 6),
+  /**
+   * #GpencilModifierTypeInfo.deformStroke only modifies the given stroke, so the strokes of all
+   * layers can be deformed in parallel.
+   */
+  eGpencilModifierTypeFlag_SupportsThreadedDeform = (1 << 7),
 } GpencilModifierTypeFlag;
 
 typedef void (*GreasePencilIDWalkFunc)(void *userData,
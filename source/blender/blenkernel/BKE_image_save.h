@@ -14,6 +14,7 @@ extern "C" {
 
 struct Image;
 struct Main;
+struct RenderData;
 struct ReportList;
 struct Scene;
 struct RenderResult;
@@ -70,6 +71,20 @@ bool BKE_image_render_write(struct ReportList *reports,
                             const bool stamp,
                             const char *filepath_basis);
 
+/**
+ * Same as #BKE_image_render_write, with the scene settings passed in explicitly. Only the views,
+ * dither and stamp settings of \a rd are used, so writing can happen from another thread with a
+ * partial copy of the render data while the scene changes.
+ *
+ * \param imf: Format to write, as initialized by #BKE_image_format_init_for_write.
+ */
+bool BKE_image_render_write_ex(struct ReportList *reports,
+                               struct RenderResult *rr,
+                               const struct RenderData *rd,
+                               const struct ImageFormatData *imf,
+                               const bool stamp,
+                               const char *filepath_basis);
+
 #ifdef __cplusplus
 }
 #endif
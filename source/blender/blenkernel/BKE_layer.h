@@ -153,6 +153,12 @@ void BKE_layer_collection_resync_allow(void);
 void BKE_layer_collection_doversion_2_80(const struct Scene *scene, struct ViewLayer *view_layer);
 
 void BKE_main_collection_sync(const struct Main *bmain);
+/**
+ * Same as #BKE_main_collection_sync, but only resync the scenes using the given collection,
+ * for when only its content changed.
+ */
+void BKE_main_collection_sync_for_collection(const struct Main *bmain,
+                                             const struct Collection *collection);
 void BKE_scene_collection_sync(const struct Scene *scene);
 /**
  * Update view layer collection tree from collections used in the scene.
@@ -351,6 +351,17 @@ void BKE_mesh_recalc_looptri(const struct MLoop *mloop,
                              int totloop,
                              int totpoly,
                              struct MLoopTri *mlooptri);
+/**
+ * Update an existing tessellation after vertex positions changed. Only quads and n-gons are
+ * recalculated, since the tessellation of triangles does not depend on positions.
+ * The topology must be the same as when \a mlooptri was calculated.
+ */
+void BKE_mesh_recalc_looptri_positions(const struct MLoop *mloop,
+                                       const struct MPoly *mpoly,
+                                       const struct MVert *mvert,
+                                       int totloop,
+                                       int totpoly,
+                                       struct MLoopTri *mlooptri);
 /**
  * A version of #BKE_mesh_recalc_looptri which takes pre-calculated polygon normals
  * (used to avoid having to calculate the face normal for NGON tessellation).
@@ -22,9 +22,21 @@ struct MLoop;
 struct MLoopTri;
 struct MVertTri;
 struct Mesh;
+struct MeshElemMap;
 struct Object;
 struct Scene;
 
+/**
+ * Indices of loose geometry: vertices that aren't used by any edge,
+ * and edges tagged with #ME_LOOSEEDGE.
+ */
+typedef struct MeshLooseGeom {
+  int verts_len;
+  int edges_len;
+  int *verts;
+  int *edges;
+} MeshLooseGeom;
+
 /**
  * \brief Initialize the runtime of the given mesh.
  *
@@ -43,12 +55,38 @@ void BKE_mesh_runtime_free_data(struct Mesh *mesh);
 void BKE_mesh_runtime_reset_on_copy(struct Mesh *mesh, int flag);
 int BKE_mesh_runtime_looptri_len(const struct Mesh *mesh);
 void BKE_mesh_runtime_looptri_recalc(struct Mesh *mesh);
+/**
+ * Reuse the tessellation of the source mesh, the copy has the same topology and positions.
+ * The array is shared with the source until one of them re-tessellates in place.
+ */
+void BKE_mesh_runtime_looptris_share(struct Mesh *mesh_dst, const struct Mesh *mesh_src);
 /**
  * \note This function only fills a cache, and therefore the mesh argument can
  * be considered logically const. Concurrent access is protected by a mutex.
  * \note This is a ported copy of dm_getLoopTriArray(dm).
  */
 const struct MLoopTri *BKE_mesh_runtime_looptri_ensure(const struct Mesh *mesh);
+/**
+ * Cached maps from every vertex to its polygons and edges, and from every edge to its polygons.
+ * They are the same as the ones created by #BKE_mesh_vert_poly_map_create,
+ * #BKE_mesh_vert_edge_map_create and #BKE_mesh_edge_poly_map_create, but are only computed once,
+ * and are freed when the mesh geometry is cleared, see #BKE_mesh_runtime_clear_geometry.
+ *
+ * \note These functions only fill a cache, and therefore the mesh argument can
+ * be considered logically const. Concurrent access is protected by a mutex.
+ */
+const struct MeshElemMap *BKE_mesh_runtime_vert_poly_map_ensure(const struct Mesh *mesh);
+const struct MeshElemMap *BKE_mesh_runtime_vert_edge_map_ensure(const struct Mesh *mesh);
+const struct MeshElemMap *BKE_mesh_runtime_edge_poly_map_ensure(const struct Mesh *mesh);
+/**
+ * Cached loose vertices and edges, computed in parallel and freed together with the topology maps
+ * when the mesh geometry is cleared. Deforming the mesh in place does not invalidate them.
+ *
+ * \note This function only fills a cache, and therefore the mesh argument can
+ * be considered logically const. Concurrent access is protected by a mutex.
+ */
+const MeshLooseGeom *BKE_mesh_runtime_loose_geom_ensure(const struct Mesh *mesh);
+
 bool BKE_mesh_runtime_ensure_edit_data(struct Mesh *mesh);
 bool BKE_mesh_runtime_clear_edit_data(struct Mesh *mesh);
 bool BKE_mesh_runtime_reset_edit_data(struct Mesh *mesh);
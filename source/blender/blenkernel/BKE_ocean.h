@@ -104,6 +104,14 @@ float BKE_ocean_jminus_to_foam(float jminus, float coverage);
  * Sampling the ocean surface.
  */
 void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float v);
+/**
+ * Sample the ocean surface at \a uv_num points, locking the ocean only once.
+ * Use this instead of #BKE_ocean_eval_uv when sampling many points from multiple threads.
+ */
+void BKE_ocean_eval_uv_array(struct Ocean *oc,
+                             struct OceanResult *r_ocr,
+                             const float (*uv)[2],
+                             int uv_num);
 /**
  * Use catmullrom interpolation rather than linear.
  */
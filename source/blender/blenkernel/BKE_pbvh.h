@@ -352,6 +352,11 @@ struct GSet *BKE_pbvh_bmesh_node_faces(PBVHNode *node);
  */
 void BKE_pbvh_bmesh_node_save_orig(struct BMesh *bm, PBVHNode *node);
 void BKE_pbvh_bmesh_after_stroke(PBVH *pbvh);
+/**
+ * Test whether dynamic topology has left the tree with many nearly empty leaves, in which case
+ * rebuilding it restores the node sizes and bounds of a freshly built tree.
+ */
+bool BKE_pbvh_bmesh_needs_rebuild(const PBVH *pbvh);
 
 /* Update Bounding Box/Redraw and clear flags. */
 
@@ -20,6 +20,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -579,6 +580,78 @@ static void animsys_write_orig_anim_rna(PointerRNA *ptr,
   }
 }
 
+/* Minimum number of F-Curves in a list for their evaluation to be done in parallel. */
+#define FCURVES_PARALLEL_EVAL_MIN 256
+
+typedef struct FCurveParallelEvalItem {
+  FCurve *fcu;
+  PathResolvedRNA anim_rna;
+  float value;
+  bool is_resolved;
+} FCurveParallelEvalItem;
+
+typedef struct FCurveParallelEvalData {
+  PointerRNA *ptr;
+  const AnimationEvalContext *anim_eval_context;
+  FCurveParallelEvalItem *items;
+} FCurveParallelEvalData;
+
+static void animsys_evaluate_fcurves_parallel_cb(void *__restrict userdata,
+                                                 const int index,
+                                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  FCurveParallelEvalData *data = userdata;
+  FCurveParallelEvalItem *item = &data->items[index];
+
+  item->is_resolved = BKE_animsys_rna_path_resolve(
+      data->ptr, item->fcu->rna_path, item->fcu->array_index, &item->anim_rna);
+  if (item->is_resolved) {
+    item->value = calculate_fcurve(&item->anim_rna, item->fcu, data->anim_eval_context);
+  }
+}
+
+/**
+ * Resolve and evaluate the curves of large lists in parallel, the results are written to the
+ * properties afterwards in order on a single thread, since RNA setters are not thread-safe.
+ */
+static void animsys_evaluate_fcurves_parallel(PointerRNA *ptr,
+                                              ListBase *list,
+                                              const int fcurves_num,
+                                              const AnimationEvalContext *anim_eval_context,
+                                              bool flush_to_original)
+{
+  FCurveParallelEvalItem *items = MEM_malloc_arrayN(
+      fcurves_num, sizeof(FCurveParallelEvalItem), __func__);
+  int items_num = 0;
+  LISTBASE_FOREACH (FCurve *, fcu, list) {
+    if (is_fcurve_evaluatable(fcu)) {
+      items[items_num++].fcu = fcu;
+    }
+  }
+
+  FCurveParallelEvalData data = {
+      .ptr = ptr,
+      .anim_eval_context = anim_eval_context,
+      .items = items,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 64;
+  BLI_task_parallel_range(0, items_num, &data, animsys_evaluate_fcurves_parallel_cb, &settings);
+
+  for (int i = 0; i < items_num; i++) {
+    FCurveParallelEvalItem *item = &items[i];
+    if (item->is_resolved) {
+      BKE_animsys_write_to_rna_path(&item->anim_rna, item->value);
+      if (flush_to_original) {
+        animsys_write_orig_anim_rna(ptr, item->fcu->rna_path, item->fcu->array_index, item->value);
+      }
+    }
+  }
+
+  MEM_freeN(items);
+}
+
 /**
  * Evaluate all the F-Curves in the given list
  * This performs a set of standard checks. If extra checks are required,
@@ -589,6 +662,13 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
+  const int fcurves_num = BLI_listbase_count_at_most(list, FCURVES_PARALLEL_EVAL_MIN);
+  if (fcurves_num >= FCURVES_PARALLEL_EVAL_MIN) {
+    animsys_evaluate_fcurves_parallel(
+        ptr, list, BLI_listbase_count(list), anim_eval_context, flush_to_original);
+    return;
+  }
+
   /* Calculate then execute each curve. */
   LISTBASE_FOREACH (FCurve *, fcu, list) {
 
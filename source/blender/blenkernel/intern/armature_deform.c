@@ -46,46 +46,42 @@ static CLG_LogRef LOG = {"bke.armature_deform"};
 /** \name Armature Deform Internal Utilities
  * \{ */
 
-/* Add the effect of one bone or B-Bone segment to the accumulated result. */
+/**
+ * Add the effect of one bone or B-Bone segment to the accumulated result.
+ *
+ * Without dual quaternions the weighted deform matrices are summed, so a vertex only needs a
+ * single matrix-vector product no matter how many bones influence it. The rotation and scale part
+ * of the sum is also the deform matrix of the vertex. Only the affine part of \a mat_accum is
+ * accumulated.
+ */
 static void pchan_deform_accumulate(const DualQuat *deform_dq,
                                     const float deform_mat[4][4],
-                                    const float co_in[3],
                                     float weight,
-                                    float co_accum[3],
-                                    DualQuat *dq_accum,
-                                    float mat_accum[3][3])
+                                    float mat_accum[4][4],
+                                    DualQuat *dq_accum)
 {
   if (weight == 0.0f) {
     return;
   }
 
   if (dq_accum) {
-    BLI_assert(!co_accum);
+    BLI_assert(!mat_accum);
 
     add_weighted_dq_dq(dq_accum, deform_dq, weight);
   }
   else {
-    float tmp[3];
-    mul_v3_m4v3(tmp, deform_mat, co_in);
-
-    sub_v3_v3(tmp, co_in);
-    madd_v3_v3fl(co_accum, tmp, weight);
-
-    if (mat_accum) {
-      float tmpmat[3][3];
-      copy_m3_m4(tmpmat, deform_mat);
-
-      madd_m3_m3m3fl(mat_accum, mat_accum, tmpmat, weight);
-    }
+    madd_v3_v3fl(mat_accum[0], deform_mat[0], weight);
+    madd_v3_v3fl(mat_accum[1], deform_mat[1], weight);
+    madd_v3_v3fl(mat_accum[2], deform_mat[2], weight);
+    madd_v3_v3fl(mat_accum[3], deform_mat[3], weight);
   }
 }
 
 static void b_bone_deform(const bPoseChannel *pchan,
                           const float co[3],
                           float weight,
-                          float vec[3],
-                          DualQuat *dq,
-                          float defmat[3][3])
+                          float mat_accum[4][4],
+                          DualQuat *dq)
 {
   const DualQuat *quats = pchan->runtime.bbone_dual_quats;
   const Mat4 *mats = pchan->runtime.bbone_deform_mats;
@@ -100,9 +96,8 @@ static void b_bone_deform(const bPoseChannel *pchan,
   BKE_pchan_bbone_deform_segment_index(pchan, y / pchan->bone->length, &index, &blend);
 
   pchan_deform_accumulate(
-      &quats[index], mats[index + 1].mat, co, weight * (1.0f - blend), vec, dq, defmat);
-  pchan_deform_accumulate(
-      &quats[index + 1], mats[index + 2].mat, co, weight * blend, vec, dq, defmat);
+      &quats[index], mats[index + 1].mat, weight * (1.0f - blend), mat_accum, dq);
+  pchan_deform_accumulate(&quats[index + 1], mats[index + 2].mat, weight * blend, mat_accum, dq);
 }
 
 float distfactor_to_bone(
@@ -158,8 +153,10 @@ float distfactor_to_bone(
   return 1.0f - (a * a) / (rdist * rdist);
 }
 
-static float dist_bone_deform(
-    bPoseChannel *pchan, float vec[3], DualQuat *dq, float mat[3][3], const float co[3])
+static float dist_bone_deform(bPoseChannel *pchan,
+                              float mat[4][4],
+                              DualQuat *dq,
+                              const float co[3])
 {
   Bone *bone = pchan->bone;
   float fac, contrib = 0.0;
@@ -176,11 +173,10 @@ static float dist_bone_deform(
     contrib = fac;
     if (contrib > 0.0f) {
       if (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) {
-        b_bone_deform(pchan, co, fac, vec, dq, mat);
+        b_bone_deform(pchan, co, fac, mat, dq);
       }
       else {
-        pchan_deform_accumulate(
-            &pchan->runtime.deform_dual_quat, pchan->chan_mat, co, fac, vec, dq, mat);
+        pchan_deform_accumulate(&pchan->runtime.deform_dual_quat, pchan->chan_mat, fac, mat, dq);
       }
     }
   }
@@ -190,9 +186,8 @@ static float dist_bone_deform(
 
 static void pchan_bone_deform(bPoseChannel *pchan,
                               float weight,
-                              float vec[3],
+                              float mat[4][4],
                               DualQuat *dq,
-                              float mat[3][3],
                               const float co[3],
                               float *contrib)
 {
@@ -203,11 +198,10 @@ static void pchan_bone_deform(bPoseChannel *pchan,
   }
 
   if (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) {
-    b_bone_deform(pchan, co, weight, vec, dq, mat);
+    b_bone_deform(pchan, co, weight, mat, dq);
   }
   else {
-    pchan_deform_accumulate(
-        &pchan->runtime.deform_dual_quat, pchan->chan_mat, co, weight, vec, dq, mat);
+    pchan_deform_accumulate(&pchan->runtime.deform_dual_quat, pchan->chan_mat, weight, mat, dq);
   }
 
   (*contrib) += weight;
@@ -266,8 +260,8 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
   DualQuat sumdq, *dq = NULL;
   bPoseChannel *pchan;
   float *co, dco[3];
-  float sumvec[3], summat[3][3];
-  float *vec = NULL, (*smat)[3] = NULL;
+  float summat4[4][4], summat[3][3];
+  float(*mat4)[4] = NULL, (*smat)[3] = NULL;
   float contrib = 0.0f;
   float armature_weight = 1.0f; /* default to 1 if no overall def group */
   float prevco_weight = 1.0f;   /* weight for optional cached vertexcos */
@@ -277,13 +271,8 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     dq = &sumdq;
   }
   else {
-    zero_v3(sumvec);
-    vec = sumvec;
-
-    if (vert_deform_mats) {
-      zero_m3(summat);
-      smat = summat;
-    }
+    zero_m4(summat4);
+    mat4 = summat4;
   }
 
   if (armature_def_nr != -1 && dvert) {
@@ -328,14 +317,14 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
               co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
         }
 
-        pchan_bone_deform(pchan, weight, vec, dq, smat, co, &contrib);
+        pchan_bone_deform(pchan, weight, mat4, dq, co, &contrib);
       }
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
     if (deformed == 0 && use_envelope) {
       for (pchan = data->ob_arm->pose->chanbase.first; pchan; pchan = pchan->next) {
         if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
-          contrib += dist_bone_deform(pchan, vec, dq, smat, co);
+          contrib += dist_bone_deform(pchan, mat4, dq, co);
         }
       }
     }
@@ -343,7 +332,7 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
   else if (use_envelope) {
     for (pchan = data->ob_arm->pose->chanbase.first; pchan; pchan = pchan->next) {
       if (!(pchan->bone->flag & BONE_NO_DEFORM)) {
-        contrib += dist_bone_deform(pchan, vec, dq, smat, co);
+        contrib += dist_bone_deform(pchan, mat4, dq, co);
       }
     }
   }
@@ -367,8 +356,18 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
       smat = summat;
     }
     else {
+      /* The summed weights equal `contrib`, so this is the weighted sum of the offsets. */
+      float vec[3];
+      mul_v3_m4v3(vec, mat4, co);
+      madd_v3_v3fl(vec, co, -contrib);
+
       mul_v3_fl(vec, armature_weight / contrib);
       add_v3_v3v3(co, vec, co);
+
+      if (vert_deform_mats) {
+        copy_m3_m4(summat, mat4);
+        smat = summat;
+      }
     }
 
     if (vert_deform_mats) {
@@ -118,6 +118,7 @@ void AssetLibraryService::app_handler_register()
 
   on_load_callback_store_.func = &on_blendfile_load;
   on_load_callback_store_.arg = this;
+  on_load_callback_store_.poll = nullptr;
 
   BKE_callback_add(&on_load_callback_store_, BKE_CB_EVT_LOAD_PRE);
 }
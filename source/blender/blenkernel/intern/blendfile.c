@@ -419,6 +419,7 @@ static void setup_app_data(bContext *C,
 
   if (mode != LOAD_UNDO && !USER_EXPERIMENTAL_TEST(&U, no_override_auto_resync)) {
     reports->duration.lib_overrides_resync = PIL_check_seconds_timer();
+    const int resynced_lib_overrides_num = reports->count.resynced_lib_overrides;
 
     BKE_lib_override_library_main_resync(
         bmain,
@@ -429,8 +430,12 @@ static void setup_app_data(bContext *C,
     reports->duration.lib_overrides_resync = PIL_check_seconds_timer() -
                                              reports->duration.lib_overrides_resync;
 
-    /* We need to rebuild some of the deleted override rules (for UI feedback purpose). */
-    BKE_lib_override_library_main_operations_create(bmain, true);
+    /* We need to rebuild some of the deleted override rules (for UI feedback purpose). Overrides
+     * that were not resynced keep the rules stored in the file, which were generated when it was
+     * saved, so the full (and expensive) RNA diffing of all overrides can be skipped then. */
+    if (reports->count.resynced_lib_overrides != resynced_lib_overrides_num) {
+      BKE_lib_override_library_main_operations_create(bmain, true);
+    }
   }
 }
 
@@ -97,6 +97,18 @@ void BKE_callback_remove(bCallbackFuncStore *funcstore, eCbEvent evt)
   }
 }
 
+bool BKE_callback_has_handlers(eCbEvent evt)
+{
+  ASSERT_CALLBACKS_INITIALIZED();
+
+  LISTBASE_FOREACH (bCallbackFuncStore *, funcstore, &callback_slots[evt]) {
+    if (funcstore->poll == NULL || funcstore->poll(funcstore->arg)) {
+      return true;
+    }
+  }
+  return false;
+}
+
 void BKE_callback_global_init(void)
 {
   callbacks_initialized = true;
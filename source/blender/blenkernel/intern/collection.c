@@ -1100,7 +1100,7 @@ bool BKE_collection_object_add_notest(Main *bmain, Collection *collection, Objec
   }
 
   if (BKE_collection_is_in_scene(collection)) {
-    BKE_main_collection_sync(bmain);
+    BKE_main_collection_sync_for_collection(bmain, collection);
   }
 
   DEG_id_tag_update(&collection->id, ID_RECALC_GEOMETRY);
@@ -1155,7 +1155,7 @@ bool BKE_collection_object_remove(Main *bmain,
   }
 
   if (BKE_collection_is_in_scene(collection)) {
-    BKE_main_collection_sync(bmain);
+    BKE_main_collection_sync_for_collection(bmain, collection);
   }
 
   DEG_id_tag_update(&collection->id, ID_RECALC_GEOMETRY);
@@ -58,6 +58,16 @@ typedef struct SelfColDetectData {
   bool collided;
 } SelfColDetectData;
 
+typedef struct ColOverlapData {
+  ClothModifierData *clmd;
+  Object **collobjs;
+  BVHTreeOverlap **overlap_obj;
+  uint *coll_counts_obj;
+  float step;
+  float dt;
+  bool is_hair;
+} ColOverlapData;
+
 /***********************************
  * Collision modifier code start
  ***********************************/
@@ -1538,6 +1548,30 @@ static bool cloth_bvh_self_overlap_cb(void *userdata, int index_a, int index_b,
   return false;
 }
 
+static void cloth_bvh_objcollisions_overlap(void *__restrict userdata,
+                                            const int index,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ColOverlapData *data = (ColOverlapData *)userdata;
+  ClothModifierData *clmd = data->clmd;
+  Object *collob = data->collobjs[index];
+  CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
+      collob, eModifierType_Collision);
+
+  if (!collmd->bvhtree) {
+    return;
+  }
+
+  /* Move object to position (step) in time. */
+  collision_move_object(collmd, data->step + data->dt, data->step, false);
+
+  data->overlap_obj[index] = BLI_bvhtree_overlap(clmd->clothObject->bvhtree,
+                                                 collmd->bvhtree,
+                                                 &data->coll_counts_obj[index],
+                                                 data->is_hair ? NULL : cloth_bvh_obj_overlap_cb,
+                                                 clmd);
+}
+
 int cloth_bvh_collision(
     Depsgraph *depsgraph, Object *ob, ClothModifierData *clmd, float step, float dt)
 {
@@ -1577,24 +1611,22 @@ int cloth_bvh_collision(
       coll_counts_obj = MEM_callocN(sizeof(uint) * numcollobj, "CollCounts");
       overlap_obj = MEM_callocN(sizeof(*overlap_obj) * numcollobj, "BVHOverlap");
 
-      for (i = 0; i < numcollobj; i++) {
-        Object *collob = collobjs[i];
-        CollisionModifierData *collmd = (CollisionModifierData *)BKE_modifiers_findby_type(
-            collob, eModifierType_Collision);
-
-        if (!collmd->bvhtree) {
-          continue;
-        }
-
-        /* Move object to position (step) in time. */
-        collision_move_object(collmd, step + dt, step, false);
-
-        overlap_obj[i] = BLI_bvhtree_overlap(cloth_bvh,
-                                             collmd->bvhtree,
-                                             &coll_counts_obj[i],
-                                             is_hair ? NULL : cloth_bvh_obj_overlap_cb,
-                                             clmd);
-      }
+      /* Colliders are independent of each other, so they can be moved and tested for overlap
+       * in parallel. Every task only writes to the results of its own collider. */
+      ColOverlapData data = {
+          .clmd = clmd,
+          .collobjs = collobjs,
+          .overlap_obj = overlap_obj,
+          .coll_counts_obj = coll_counts_obj,
+          .step = step,
+          .dt = dt,
+          .is_hair = is_hair,
+      };
+
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.min_iter_per_thread = 1;
+      BLI_task_parallel_range(0, numcollobj, &data, cloth_bvh_objcollisions_overlap, &settings);
     }
   }
 
@@ -13,6 +13,7 @@
 #include <string.h>
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_curve_types.h"
@@ -187,6 +188,140 @@ static bool calc_curve_deform(
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Curve Deform Multi-Threaded Coordinate Arrays
+ *
+ * The curve path is looked up from the cached accumulated lengths of the curve,
+ * so deforming each vertex doesn't depend on the others.
+ * \{ */
+
+typedef struct CurveDeformUserdata {
+  const Object *ob_curve;
+  const CurveDeform *cd;
+  float (*vert_coords)[3];
+  const MDeformVert *dvert;
+  int defgrp_index;
+  bool invert_vgroup;
+  short defaxis;
+  /** Transform into curve space first, otherwise the bounds pass already did. */
+  bool use_curvespace_transform;
+} CurveDeformUserdata;
+
+typedef struct CurveDeformBoundsChunk {
+  float dmin[3], dmax[3];
+} CurveDeformBoundsChunk;
+
+static float curve_deform_vert_weight(const CurveDeformUserdata *data, const int i)
+{
+  if (data->dvert == NULL) {
+    return 1.0f;
+  }
+  const float weight = BKE_defvert_find_weight(&data->dvert[i], data->defgrp_index);
+  return data->invert_vgroup ? 1.0f - weight : weight;
+}
+
+static void curve_deform_bounds_task(void *__restrict userdata,
+                                     const int i,
+                                     const TaskParallelTLS *__restrict tls)
+{
+  const CurveDeformUserdata *data = userdata;
+  CurveDeformBoundsChunk *bounds = tls->userdata_chunk;
+  if (curve_deform_vert_weight(data, i) > 0.0f) {
+    mul_m4_v3(data->cd->curvespace, data->vert_coords[i]);
+    minmax_v3v3_v3(bounds->dmin, bounds->dmax, data->vert_coords[i]);
+  }
+}
+
+static void curve_deform_bounds_reduce(const void *__restrict UNUSED(userdata),
+                                       void *__restrict chunk_join,
+                                       void *__restrict chunk)
+{
+  CurveDeformBoundsChunk *join = chunk_join;
+  const CurveDeformBoundsChunk *bounds = chunk;
+  /* Chunks without weighted vertices still hold their initial (inverted) bounds,
+   * joining them component-wise keeps them from widening the result. */
+  DO_MIN(bounds->dmin, join->dmin);
+  DO_MAX(bounds->dmax, join->dmax);
+}
+
+static void curve_deform_vert_task(void *__restrict userdata,
+                                   const int i,
+                                   const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const CurveDeformUserdata *data = userdata;
+  const CurveDeform *cd = data->cd;
+  float *co = data->vert_coords[i];
+
+  const float weight = curve_deform_vert_weight(data, i);
+  if (weight > 0.0f) {
+    if (data->use_curvespace_transform) {
+      mul_m4_v3(cd->curvespace, co);
+    }
+    if (data->dvert) {
+      float vec[3];
+      copy_v3_v3(vec, co);
+      calc_curve_deform(data->ob_curve, vec, data->defaxis, cd, NULL);
+      interp_v3_v3v3(co, co, vec, weight);
+    }
+    else {
+      calc_curve_deform(data->ob_curve, co, data->defaxis, cd, NULL);
+    }
+    mul_m4_v3(cd->objectspace, co);
+  }
+}
+
+/**
+ * Deform a coordinate array in parallel, optionally weighted by \a dvert.
+ *
+ * \param use_bounds: Calculate the bounds of the (weighted) coordinates in curve space first,
+ * otherwise the bounds of \a cd are used as is.
+ */
+static void curve_deform_coords_array(const Object *ob_curve,
+                                      CurveDeform *cd,
+                                      float (*vert_coords)[3],
+                                      const int vert_coords_len,
+                                      const MDeformVert *dvert,
+                                      const int defgrp_index,
+                                      const bool invert_vgroup,
+                                      const short defaxis,
+                                      const bool use_bounds)
+{
+  CurveDeformUserdata data = {
+      .ob_curve = ob_curve,
+      .cd = cd,
+      .vert_coords = vert_coords,
+      .dvert = dvert,
+      .defgrp_index = defgrp_index,
+      .invert_vgroup = invert_vgroup,
+      .defaxis = defaxis,
+      .use_curvespace_transform = !use_bounds,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 256;
+
+  if (use_bounds) {
+    CurveDeformBoundsChunk bounds;
+    copy_v3_v3(bounds.dmin, cd->dmin);
+    copy_v3_v3(bounds.dmax, cd->dmax);
+
+    TaskParallelSettings bounds_settings = settings;
+    bounds_settings.userdata_chunk = &bounds;
+    bounds_settings.userdata_chunk_size = sizeof(bounds);
+    bounds_settings.func_reduce = curve_deform_bounds_reduce;
+    BLI_task_parallel_range(
+        0, vert_coords_len, &data, curve_deform_bounds_task, &bounds_settings);
+
+    copy_v3_v3(cd->dmin, bounds.dmin);
+    copy_v3_v3(cd->dmax, bounds.dmax);
+  }
+
+  BLI_task_parallel_range(0, vert_coords_len, &data, curve_deform_vert_task, &settings);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Curve Deform #BKE_curve_deform_coords API
  *
@@ -275,9 +410,15 @@ static void curve_deform_coords_impl(const Object *ob_curve,
         }
       }
       else {
-        for (a = 0; a < vert_coords_len; a++) {
-          DEFORM_OP(&dvert[a]);
-        }
+        curve_deform_coords_array(ob_curve,
+                                  &cd,
+                                  vert_coords,
+                                  vert_coords_len,
+                                  dvert,
+                                  defgrp_index,
+                                  invert_vgroup,
+                                  defaxis,
+                                  false);
       }
 
 #undef DEFORM_OP
@@ -324,14 +465,15 @@ static void curve_deform_coords_impl(const Object *ob_curve,
         }
       }
       else {
-
-        for (a = 0; a < vert_coords_len; a++) {
-          DEFORM_OP_MINMAX(&dvert[a]);
-        }
-
-        for (a = 0; a < vert_coords_len; a++) {
-          DEFORM_OP_CLAMPED(&dvert[a]);
-        }
+        curve_deform_coords_array(ob_curve,
+                                  &cd,
+                                  vert_coords,
+                                  vert_coords_len,
+                                  dvert,
+                                  defgrp_index,
+                                  invert_vgroup,
+                                  defaxis,
+                                  true);
       }
     }
 
@@ -339,25 +481,15 @@ static void curve_deform_coords_impl(const Object *ob_curve,
 #undef DEFORM_OP_CLAMPED
   }
   else {
-    if (cu->flag & CU_DEFORM_BOUNDS_OFF) {
-      for (a = 0; a < vert_coords_len; a++) {
-        mul_m4_v3(cd.curvespace, vert_coords[a]);
-        calc_curve_deform(ob_curve, vert_coords[a], defaxis, &cd, NULL);
-        mul_m4_v3(cd.objectspace, vert_coords[a]);
-      }
-    }
-    else {
-      for (a = 0; a < vert_coords_len; a++) {
-        mul_m4_v3(cd.curvespace, vert_coords[a]);
-        minmax_v3v3_v3(cd.dmin, cd.dmax, vert_coords[a]);
-      }
-
-      for (a = 0; a < vert_coords_len; a++) {
-        /* Already in 'cd.curvespace', previous for loop. */
-        calc_curve_deform(ob_curve, vert_coords[a], defaxis, &cd, NULL);
-        mul_m4_v3(cd.objectspace, vert_coords[a]);
-      }
-    }
+    curve_deform_coords_array(ob_curve,
+                              &cd,
+                              vert_coords,
+                              vert_coords_len,
+                              NULL,
+                              defgrp_index,
+                              invert_vgroup,
+                              defaxis,
+                              (cu->flag & CU_DEFORM_BOUNDS_OFF) == 0);
   }
 }
 
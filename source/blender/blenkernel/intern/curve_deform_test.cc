@@ -0,0 +1,102 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+#include "testing/testing.h"
+
+#include "BKE_anim_path.h"
+#include "BKE_curve.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "DNA_curve_types.h"
+#include "DNA_meshdata_types.h"
+#include "DNA_object_types.h"
+
+#include "BLI_listbase.h"
+#include "BLI_math_matrix.h"
+#include "BLI_math_rotation.h"
+#include "BLI_math_vec_types.hh"
+#include "BLI_math_vector.h"
+
+namespace blender::bke::tests {
+
+struct CurveDeformTestContext {
+  Curve curve;
+  Nurb nurb;
+  Object ob_curve;
+  Object ob_target;
+};
+
+/** A straight poly path along X, from the origin to `(path_len, 0, 0)`. */
+static void test_curve_deform_init(CurveDeformTestContext *ctx, const int path_len)
+{
+  ctx->nurb.type = CU_POLY;
+  BLI_addtail(&ctx->curve.nurb, &ctx->nurb);
+
+  ctx->ob_curve.type = OB_CURVES_LEGACY;
+  ctx->ob_curve.data = &ctx->curve;
+  unit_m4(ctx->ob_curve.obmat);
+  unit_m4(ctx->ob_target.obmat);
+
+  BevList *bl = static_cast<BevList *>(MEM_callocN(sizeof(BevList), __func__));
+  bl->nr = path_len + 1;
+  bl->poly = -1;
+  bl->bevpoints = static_cast<BevPoint *>(
+      MEM_calloc_arrayN(bl->nr, sizeof(BevPoint), __func__));
+  for (int i = 0; i < bl->nr; i++) {
+    BevPoint *bevp = &bl->bevpoints[i];
+    bevp->vec[0] = float(i);
+    bevp->radius = 1.0f;
+    unit_qt(bevp->quat);
+  }
+
+  CurveCache *curve_cache = static_cast<CurveCache *>(MEM_callocN(sizeof(CurveCache), __func__));
+  BLI_addtail(&curve_cache->bev, bl);
+  ctx->ob_curve.runtime.curve_cache = curve_cache;
+  BKE_anim_path_calc_data(&ctx->ob_curve);
+}
+
+static void test_curve_deform_free(CurveDeformTestContext *ctx)
+{
+  CurveCache *curve_cache = ctx->ob_curve.runtime.curve_cache;
+  BKE_curve_bevelList_free(&curve_cache->bev);
+  MEM_SAFE_FREE(curve_cache->anim_path_accum_length);
+  MEM_freeN(curve_cache);
+}
+
+/**
+ * Only a single vertex is weighted, so almost every chunk of the threaded bounds pass is empty.
+ * Those empty chunks must not widen the bounds, otherwise the vertex lands at the end of the path
+ * instead of its start.
+ */
+TEST(curve_deform, bounds_with_empty_chunks)
+{
+  const int verts_num = 100000;
+  const int weighted_vert = verts_num / 2;
+
+  CurveDeformTestContext ctx = {dna::shallow_zero_initialize()};
+  test_curve_deform_init(&ctx, 10);
+
+  float(*coords)[3] = static_cast<float(*)[3]>(
+      MEM_malloc_arrayN(verts_num, sizeof(float[3]), __func__));
+  MDeformVert *dvert = static_cast<MDeformVert *>(
+      MEM_calloc_arrayN(verts_num, sizeof(MDeformVert), __func__));
+  for (int i = 0; i < verts_num; i++) {
+    copy_v3_fl3(coords[i], 2.0f, 0.0f, 0.0f);
+  }
+  MDeformWeight dw = {0, 1.0f};
+  dvert[weighted_vert].dw = &dw;
+  dvert[weighted_vert].totweight = 1;
+
+  BKE_curve_deform_coords(&ctx.ob_curve, &ctx.ob_target, coords, verts_num, dvert, 0, 0, 0);
+
+  /* The bounds collapse onto the weighted vertex, which maps it to the start of the path. */
+  EXPECT_V3_NEAR(coords[weighted_vert], float3(0.0f, 0.0f, 0.0f), 1e-5f);
+  /* Unweighted vertices are left untouched. */
+  EXPECT_V3_NEAR(coords[0], float3(2.0f, 0.0f, 0.0f), 1e-5f);
+  EXPECT_V3_NEAR(coords[verts_num - 1], float3(2.0f, 0.0f, 0.0f), 1e-5f);
+
+  MEM_freeN(dvert);
+  MEM_freeN(coords);
+  test_curve_deform_free(&ctx);
+}
+
+}  // namespace blender::bke::tests
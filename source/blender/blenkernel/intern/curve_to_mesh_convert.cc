@@ -258,6 +258,31 @@ struct ResultOffsets {
   Array<int> main_indices;
   Array<int> profile_indices;
 };
+
+/**
+ * Turn the sizes stored in all but the last element into offsets, and store the total size in
+ * the last element.
+ */
+static void accumulate_offsets(MutableSpan<int> offsets)
+{
+  const IndexRange sizes_range = offsets.index_range().drop_back(1);
+  offsets.last() = threading::parallel_scan(
+      sizes_range,
+      4096,
+      0,
+      [&](const IndexRange range, int offset, const bool is_final_scan) {
+        for (const int i : range) {
+          const int size = offsets[i];
+          if (is_final_scan) {
+            offsets[i] = offset;
+          }
+          offset += size;
+        }
+        return offset;
+      },
+      std::plus<int>());
+}
+
 static ResultOffsets calculate_result_offsets(const CurvesInfo &info, const bool fill_caps)
 {
   ResultOffsets result;
@@ -273,24 +298,20 @@ static ResultOffsets calculate_result_offsets(const CurvesInfo &info, const bool
   info.main.ensure_evaluated_offsets();
   info.profile.ensure_evaluated_offsets();
 
-  int mesh_index = 0;
-  int vert_offset = 0;
-  int edge_offset = 0;
-  int loop_offset = 0;
-  int poly_offset = 0;
-  for (const int i_main : info.main.curves_range()) {
-    const bool main_cyclic = info.main_cyclic[i_main];
-    const int main_point_num = info.main.evaluated_points_for_curve(i_main).size();
-    const int main_segment_num = curves::curve_segment_size(main_point_num, main_cyclic);
-    for (const int i_profile : info.profile.curves_range()) {
-      result.vert[mesh_index] = vert_offset;
-      result.edge[mesh_index] = edge_offset;
-      result.loop[mesh_index] = loop_offset;
-      result.poly[mesh_index] = poly_offset;
+  const int profile_curves_num = info.profile.curves_num();
 
+  /* Compute the size of every combination in parallel first, the offsets are accumulated after. */
+  threading::parallel_for(IndexRange(result.total), 1024, [&](const IndexRange range) {
+    for (const int mesh_index : range) {
+      const int i_main = mesh_index / profile_curves_num;
+      const int i_profile = mesh_index % profile_curves_num;
       result.main_indices[mesh_index] = i_main;
       result.profile_indices[mesh_index] = i_profile;
 
+      const bool main_cyclic = info.main_cyclic[i_main];
+      const int main_point_num = info.main.evaluated_points_for_curve(i_main).size();
+      const int main_segment_num = curves::curve_segment_size(main_point_num, main_cyclic);
+
       const bool profile_cyclic = info.profile_cyclic[i_profile];
       const int profile_point_num = info.profile.evaluated_points_for_curve(i_profile).size();
       const int profile_segment_num = curves::curve_segment_size(profile_point_num,
@@ -299,27 +320,26 @@ static ResultOffsets calculate_result_offsets(const CurvesInfo &info, const bool
       const bool has_caps = fill_caps && !main_cyclic && profile_cyclic;
       const int tube_face_num = main_segment_num * profile_segment_num;
 
-      vert_offset += main_point_num * profile_point_num;
+      result.vert[mesh_index] = main_point_num * profile_point_num;
 
       /* Add the ring edges, with one ring for every curve vertex, and the edge loops
        * that run along the length of the curve, starting on the first profile. */
-      edge_offset += main_point_num * profile_segment_num + main_segment_num * profile_point_num;
+      result.edge[mesh_index] = main_point_num * profile_segment_num +
+                                main_segment_num * profile_point_num;
 
       /* Add two cap N-gons for every ending. */
-      poly_offset += tube_face_num + (has_caps ? 2 : 0);
+      result.poly[mesh_index] = tube_face_num + (has_caps ? 2 : 0);
 
       /* All faces on the tube are quads, and all cap faces are N-gons with an edge for each
        * profile edge. */
-      loop_offset += tube_face_num * 4 + (has_caps ? profile_segment_num * 2 : 0);
-
-      mesh_index++;
+      result.loop[mesh_index] = tube_face_num * 4 + (has_caps ? profile_segment_num * 2 : 0);
     }
-  }
+  });
 
-  result.vert.last() = vert_offset;
-  result.edge.last() = edge_offset;
-  result.loop.last() = loop_offset;
-  result.poly.last() = poly_offset;
+  threading::parallel_invoke([&]() { accumulate_offsets(result.vert); },
+                             [&]() { accumulate_offsets(result.edge); },
+                             [&]() { accumulate_offsets(result.loop); },
+                             [&]() { accumulate_offsets(result.poly); });
 
   return result;
 }
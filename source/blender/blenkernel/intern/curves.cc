@@ -81,7 +81,17 @@ static void curves_copy_data(Main *UNUSED(bmain), ID *id_dst, const ID *id_src,
   dst.point_size = src.point_size;
   dst.curve_size = src.curve_size;
 
-  const eCDAllocType alloc_type = (flag & LIB_ID_COPY_CD_REFERENCE) ? CD_REFERENCE : CD_DUPLICATE;
+  eCDAllocType alloc_type = CD_DUPLICATE;
+  if (flag & LIB_ID_COPY_CD_REFERENCE) {
+    alloc_type = CD_REFERENCE;
+  }
+  else if (curves_src->id.tag & LIB_TAG_NO_MAIN) {
+    /* Evaluated curves are only modified through the `*_for_write()` accessors and the attribute
+     * API, which duplicate shared layers first. Copies of them, like the ones made for geometry
+     * sets, can share the attribute arrays until they are modified. Original curves are still
+     * copied, since they are also edited directly through their layer pointers. */
+    alloc_type = CD_SHARE;
+  }
   CustomData_copy(&src.point_data, &dst.point_data, CD_MASK_ALL, alloc_type, dst.point_size);
   CustomData_copy(&src.curve_data, &dst.curve_data, CD_MASK_ALL, alloc_type, dst.curve_size);
 
@@ -10,8 +10,10 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_bounds.hh"
+#include "BLI_hash.hh"
 #include "BLI_index_mask_ops.hh"
 #include "BLI_length_parameterize.hh"
+#include "BLI_map.hh"
 #include "BLI_math_rotation.hh"
 
 #include "DNA_curves_types.h"
@@ -432,12 +434,28 @@ MutableSpan<float2> CurvesGeometry::surface_triangle_coords_for_write()
 
 template<typename SizeFn> void build_offsets(MutableSpan<int> offsets, const SizeFn &size_fn)
 {
-  int offset = 0;
-  for (const int i : offsets.drop_back(1).index_range()) {
-    offsets[i] = offset;
-    offset += size_fn(i);
-  }
-  offsets.last() = offset;
+  /* Compute the sizes in parallel first, so that the prefix sum only has to add integers. */
+  const IndexRange curves_range = offsets.index_range().drop_back(1);
+  threading::parallel_for(curves_range, 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      offsets[i] = size_fn(i);
+    }
+  });
+  offsets.last() = threading::parallel_scan(
+      curves_range,
+      4096,
+      0,
+      [&](const IndexRange range, int offset, const bool is_final_scan) {
+        for (const int i : range) {
+          const int size = offsets[i];
+          if (is_final_scan) {
+            offsets[i] = offset;
+          }
+          offset += size;
+        }
+        return offset;
+      },
+      std::plus<int>());
 }
 
 static void calculate_evaluated_offsets(const CurvesGeometry &curves,
@@ -534,6 +552,54 @@ IndexMask CurvesGeometry::indices_for_curve_type(const CurveType type,
       });
 }
 
+/** The parameters that determine the basis of a NURBS curve. */
+struct NURBSBasisKey {
+  int points_num;
+  int evaluated_num;
+  int8_t order;
+  bool cyclic;
+  int8_t knots_mode;
+
+  uint64_t hash() const
+  {
+    return get_default_hash_4(points_num, evaluated_num, order, (knots_mode << 1) | int(cyclic));
+  }
+
+  friend bool operator==(const NURBSBasisKey &a, const NURBSBasisKey &b)
+  {
+    return a.points_num == b.points_num && a.evaluated_num == b.evaluated_num &&
+           a.order == b.order && a.cyclic == b.cyclic && a.knots_mode == b.knots_mode;
+  }
+};
+
+static const curves::nurbs::BasisCache &nurbs_basis_cache_for_curve(
+    const CurvesGeometryRuntime &runtime, const int curve_index)
+{
+  return runtime.nurbs_basis_cache[runtime.nurbs_basis_cache_indices[curve_index]];
+}
+
+/**
+ * Call the function once for every curve type in the geometry, with the indices of all curves of
+ * that type. Processing the curves of each type together avoids switching on the type of every
+ * curve and allows each type to use its own grain size.
+ */
+static void foreach_curve_by_type(const CurvesGeometry &curves,
+                                  const FunctionRef<void(CurveType type, IndexMask selection)> fn)
+{
+  const std::array<int, CURVE_TYPES_NUM> type_counts = curves.count_curve_types();
+  for (const int type : IndexRange(CURVE_TYPES_NUM)) {
+    if (type_counts[type] == 0) {
+      continue;
+    }
+    if (type_counts[type] == curves.curves_num()) {
+      fn(CurveType(type), curves.curves_range());
+      continue;
+    }
+    Vector<int64_t> indices;
+    fn(CurveType(type), curves.indices_for_curve_type(CurveType(type), indices));
+  }
+}
+
 void CurvesGeometry::ensure_nurbs_basis_cache() const
 {
   if (!this->runtime->nurbs_basis_cache_dirty) {
@@ -553,15 +619,36 @@ void CurvesGeometry::ensure_nurbs_basis_cache() const
       return;
     }
 
-    this->runtime->nurbs_basis_cache.resize(this->curves_num());
-    MutableSpan<curves::nurbs::BasisCache> basis_caches(this->runtime->nurbs_basis_cache);
-
     VArray<bool> cyclic = this->cyclic();
     VArray<int8_t> orders = this->nurbs_orders();
     VArray<int8_t> knots_modes = this->nurbs_knots_modes();
 
-    threading::parallel_for(nurbs_mask.index_range(), 64, [&](const IndexRange range) {
-      for (const int curve_index : nurbs_mask.slice(range)) {
+    /* Curves with the same parameters have the same basis, so it only has to be calculated once
+     * for each unique combination. Custom knots are not supported, so the knots are only
+     * determined by these parameters as well. */
+    this->runtime->nurbs_basis_cache_indices.resize(this->curves_num());
+    MutableSpan<int> cache_indices = this->runtime->nurbs_basis_cache_indices;
+    Map<NURBSBasisKey, int> cache_index_by_key;
+    Vector<int> unique_curves;
+    for (const int curve_index : nurbs_mask) {
+      const NURBSBasisKey key{int(this->points_for_curve(curve_index).size()),
+                              int(this->evaluated_points_for_curve(curve_index).size()),
+                              orders[curve_index],
+                              cyclic[curve_index],
+                              knots_modes[curve_index]};
+      cache_indices[curve_index] = cache_index_by_key.lookup_or_add_cb(key, [&]() {
+        unique_curves.append(curve_index);
+        return int(unique_curves.size() - 1);
+      });
+    }
+
+    this->runtime->nurbs_basis_cache.clear();
+    this->runtime->nurbs_basis_cache.resize(unique_curves.size());
+    MutableSpan<curves::nurbs::BasisCache> basis_caches(this->runtime->nurbs_basis_cache);
+
+    threading::parallel_for(unique_curves.index_range(), 64, [&](const IndexRange range) {
+      for (const int cache_index : range) {
+        const int curve_index = unique_curves[cache_index];
         const IndexRange points = this->points_for_curve(curve_index);
         const IndexRange evaluated_points = this->evaluated_points_for_curve(curve_index);
 
@@ -577,7 +664,7 @@ void CurvesGeometry::ensure_nurbs_basis_cache() const
                                              order,
                                              is_cyclic,
                                              knots,
-                                             basis_caches[curve_index]);
+                                             basis_caches[cache_index]);
       }
     });
   });
@@ -608,7 +695,6 @@ Span<float3> CurvesGeometry::evaluated_positions() const
     MutableSpan<float3> evaluated_positions = this->runtime->evaluated_position_cache;
     this->runtime->evaluated_positions_span = evaluated_positions;
 
-    VArray<int8_t> types = this->curve_types();
     VArray<bool> cyclic = this->cyclic();
     VArray<int> resolution = this->resolution();
     Span<float3> positions = this->positions();
@@ -622,42 +708,58 @@ Span<float3> CurvesGeometry::evaluated_positions() const
 
     this->ensure_nurbs_basis_cache();
 
-    threading::parallel_for(this->curves_range(), 128, [&](IndexRange curves_range) {
-      for (const int curve_index : curves_range) {
-        const IndexRange points = this->points_for_curve(curve_index);
-        const IndexRange evaluated_points = this->evaluated_points_for_curve(curve_index);
-
-        switch (types[curve_index]) {
-          case CURVE_TYPE_CATMULL_ROM:
-            curves::catmull_rom::interpolate_to_evaluated(
-                positions.slice(points),
-                cyclic[curve_index],
-                resolution[curve_index],
-                evaluated_positions.slice(evaluated_points));
-            break;
-          case CURVE_TYPE_POLY:
-            evaluated_positions.slice(evaluated_points).copy_from(positions.slice(points));
-            break;
-          case CURVE_TYPE_BEZIER:
-            curves::bezier::calculate_evaluated_positions(
-                positions.slice(points),
-                handle_positions_left.slice(points),
-                handle_positions_right.slice(points),
-                bezier_evaluated_offsets.slice(points),
-                evaluated_positions.slice(evaluated_points));
-            break;
-          case CURVE_TYPE_NURBS: {
-            curves::nurbs::interpolate_to_evaluated(this->runtime->nurbs_basis_cache[curve_index],
-                                                    nurbs_orders[curve_index],
-                                                    nurbs_weights.slice(points),
-                                                    positions.slice(points),
-                                                    evaluated_positions.slice(evaluated_points));
-            break;
-          }
-          default:
-            BLI_assert_unreachable();
-            break;
-        }
+    foreach_curve_by_type(*this, [&](const CurveType type, const IndexMask selection) {
+      switch (type) {
+        case CURVE_TYPE_CATMULL_ROM:
+          threading::parallel_for(selection.index_range(), 128, [&](IndexRange range) {
+            for (const int curve_index : selection.slice(range)) {
+              const IndexRange points = this->points_for_curve(curve_index);
+              const IndexRange evaluated_points = this->evaluated_points_for_curve(curve_index);
+              curves::catmull_rom::interpolate_to_evaluated(
+                  positions.slice(points),
+                  cyclic[curve_index],
+                  resolution[curve_index],
+                  evaluated_positions.slice(evaluated_points));
+            }
+          });
+          break;
+        case CURVE_TYPE_POLY:
+          threading::parallel_for(selection.index_range(), 1024, [&](IndexRange range) {
+            for (const int curve_index : selection.slice(range)) {
+              const IndexRange points = this->points_for_curve(curve_index);
+              const IndexRange evaluated_points = this->evaluated_points_for_curve(curve_index);
+              evaluated_positions.slice(evaluated_points).copy_from(positions.slice(points));
+            }
+          });
+          break;
+        case CURVE_TYPE_BEZIER:
+          threading::parallel_for(selection.index_range(), 128, [&](IndexRange range) {
+            for (const int curve_index : selection.slice(range)) {
+              const IndexRange points = this->points_for_curve(curve_index);
+              const IndexRange evaluated_points = this->evaluated_points_for_curve(curve_index);
+              curves::bezier::calculate_evaluated_positions(
+                  positions.slice(points),
+                  handle_positions_left.slice(points),
+                  handle_positions_right.slice(points),
+                  bezier_evaluated_offsets.slice(points),
+                  evaluated_positions.slice(evaluated_points));
+            }
+          });
+          break;
+        case CURVE_TYPE_NURBS:
+          threading::parallel_for(selection.index_range(), 128, [&](IndexRange range) {
+            for (const int curve_index : selection.slice(range)) {
+              const IndexRange points = this->points_for_curve(curve_index);
+              const IndexRange evaluated_points = this->evaluated_points_for_curve(curve_index);
+              curves::nurbs::interpolate_to_evaluated(
+                  nurbs_basis_cache_for_curve(*this->runtime, curve_index),
+                  nurbs_orders[curve_index],
+                  nurbs_weights.slice(points),
+                  positions.slice(points),
+                  evaluated_positions.slice(evaluated_points));
+            }
+          });
+          break;
       }
     });
   });
@@ -830,11 +932,12 @@ void CurvesGeometry::interpolate_to_evaluated(const int curve_index,
           src, this->runtime->bezier_evaluated_offsets.as_span().slice(points), dst);
       return;
     case CURVE_TYPE_NURBS:
-      curves::nurbs::interpolate_to_evaluated(this->runtime->nurbs_basis_cache[curve_index],
-                                              this->nurbs_orders()[curve_index],
-                                              this->nurbs_weights().slice(points),
-                                              src,
-                                              dst);
+      curves::nurbs::interpolate_to_evaluated(
+          nurbs_basis_cache_for_curve(*this->runtime, curve_index),
+          this->nurbs_orders()[curve_index],
+          this->nurbs_weights().slice(points),
+          src,
+          dst);
       return;
   }
   BLI_assert_unreachable();
@@ -844,41 +947,43 @@ void CurvesGeometry::interpolate_to_evaluated(const GSpan src, GMutableSpan dst)
 {
   BLI_assert(!this->runtime->offsets_cache_dirty);
   BLI_assert(!this->runtime->nurbs_basis_cache_dirty);
-  const VArray<int8_t> types = this->curve_types();
   const VArray<int> resolution = this->resolution();
   const VArray<bool> cyclic = this->cyclic();
   const VArray<int8_t> nurbs_orders = this->nurbs_orders();
   const Span<float> nurbs_weights = this->nurbs_weights();
 
-  threading::parallel_for(this->curves_range(), 512, [&](IndexRange curves_range) {
-    for (const int curve_index : curves_range) {
-      const IndexRange points = this->points_for_curve(curve_index);
-      const IndexRange evaluated_points = this->evaluated_points_for_curve(curve_index);
-      switch (types[curve_index]) {
-        case CURVE_TYPE_CATMULL_ROM:
-          curves::catmull_rom::interpolate_to_evaluated(src.slice(points),
-                                                        cyclic[curve_index],
-                                                        resolution[curve_index],
-                                                        dst.slice(evaluated_points));
-          continue;
-        case CURVE_TYPE_POLY:
-          dst.slice(evaluated_points).copy_from(src.slice(points));
-          continue;
-        case CURVE_TYPE_BEZIER:
-          curves::bezier::interpolate_to_evaluated(
-              src.slice(points),
-              this->runtime->bezier_evaluated_offsets.as_span().slice(points),
-              dst.slice(evaluated_points));
-          continue;
-        case CURVE_TYPE_NURBS:
-          curves::nurbs::interpolate_to_evaluated(this->runtime->nurbs_basis_cache[curve_index],
-                                                  nurbs_orders[curve_index],
-                                                  nurbs_weights.slice(points),
-                                                  src.slice(points),
-                                                  dst.slice(evaluated_points));
-          continue;
+  foreach_curve_by_type(*this, [&](const CurveType type, const IndexMask selection) {
+    threading::parallel_for(selection.index_range(), 512, [&](IndexRange range) {
+      for (const int curve_index : selection.slice(range)) {
+        const IndexRange points = this->points_for_curve(curve_index);
+        const IndexRange evaluated_points = this->evaluated_points_for_curve(curve_index);
+        switch (type) {
+          case CURVE_TYPE_CATMULL_ROM:
+            curves::catmull_rom::interpolate_to_evaluated(src.slice(points),
+                                                          cyclic[curve_index],
+                                                          resolution[curve_index],
+                                                          dst.slice(evaluated_points));
+            continue;
+          case CURVE_TYPE_POLY:
+            dst.slice(evaluated_points).copy_from(src.slice(points));
+            continue;
+          case CURVE_TYPE_BEZIER:
+            curves::bezier::interpolate_to_evaluated(
+                src.slice(points),
+                this->runtime->bezier_evaluated_offsets.as_span().slice(points),
+                dst.slice(evaluated_points));
+            continue;
+          case CURVE_TYPE_NURBS:
+            curves::nurbs::interpolate_to_evaluated(
+                nurbs_basis_cache_for_curve(*this->runtime, curve_index),
+                nurbs_orders[curve_index],
+                nurbs_weights.slice(points),
+                src.slice(points),
+                dst.slice(evaluated_points));
+            continue;
+        }
       }
-    }
+    });
   });
 }
 
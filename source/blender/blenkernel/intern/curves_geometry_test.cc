@@ -404,6 +404,43 @@ TEST(curves_geometry, NURBSEvaluation)
   }
 }
 
+TEST(curves_geometry, NURBSSharedBasisEvaluation)
+{
+  /* Two NURBS curves with the same parameters share a basis cache, separated by a poly curve with
+   * a different number of points, so that curves of every type are evaluated together. */
+  CurvesGeometry curves(10, 3);
+  curves.offsets_for_write().copy_from({0, 4, 6, 10});
+  curves.curve_types_for_write().copy_from({CURVE_TYPE_NURBS, CURVE_TYPE_POLY, CURVE_TYPE_NURBS});
+  curves.resolution_for_write().fill(10);
+
+  MutableSpan<float3> positions = curves.positions_for_write();
+  const Array<float3> nurbs_positions{{1, 1, 0}, {0, 1, 0}, {0, 0, 0}, {-1, 0, 0}};
+  const float3 offset{0.0f, 0.0f, 2.0f};
+  for (const int i : nurbs_positions.index_range()) {
+    positions[i] = nurbs_positions[i];
+    positions[6 + i] = nurbs_positions[i] + offset;
+  }
+  positions[4] = {0, 0, 5};
+  positions[5] = {1, 0, 5};
+
+  const Span<float3> evaluated_positions = curves.evaluated_positions();
+  const IndexRange first_points = curves.evaluated_points_for_curve(0);
+  const IndexRange poly_points = curves.evaluated_points_for_curve(1);
+  const IndexRange last_points = curves.evaluated_points_for_curve(2);
+  EXPECT_EQ(first_points.size(), 30);
+  EXPECT_EQ(last_points.size(), 30);
+  EXPECT_EQ(poly_points.size(), 2);
+
+  EXPECT_V3_NEAR(evaluated_positions[first_points.first()], float3(0.166667, 0.833333, 0), 1e-5f);
+  EXPECT_V3_NEAR(evaluated_positions[first_points.last()], float3(-0.166667, 0.166667, 0), 1e-5f);
+  for (const int i : IndexRange(first_points.size())) {
+    const float3 expected = evaluated_positions[first_points[i]] + offset;
+    EXPECT_V3_NEAR(evaluated_positions[last_points[i]], expected, 1e-5f);
+  }
+  EXPECT_V3_NEAR(evaluated_positions[poly_points[0]], float3(0, 0, 5), 1e-5f);
+  EXPECT_V3_NEAR(evaluated_positions[poly_points[1]], float3(1, 0, 5), 1e-5f);
+}
+
 TEST(curves_geometry, BezierGenericEvaluation)
 {
   CurvesGeometry curves(3, 1);
@@ -20,6 +20,7 @@
 #include "BLI_bitmap.h"
 #include "BLI_color.hh"
 #include "BLI_endian_switch.h"
+#include "BLI_implicit_sharing.hh"
 #include "BLI_math.h"
 #include "BLI_math_color_blend.h"
 #include "BLI_math_vector.hh"
@@ -47,6 +48,8 @@
 
 #include "BLO_read_write.h"
 
+#include "atomic_ops.h"
+
 #include "bmesh.h"
 
 #include "CLG_log.h"
@@ -2207,6 +2210,95 @@ static bool customdata_typemap_is_valid(const CustomData *data)
 }
 #endif
 
+/* -------------------------------------------------------------------- */
+/** \name Implicitly Shared Layers
+ * \{ */
+
+static void customData_free_layer_data(const int type, void *data, const int totelem)
+{
+  const LayerTypeInfo *typeInfo = layerType_getInfo(type);
+  if (typeInfo->free) {
+    typeInfo->free(data, totelem, typeInfo->size);
+  }
+  MEM_freeN(data);
+}
+
+/** Owns layer data which is used by multiple layers, see #CD_SHARE. */
+struct CustomDataLayerSharing : public blender::ImplicitSharingInfo {
+  void *data;
+  int type;
+  int totelem;
+
+  CustomDataLayerSharing(void *data, const int type, const int totelem)
+      : data(data), type(type), totelem(totelem)
+  {
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    customData_free_layer_data(type, data, totelem);
+    MEM_delete(this);
+  }
+};
+
+static bool customData_layer_can_share(const CustomDataLayer *layer)
+{
+  if (layer->data == nullptr) {
+    return false;
+  }
+  /* Data of referenced layers is owned by someone else, so its lifetime is unknown. */
+  return (layer->flag & CD_FLAG_NOFREE) == 0 || layer->sharing_info != nullptr;
+}
+
+/**
+ * Make the data of the layer shareable. The layer is part of a const custom data, which
+ * can be shared from multiple threads at the same time.
+ */
+static const CustomDataLayerSharing *customData_layer_ensure_sharing(CustomDataLayer *layer,
+                                                                     const int totelem)
+{
+  if (layer->sharing_info != nullptr) {
+    return layer->sharing_info;
+  }
+  CustomDataLayerSharing *sharing_info = MEM_new<CustomDataLayerSharing>(
+      __func__, layer->data, layer->type, totelem);
+  if (atomic_cas_ptr((void **)&layer->sharing_info, nullptr, sharing_info) != nullptr) {
+    /* Another thread made the layer shareable first, the data is not owned by this info. */
+    MEM_delete(sharing_info);
+    return layer->sharing_info;
+  }
+  atomic_fetch_and_or_int32(&layer->flag, CD_FLAG_NOFREE);
+  return sharing_info;
+}
+
+/** Make sure the layer owns its data, copying it when it is still used by other layers. */
+static void customData_layer_unshare(CustomDataLayer *layer)
+{
+  const CustomDataLayerSharing *sharing_info = layer->sharing_info;
+  if (sharing_info->is_mutable()) {
+    /* This is the last user, take over the ownership of the data. */
+    MEM_delete(sharing_info);
+  }
+  else {
+    const LayerTypeInfo *typeInfo = layerType_getInfo(layer->type);
+    if (typeInfo->copy) {
+      void *dst_data = MEM_malloc_arrayN(
+          (size_t)sharing_info->totelem, typeInfo->size, "CD unshare layer");
+      typeInfo->copy(layer->data, dst_data, sharing_info->totelem);
+      layer->data = dst_data;
+    }
+    else {
+      layer->data = MEM_dupallocN(layer->data);
+    }
+    sharing_info->remove_user_and_delete_if_last();
+  }
+  layer->sharing_info = nullptr;
+  layer->flag &= ~CD_FLAG_NOFREE;
+}
+
+/** \} */
+
 bool CustomData_merge(const struct CustomData *source,
                       struct CustomData *dest,
                       CustomDataMask mask,
@@ -2264,9 +2356,31 @@ bool CustomData_merge(const struct CustomData *source,
         break;
     }
 
-    if ((alloctype == CD_ASSIGN) && (flag & CD_FLAG_NOFREE)) {
+    if (alloctype == CD_SHARE) {
+      if (customData_layer_can_share(layer)) {
+        const CustomDataLayerSharing *sharing_info = customData_layer_ensure_sharing(layer,
+                                                                                     totelem);
+        newlayer = customData_add_layer__internal(
+            dest, type, CD_REFERENCE, layer->data, totelem, layer->name);
+        if (newlayer && newlayer->data == layer->data && newlayer->sharing_info == nullptr) {
+          sharing_info->add_user();
+          newlayer->sharing_info = sharing_info;
+        }
+      }
+      else {
+        newlayer = customData_add_layer__internal(
+            dest, type, CD_DUPLICATE, layer->data, totelem, layer->name);
+      }
+    }
+    else if ((alloctype == CD_ASSIGN) && (flag & CD_FLAG_NOFREE)) {
       newlayer = customData_add_layer__internal(
           dest, type, CD_REFERENCE, data, totelem, layer->name);
+      if (newlayer) {
+        /* The user of shared data is moved to the new layer together with the data. The source
+         * layer doesn't own it anymore, otherwise freeing both layers would remove it twice. */
+        newlayer->sharing_info = layer->sharing_info;
+        layer->sharing_info = nullptr;
+      }
     }
     else {
       newlayer = customData_add_layer__internal(dest, type, alloctype, data, totelem, layer->name);
@@ -2299,6 +2413,10 @@ void CustomData_realloc(CustomData *data, int totelem)
   for (int i = 0; i < data->totlayer; i++) {
     CustomDataLayer *layer = &data->layers[i];
     const LayerTypeInfo *typeInfo;
+    if (layer->sharing_info != nullptr) {
+      /* Shared data can't be resized in place. */
+      customData_layer_unshare(layer);
+    }
     if (layer->flag & CD_FLAG_NOFREE) {
       continue;
     }
@@ -2332,6 +2450,11 @@ static void customData_free_layer__internal(CustomDataLayer *layer, int totelem)
     BKE_anonymous_attribute_id_decrement_weak(layer->anonymous_id);
     layer->anonymous_id = nullptr;
   }
+  if (layer->sharing_info != nullptr) {
+    layer->sharing_info->remove_user_and_delete_if_last();
+    layer->sharing_info = nullptr;
+    return;
+  }
   if (!(layer->flag & CD_FLAG_NOFREE) && layer->data) {
     typeInfo = layerType_getInfo(layer->type);
 
@@ -2933,7 +3056,10 @@ static void *customData_duplicate_referenced_layer_index(CustomData *data,
 
   CustomDataLayer *layer = &data->layers[layer_index];
 
-  if (layer->flag & CD_FLAG_NOFREE) {
+  if (layer->sharing_info != nullptr) {
+    customData_layer_unshare(layer);
+  }
+  else if (layer->flag & CD_FLAG_NOFREE) {
     /* MEM_dupallocN won't work in case of complex layers, like e.g.
      * CD_MDEFORMVERT, which has pointers to allocated data...
      * So in case a custom copy function is defined, use it!
@@ -5313,6 +5439,7 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, int count)
     }
 
     layer->flag &= ~CD_FLAG_NOFREE;
+    layer->sharing_info = nullptr;
 
     if (CustomData_verify_versions(data, i)) {
       BLO_read_data_address(reader, &layer->data);
@@ -13,6 +13,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -747,6 +748,86 @@ void BKE_gpencil_prepare_eval_data(Depsgraph *depsgraph, Scene *scene, Object *o
   gpencil_copy_visible_frames_to_eval(depsgraph, scene, ob);
 }
 
+typedef struct GpencilDeformStrokeItem {
+  bGPDlayer *gpl;
+  bGPDframe *gpf;
+  bGPDstroke *gps;
+} GpencilDeformStrokeItem;
+
+typedef struct GpencilDeformStrokeData {
+  GpencilModifierData *md;
+  const GpencilModifierTypeInfo *mti;
+  Depsgraph *depsgraph;
+  Object *ob;
+  const GpencilDeformStrokeItem *items;
+} GpencilDeformStrokeData;
+
+static void gpencil_deform_stroke_task(void *__restrict userdata,
+                                       const int i,
+                                       const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const GpencilDeformStrokeData *data = userdata;
+  const GpencilDeformStrokeItem *item = &data->items[i];
+  data->mti->deformStroke(data->md, data->depsgraph, data->ob, item->gpl, item->gpf, item->gps);
+}
+
+/**
+ * Deform the strokes of all retimed frames in parallel, for modifiers that only change the
+ * stroke they are given.
+ */
+static void gpencil_deform_strokes_threaded(GpencilModifierData *md,
+                                            const GpencilModifierTypeInfo *mti,
+                                            Depsgraph *depsgraph,
+                                            Scene *scene,
+                                            Object *ob)
+{
+  bGPdata *gpd = (bGPdata *)ob->data;
+  const int layers_len = BLI_listbase_count(&gpd->layers);
+  if (layers_len == 0) {
+    return;
+  }
+
+  int items_len = 0;
+  bGPDframe **frames = MEM_malloc_arrayN(layers_len, sizeof(*frames), __func__);
+  int layer_index = 0;
+  LISTBASE_FOREACH_INDEX (bGPDlayer *, gpl, &gpd->layers, layer_index) {
+    bGPDframe *gpf = BKE_gpencil_frame_retime_get(depsgraph, scene, ob, gpl);
+    frames[layer_index] = gpf;
+    if (gpf != NULL) {
+      items_len += BLI_listbase_count(&gpf->strokes);
+    }
+  }
+
+  if (items_len > 0) {
+    GpencilDeformStrokeItem *items = MEM_malloc_arrayN(items_len, sizeof(*items), __func__);
+    int item_index = 0;
+    LISTBASE_FOREACH_INDEX (bGPDlayer *, gpl, &gpd->layers, layer_index) {
+      bGPDframe *gpf = frames[layer_index];
+      if (gpf == NULL) {
+        continue;
+      }
+      LISTBASE_FOREACH (bGPDstroke *, gps, &gpf->strokes) {
+        items[item_index++] = (GpencilDeformStrokeItem){gpl, gpf, gps};
+      }
+    }
+
+    GpencilDeformStrokeData data = {
+        .md = md,
+        .mti = mti,
+        .depsgraph = depsgraph,
+        .ob = ob,
+        .items = items,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 16;
+    BLI_task_parallel_range(0, items_len, &data, gpencil_deform_stroke_task, &settings);
+
+    MEM_freeN(items);
+  }
+  MEM_freeN(frames);
+}
+
 void BKE_gpencil_modifiers_calc(Depsgraph *depsgraph, Scene *scene, Object *ob)
 {
   bGPdata *gpd = (bGPdata *)ob->data;
@@ -788,7 +869,11 @@ void BKE_gpencil_modifiers_calc(Depsgraph *depsgraph, Scene *scene, Object *ob)
       }
 
       /* Apply deform modifiers and Time remap (only change geometry). */
-      if ((time_remap) || (mti && mti->deformStroke)) {
+      if (mti && mti->deformStroke &&
+          (mti->flags & eGpencilModifierTypeFlag_SupportsThreadedDeform)) {
+        gpencil_deform_strokes_threaded(md, mti, depsgraph, scene, ob);
+      }
+      else if ((time_remap) || (mti && mti->deformStroke)) {
         LISTBASE_FOREACH (bGPDlayer *, gpl, &gpd->layers) {
           bGPDframe *gpf = BKE_gpencil_frame_retime_get(depsgraph, scene, ob, gpl);
           if (gpf == NULL) {
@@ -671,7 +671,7 @@ static void image_render_print_save_message(ReportList *reports, const char *nam
 }
 
 static int image_render_write_stamp_test(ReportList *reports,
-                                         const Scene *scene,
+                                         const RenderData *rd,
                                          const RenderResult *rr,
                                          ImBuf *ibuf,
                                          const char *name,
@@ -680,13 +680,11 @@ static int image_render_write_stamp_test(ReportList *reports,
 {
   int ok;
 
-  if (stamp) {
+  if (stamp && (rd->stamp & R_STAMP_ALL)) {
     /* writes the name of the individual cameras */
-    ok = BKE_imbuf_write_stamp(scene, rr, ibuf, name, imf);
-  }
-  else {
-    ok = BKE_imbuf_write(ibuf, name, imf);
+    BKE_imbuf_stamp_info(rr, ibuf);
   }
+  ok = BKE_imbuf_write(ibuf, name, imf);
 
   image_render_print_save_message(reports, name, ok, errno);
 
@@ -699,8 +697,6 @@ bool BKE_image_render_write(ReportList *reports,
                             const bool stamp,
                             const char *filepath_basis)
 {
-  bool ok = true;
-
   if (!rr) {
     return false;
   }
@@ -708,11 +704,35 @@ bool BKE_image_render_write(ReportList *reports,
   ImageFormatData image_format;
   BKE_image_format_init_for_write(&image_format, scene, nullptr);
 
+  const bool ok = BKE_image_render_write_ex(
+      reports, rr, &scene->r, &image_format, stamp, filepath_basis);
+
+  BKE_image_format_free(&image_format);
+
+  return ok;
+}
+
+bool BKE_image_render_write_ex(ReportList *reports,
+                               RenderResult *rr,
+                               const RenderData *rd,
+                               const ImageFormatData *imf,
+                               const bool stamp,
+                               const char *filepath_basis)
+{
+  bool ok = true;
+
+  if (!rr) {
+    return false;
+  }
+
+  /* The image type is changed for preview images, color management settings are shared. */
+  ImageFormatData image_format = *imf;
+
   const bool is_mono = BLI_listbase_count_at_most(&rr->views, 2) < 2;
   const bool is_exr_rr = ELEM(
                              image_format.imtype, R_IMF_IMTYPE_OPENEXR, R_IMF_IMTYPE_MULTILAYER) &&
                          RE_HasFloatPixels(rr);
-  const float dither = scene->r.dither_intensity;
+  const float dither = rd->dither_intensity;
 
   if (image_format.views_format == R_IMF_VIEWS_MULTIVIEW && is_exr_rr) {
     ok = BKE_image_render_write_exr(reports, rr, filepath_basis, &image_format, true, nullptr, -1);
@@ -729,7 +749,7 @@ bool BKE_image_render_write(ReportList *reports,
         STRNCPY(filepath, filepath_basis);
       }
       else {
-        BKE_scene_multiview_view_filepath_get(&scene->r, filepath_basis, rv->name, filepath);
+        BKE_scene_multiview_view_filepath_get(rd, filepath_basis, rv->name, filepath);
       }
 
       if (is_exr_rr) {
@@ -750,7 +770,7 @@ bool BKE_image_render_write(ReportList *reports,
           IMB_colormanagement_imbuf_for_write(ibuf, true, false, &image_format);
 
           ok = image_render_write_stamp_test(
-              reports, scene, rr, ibuf, filepath, &image_format, stamp);
+              reports, rd, rr, ibuf, filepath, &image_format, stamp);
 
           IMB_freeImBuf(ibuf);
         }
@@ -761,7 +781,7 @@ bool BKE_image_render_write(ReportList *reports,
         IMB_colormanagement_imbuf_for_write(ibuf, true, false, &image_format);
 
         ok = image_render_write_stamp_test(
-            reports, scene, rr, ibuf, filepath, &image_format, stamp);
+            reports, rd, rr, ibuf, filepath, &image_format, stamp);
 
         /* imbuf knows which rects are not part of ibuf */
         IMB_freeImBuf(ibuf);
@@ -792,7 +812,7 @@ bool BKE_image_render_write(ReportList *reports,
       ibuf_arr[2] = IMB_stereo3d_ImBuf(&image_format, ibuf_arr[0], ibuf_arr[1]);
 
       ok = image_render_write_stamp_test(
-          reports, scene, rr, ibuf_arr[2], filepath, &image_format, stamp);
+          reports, rd, rr, ibuf_arr[2], filepath, &image_format, stamp);
 
       /* optional preview images for exr */
       if (ok && is_exr_rr && (image_format.flag & R_IMF_FLAG_PREVIEW_JPG)) {
@@ -806,7 +826,7 @@ bool BKE_image_render_write(ReportList *reports,
         ibuf_arr[2]->planes = 24;
 
         ok = image_render_write_stamp_test(
-            reports, scene, rr, ibuf_arr[2], filepath, &image_format, stamp);
+            reports, rd, rr, ibuf_arr[2], filepath, &image_format, stamp);
       }
 
       /* imbuf knows which rects are not part of ibuf */
@@ -816,7 +836,5 @@ bool BKE_image_render_write(ReportList *reports,
     }
   }
 
-  BKE_image_format_free(&image_format);
-
   return ok;
 }
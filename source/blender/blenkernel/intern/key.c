@@ -15,6 +15,7 @@
 #include "BLI_endian_switch.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -856,6 +857,110 @@ static void cp_cu_key(Curve *cu,
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Relative Keys of Coordinates
+ *
+ * Fast path of #key_evaluate_relative for mesh and lattice keys, which only store coordinates.
+ * Elements are processed in chunks in parallel, applying all keys to a chunk while it is in the
+ * cache. The keys are still applied in order for every element, so the result doesn't change.
+ * \{ */
+
+#define KEY_RELATIVE_COORDS_CHUNK_SIZE 1024
+
+typedef struct KeyRelativeCoordsBlock {
+  const float (*ref)[3];
+  const float (*from)[3];
+  /** Optional per-element weights. */
+  const float *weights;
+  float value;
+} KeyRelativeCoordsBlock;
+
+typedef struct KeyRelativeCoordsData {
+  float (*coords)[3];
+  int coords_len;
+  const KeyRelativeCoordsBlock *blocks;
+  int blocks_len;
+} KeyRelativeCoordsData;
+
+static void key_evaluate_relative_coords_fn(void *__restrict userdata,
+                                            const int chunk_index,
+                                            const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const KeyRelativeCoordsData *data = userdata;
+  const int start = chunk_index * KEY_RELATIVE_COORDS_CHUNK_SIZE;
+  const int end = min_ii(start + KEY_RELATIVE_COORDS_CHUNK_SIZE, data->coords_len);
+
+  for (int i = 0; i < data->blocks_len; i++) {
+    const KeyRelativeCoordsBlock *block = &data->blocks[i];
+    for (int a = start; a < end; a++) {
+      const float weight = block->weights ? (block->weights[a] * block->value) : block->value;
+      rel_flerp(KEYELEM_FLOAT_LEN_COORD, data->coords[a], block->ref[a], block->from[a], weight);
+    }
+  }
+}
+
+static void key_evaluate_relative_coords(const int tot,
+                                         float (*coords)[3],
+                                         Key *key,
+                                         KeyBlock *actkb,
+                                         float **per_keyblock_weights)
+{
+  const int blocks_max = BLI_listbase_count(&key->block);
+  KeyRelativeCoordsBlock *blocks = MEM_malloc_arrayN(blocks_max, sizeof(*blocks), __func__);
+  char **freefrom = MEM_calloc_arrayN(blocks_max, sizeof(*freefrom), __func__);
+  int blocks_len = 0;
+
+  KeyBlock *kb;
+  int keyblock_index;
+  for (kb = key->block.first, keyblock_index = 0; kb; kb = kb->next, keyblock_index++) {
+    if (kb == key->refkey) {
+      continue;
+    }
+    /* Only with value, and no difference allowed. */
+    if ((kb->flag & KEYBLOCK_MUTE) || kb->curval == 0.0f || kb->totelem != tot) {
+      continue;
+    }
+    /* Reference now can be any block. */
+    const KeyBlock *refb = BLI_findlink(&key->block, kb->relative);
+    if (refb == NULL) {
+      continue;
+    }
+
+    KeyRelativeCoordsBlock *block = &blocks[blocks_len];
+    block->from = (const float(*)[3])key_block_get_data(key, actkb, kb, &freefrom[blocks_len]);
+    /* For meshes, use the original values instead of the bmesh values to
+     * maintain a constant offset. */
+    block->ref = (const float(*)[3])refb->data;
+    block->weights = per_keyblock_weights ? per_keyblock_weights[keyblock_index] : NULL;
+    block->value = kb->curval;
+    blocks_len++;
+  }
+
+  if (blocks_len != 0) {
+    KeyRelativeCoordsData data = {
+        .coords = coords,
+        .coords_len = tot,
+        .blocks = blocks,
+        .blocks_len = blocks_len,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    BLI_task_parallel_range(0,
+                            divide_ceil_u(tot, KEY_RELATIVE_COORDS_CHUNK_SIZE),
+                            &data,
+                            key_evaluate_relative_coords_fn,
+                            &settings);
+  }
+
+  for (int i = 0; i < blocks_len; i++) {
+    MEM_SAFE_FREE(freefrom[i]);
+  }
+  MEM_freeN(freefrom);
+  MEM_freeN(blocks);
+}
+
+/** \} */
+
 static void key_evaluate_relative(const int start,
                                   int end,
                                   const int tot,
@@ -894,6 +999,11 @@ static void key_evaluate_relative(const int start,
 
   /* step 2: do it */
 
+  if (start == 0 && end == tot && ELEM(GS(key->from->name), ID_ME, ID_LT)) {
+    key_evaluate_relative_coords(tot, (float(*)[3])basispoin, key, actkb, per_keyblock_weights);
+    return;
+  }
+
   for (kb = key->block.first, keyblock_index = 0; kb; kb = kb->next, keyblock_index++) {
     if (kb != key->refkey) {
       float icuval = kb->curval;
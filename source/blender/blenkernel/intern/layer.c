@@ -62,6 +62,7 @@ static const short g_base_collection_flags = (BASE_VISIBLE_DEPSGRAPH | BASE_VISI
 
 /* prototype */
 static void object_bases_iterator_next(BLI_Iterator *iter, const int flag);
+static void scene_layer_collection_local_sync(const Main *bmain, const Scene *scene);
 
 /* -------------------------------------------------------------------- */
 /** \name Layer Collections and Bases
@@ -1361,6 +1362,30 @@ void BKE_main_collection_sync(const Main *bmain)
   BKE_layer_collection_local_sync_all(bmain);
 }
 
+static bool scene_uses_collection(const Scene *scene, const Collection *collection)
+{
+  if (scene->master_collection == NULL) {
+    return false;
+  }
+  return (scene->master_collection == collection) ||
+         BKE_collection_has_collection(scene->master_collection, collection);
+}
+
+void BKE_main_collection_sync_for_collection(const Main *bmain, const Collection *collection)
+{
+  if (no_resync) {
+    return;
+  }
+
+  /* Other scenes do not reference the collection, so their bases can not change. */
+  LISTBASE_FOREACH (Scene *, scene, &bmain->scenes) {
+    if (scene_uses_collection(scene, collection)) {
+      BKE_scene_collection_sync(scene);
+      scene_layer_collection_local_sync(bmain, scene);
+    }
+  }
+}
+
 void BKE_main_collection_sync_remap(const Main *bmain)
 {
   if (no_resync) {
@@ -1692,6 +1717,23 @@ void BKE_layer_collection_local_sync(ViewLayer *view_layer, const View3D *v3d)
   }
 }
 
+static void scene_layer_collection_local_sync(const Main *bmain, const Scene *scene)
+{
+  LISTBASE_FOREACH (ViewLayer *, view_layer, &scene->view_layers) {
+    LISTBASE_FOREACH (bScreen *, screen, &bmain->screens) {
+      LISTBASE_FOREACH (ScrArea *, area, &screen->areabase) {
+        if (area->spacetype != SPACE_VIEW3D) {
+          continue;
+        }
+        View3D *v3d = area->spacedata.first;
+        if (v3d->flag & V3D_LOCAL_COLLECTIONS) {
+          BKE_layer_collection_local_sync(view_layer, v3d);
+        }
+      }
+    }
+  }
+}
+
 void BKE_layer_collection_local_sync_all(const Main *bmain)
 {
   if (no_resync) {
@@ -1699,19 +1741,7 @@ void BKE_layer_collection_local_sync_all(const Main *bmain)
   }
 
   LISTBASE_FOREACH (Scene *, scene, &bmain->scenes) {
-    LISTBASE_FOREACH (ViewLayer *, view_layer, &scene->view_layers) {
-      LISTBASE_FOREACH (bScreen *, screen, &bmain->screens) {
-        LISTBASE_FOREACH (ScrArea *, area, &screen->areabase) {
-          if (area->spacetype != SPACE_VIEW3D) {
-            continue;
-          }
-          View3D *v3d = area->spacedata.first;
-          if (v3d->flag & V3D_LOCAL_COLLECTIONS) {
-            BKE_layer_collection_local_sync(view_layer, v3d);
-          }
-        }
-      }
-    }
+    scene_layer_collection_local_sync(bmain, scene);
   }
 }
 
@@ -0,0 +1,230 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <memory>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_hash.hh"
+#include "BLI_listbase.h"
+#include "BLI_map.hh"
+#include "BLI_set.hh"
+#include "BLI_string_ref.hh"
+#include "BLI_utildefines.h"
+
+#include "DNA_ID.h"
+
+#include "BKE_idtype.h"
+#include "BKE_lib_id.h"
+#include "BKE_main.h"
+#include "BKE_main_idmap.h" /* own include */
+
+/** \file
+ * \ingroup bke
+ *
+ * Utility functions for faster ID lookups.
+ */
+
+using blender::Map;
+using blender::Set;
+using blender::StringRef;
+
+/* -------------------------------------------------------------------- */
+/** \name BKE_main_idmap API
+ *
+ * Cache ID (name, library lookups).
+ * This doesn't account for adding/removing data-blocks,
+ * and should only be used when performing many lookups.
+ *
+ * \note Maps are initialized on demand,
+ * since its likely some types will never have lookups run on them,
+ * so its a waste to create and never use.
+ * \{ */
+
+struct IDNameLib_Key {
+  /** `ID.name + 2`: without the ID type prefix, since each id type gets its own 'map'. */
+  StringRef name;
+  /** `ID.lib`: */
+  const Library *lib;
+
+  uint64_t hash() const
+  {
+    return blender::get_default_hash_2(name, lib);
+  }
+
+  friend bool operator==(const IDNameLib_Key &a, const IDNameLib_Key &b)
+  {
+    return a.lib == b.lib && a.name == b.name;
+  }
+};
+
+struct IDNameLib_TypeMap {
+  std::unique_ptr<Map<IDNameLib_Key, ID *>> map;
+  short id_type;
+};
+
+/**
+ * Opaque structure, external API users only see this.
+ */
+struct IDNameLib_Map {
+  IDNameLib_TypeMap type_maps[INDEX_ID_MAX];
+  Map<uint, ID *> uuid_map;
+  Main *bmain;
+  std::unique_ptr<Set<const ID *>> valid_id_pointers;
+  int idmap_types;
+};
+
+static IDNameLib_TypeMap *main_idmap_from_idcode(IDNameLib_Map *id_map, short id_type)
+{
+  if (id_map->idmap_types & MAIN_IDMAP_TYPE_NAME) {
+    for (int i = 0; i < INDEX_ID_MAX; i++) {
+      if (id_map->type_maps[i].id_type == id_type) {
+        return &id_map->type_maps[i];
+      }
+    }
+  }
+  return nullptr;
+}
+
+static void main_idmap_add_valid_id_pointers(Set<const ID *> &valid_id_pointers, Main *bmain)
+{
+  ID *id;
+  FOREACH_MAIN_ID_BEGIN (bmain, id) {
+    valid_id_pointers.add(id);
+  }
+  FOREACH_MAIN_ID_END;
+}
+
+IDNameLib_Map *BKE_main_idmap_create(Main *bmain,
+                                     const bool create_valid_ids_set,
+                                     Main *old_bmain,
+                                     const int idmap_types)
+{
+  IDNameLib_Map *id_map = MEM_new<IDNameLib_Map>(__func__);
+  id_map->bmain = bmain;
+  id_map->idmap_types = idmap_types;
+
+  int index = 0;
+  while (index < INDEX_ID_MAX) {
+    IDNameLib_TypeMap *type_map = &id_map->type_maps[index];
+    type_map->id_type = BKE_idtype_idcode_iter_step(&index);
+    BLI_assert(type_map->id_type != 0);
+  }
+  BLI_assert(index == INDEX_ID_MAX);
+
+  if (idmap_types & MAIN_IDMAP_TYPE_UUID) {
+    ID *id;
+    FOREACH_MAIN_ID_BEGIN (bmain, id) {
+      BLI_assert(id->session_uuid != MAIN_ID_SESSION_UUID_UNSET);
+      const bool is_new_key = id_map->uuid_map.add(id->session_uuid, id);
+      BLI_assert(is_new_key);
+      UNUSED_VARS_NDEBUG(is_new_key);
+    }
+    FOREACH_MAIN_ID_END;
+  }
+
+  if (create_valid_ids_set) {
+    id_map->valid_id_pointers = std::make_unique<Set<const ID *>>();
+    main_idmap_add_valid_id_pointers(*id_map->valid_id_pointers, bmain);
+    if (old_bmain != nullptr) {
+      main_idmap_add_valid_id_pointers(*id_map->valid_id_pointers, old_bmain);
+    }
+  }
+
+  return id_map;
+}
+
+void BKE_main_idmap_insert_id(IDNameLib_Map *id_map, ID *id)
+{
+  if (id_map->idmap_types & MAIN_IDMAP_TYPE_NAME) {
+    const short id_type = GS(id->name);
+    IDNameLib_TypeMap *type_map = main_idmap_from_idcode(id_map, id_type);
+
+    /* No need to do anything if map has not been lazily created yet. */
+    if (LIKELY(type_map != nullptr) && type_map->map) {
+      type_map->map->add_overwrite({id->name + 2, id->lib}, id);
+    }
+  }
+
+  if (id_map->idmap_types & MAIN_IDMAP_TYPE_UUID) {
+    BLI_assert(id->session_uuid != MAIN_ID_SESSION_UUID_UNSET);
+    const bool is_new_key = id_map->uuid_map.add(id->session_uuid, id);
+    BLI_assert(is_new_key);
+    UNUSED_VARS_NDEBUG(is_new_key);
+  }
+}
+
+void BKE_main_idmap_remove_id(IDNameLib_Map *id_map, ID *id)
+{
+  if (id_map->idmap_types & MAIN_IDMAP_TYPE_NAME) {
+    const short id_type = GS(id->name);
+    IDNameLib_TypeMap *type_map = main_idmap_from_idcode(id_map, id_type);
+
+    /* No need to do anything if map has not been lazily created yet. */
+    if (LIKELY(type_map != nullptr) && type_map->map) {
+      type_map->map->remove({id->name + 2, id->lib});
+    }
+  }
+
+  if (id_map->idmap_types & MAIN_IDMAP_TYPE_UUID) {
+    BLI_assert(id->session_uuid != MAIN_ID_SESSION_UUID_UNSET);
+    id_map->uuid_map.remove(id->session_uuid);
+  }
+}
+
+Main *BKE_main_idmap_main_get(IDNameLib_Map *id_map)
+{
+  return id_map->bmain;
+}
+
+ID *BKE_main_idmap_lookup_name(IDNameLib_Map *id_map,
+                               short id_type,
+                               const char *name,
+                               const Library *lib)
+{
+  IDNameLib_TypeMap *type_map = main_idmap_from_idcode(id_map, id_type);
+
+  if (UNLIKELY(type_map == nullptr)) {
+    return nullptr;
+  }
+
+  /* Lazy init. */
+  if (!type_map->map) {
+    type_map->map = std::make_unique<Map<IDNameLib_Key, ID *>>();
+    ListBase *lb = which_libbase(id_map->bmain, id_type);
+    type_map->map->reserve(BLI_listbase_count(lb));
+    LISTBASE_FOREACH (ID *, id, lb) {
+      type_map->map->add({id->name + 2, id->lib}, id);
+    }
+  }
+
+  return type_map->map->lookup_default({name, lib}, nullptr);
+}
+
+ID *BKE_main_idmap_lookup_id(IDNameLib_Map *id_map, const ID *id)
+{
+  /* When used during undo/redo, this function cannot assume that given id points to valid memory
+   * (i.e. has not been freed),
+   * so it has to check that it does exist in 'old' (aka current) Main database.
+   * Otherwise, we cannot provide new ID pointer that way (would crash accessing freed memory
+   * when trying to get ID name).
+   */
+  if (!id_map->valid_id_pointers || id_map->valid_id_pointers->contains(id)) {
+    return BKE_main_idmap_lookup_name(id_map, GS(id->name), id->name + 2, id->lib);
+  }
+  return nullptr;
+}
+
+ID *BKE_main_idmap_lookup_uuid(IDNameLib_Map *id_map, const uint session_uuid)
+{
+  if (id_map->idmap_types & MAIN_IDMAP_TYPE_UUID) {
+    return id_map->uuid_map.lookup_default(session_uuid, nullptr);
+  }
+  return nullptr;
+}
+
+void BKE_main_idmap_destroy(IDNameLib_Map *id_map)
+{
+  MEM_delete(id_map);
+}
+
+/** \} */
@@ -1325,6 +1325,102 @@ static float layer_bucket_depth_from_xy(MaskRasterLayer *layer, const float xy[2
   return 1.0f;
 }
 
+/**
+ * The value of a single layer at \a xy, before it's blended with the layers below.
+ */
+static float maskrasterize_layer_sample(MaskRasterLayer *layer, const float xy[2])
+{
+  float value_layer;
+
+  /* also used as signal for unused layer (when render is disabled) */
+  if (layer->alpha != 0.0f && BLI_rctf_isect_pt_v(&layer->bounds, xy)) {
+    value_layer = 1.0f - layer_bucket_depth_from_xy(layer, xy);
+
+    switch (layer->falloff) {
+      case PROP_SMOOTH:
+        /* ease - gives less hard lines for dilate/erode feather */
+        value_layer = (3.0f * value_layer * value_layer -
+                       2.0f * value_layer * value_layer * value_layer);
+        break;
+      case PROP_SPHERE:
+        value_layer = sqrtf(2.0f * value_layer - value_layer * value_layer);
+        break;
+      case PROP_ROOT:
+        value_layer = sqrtf(value_layer);
+        break;
+      case PROP_SHARP:
+        value_layer = value_layer * value_layer;
+        break;
+      case PROP_INVSQUARE:
+        value_layer = value_layer * (2.0f - value_layer);
+        break;
+      case PROP_LIN:
+      default:
+        /* nothing */
+        break;
+    }
+
+    if (layer->blend != MASK_BLEND_REPLACE) {
+      value_layer *= layer->alpha;
+    }
+  }
+  else {
+    value_layer = 0.0f;
+  }
+
+  if (layer->blend_flag & MASK_BLENDFLAG_INVERT) {
+    value_layer = 1.0f - value_layer;
+  }
+
+  return value_layer;
+}
+
+static float maskrasterize_layer_blend(const MaskRasterLayer *layer,
+                                       float value,
+                                       const float value_layer)
+{
+  switch (layer->blend) {
+    case MASK_BLEND_MERGE_ADD:
+      value += value_layer * (1.0f - value);
+      break;
+    case MASK_BLEND_MERGE_SUBTRACT:
+      value -= value_layer * value;
+      break;
+    case MASK_BLEND_ADD:
+      value += value_layer;
+      break;
+    case MASK_BLEND_SUBTRACT:
+      value -= value_layer;
+      break;
+    case MASK_BLEND_LIGHTEN:
+      value = max_ff(value, value_layer);
+      break;
+    case MASK_BLEND_DARKEN:
+      value = min_ff(value, value_layer);
+      break;
+    case MASK_BLEND_MUL:
+      value *= value_layer;
+      break;
+    case MASK_BLEND_REPLACE:
+      value = (value * (1.0f - layer->alpha)) + (value_layer * layer->alpha);
+      break;
+    case MASK_BLEND_DIFFERENCE:
+      value = fabsf(value - value_layer);
+      break;
+    default: /* same as add */
+      CLOG_ERROR(&LOG, "unhandled blend type: %d", layer->blend);
+      BLI_assert(0);
+      value += value_layer;
+      break;
+  }
+
+  /* clamp after applying each layer so we don't get
+   * issues subtracting after accumulating over 1.0f */
+  CLAMP(value, 0.0f, 1.0f);
+
+  return value;
+}
+
 float BKE_maskrasterize_handle_sample(MaskRasterHandle *mr_handle, const float xy[2])
 {
   /* can't do this because some layers may invert */
@@ -1337,86 +1433,7 @@ float BKE_maskrasterize_handle_sample(MaskRasterHandle *mr_handle, const float x
   float value = 0.0f;
 
   for (uint i = 0; i < layers_tot; i++, layer++) {
-    float value_layer;
-
-    /* also used as signal for unused layer (when render is disabled) */
-    if (layer->alpha != 0.0f && BLI_rctf_isect_pt_v(&layer->bounds, xy)) {
-      value_layer = 1.0f - layer_bucket_depth_from_xy(layer, xy);
-
-      switch (layer->falloff) {
-        case PROP_SMOOTH:
-          /* ease - gives less hard lines for dilate/erode feather */
-          value_layer = (3.0f * value_layer * value_layer -
-                         2.0f * value_layer * value_layer * value_layer);
-          break;
-        case PROP_SPHERE:
-          value_layer = sqrtf(2.0f * value_layer - value_layer * value_layer);
-          break;
-        case PROP_ROOT:
-          value_layer = sqrtf(value_layer);
-          break;
-        case PROP_SHARP:
-          value_layer = value_layer * value_layer;
-          break;
-        case PROP_INVSQUARE:
-          value_layer = value_layer * (2.0f - value_layer);
-          break;
-        case PROP_LIN:
-        default:
-          /* nothing */
-          break;
-      }
-
-      if (layer->blend != MASK_BLEND_REPLACE) {
-        value_layer *= layer->alpha;
-      }
-    }
-    else {
-      value_layer = 0.0f;
-    }
-
-    if (layer->blend_flag & MASK_BLENDFLAG_INVERT) {
-      value_layer = 1.0f - value_layer;
-    }
-
-    switch (layer->blend) {
-      case MASK_BLEND_MERGE_ADD:
-        value += value_layer * (1.0f - value);
-        break;
-      case MASK_BLEND_MERGE_SUBTRACT:
-        value -= value_layer * value;
-        break;
-      case MASK_BLEND_ADD:
-        value += value_layer;
-        break;
-      case MASK_BLEND_SUBTRACT:
-        value -= value_layer;
-        break;
-      case MASK_BLEND_LIGHTEN:
-        value = max_ff(value, value_layer);
-        break;
-      case MASK_BLEND_DARKEN:
-        value = min_ff(value, value_layer);
-        break;
-      case MASK_BLEND_MUL:
-        value *= value_layer;
-        break;
-      case MASK_BLEND_REPLACE:
-        value = (value * (1.0f - layer->alpha)) + (value_layer * layer->alpha);
-        break;
-      case MASK_BLEND_DIFFERENCE:
-        value = fabsf(value - value_layer);
-        break;
-      default: /* same as add */
-        CLOG_ERROR(&LOG, "unhandled blend type: %d", layer->blend);
-        BLI_assert(0);
-        value += value_layer;
-        break;
-    }
-
-    /* clamp after applying each layer so we don't get
-     * issues subtracting after accumulating over 1.0f */
-    CLAMP(value, 0.0f, 1.0f);
+    value = maskrasterize_layer_blend(layer, value, maskrasterize_layer_sample(layer, xy));
   }
 
   return value;
@@ -1444,13 +1461,32 @@ static void maskrasterize_buffer_cb(void *__restrict userdata,
   const float x_inv = data->x_inv;
   const float x_px_ofs = data->x_px_ofs;
 
-  uint i = (uint)y * width;
+  float *row = &buffer[(uint)y * width];
   float xy[2];
   xy[1] = ((float)y * data->y_inv) + data->y_px_ofs;
-  for (uint x = 0; x < width; x++, i++) {
-    xy[0] = ((float)x * x_inv) + x_px_ofs;
 
-    buffer[i] = BKE_maskrasterize_handle_sample(mr_handle, xy);
+  for (uint x = 0; x < width; x++) {
+    row[x] = 0.0f;
+  }
+
+  /* Same result as #BKE_maskrasterize_handle_sample for every pixel, but blending one layer at a
+   * time over the whole row. This keeps the buckets of the layer in cache, and rows outside of
+   * the layer bounds don't have to be tested per pixel. */
+  const unsigned int layers_tot = mr_handle->layers_tot;
+  MaskRasterLayer *layer = mr_handle->layers;
+  for (uint i = 0; i < layers_tot; i++, layer++) {
+    if (layer->alpha == 0.0f || xy[1] < layer->bounds.ymin || xy[1] > layer->bounds.ymax) {
+      const float value_layer = (layer->blend_flag & MASK_BLENDFLAG_INVERT) ? 1.0f : 0.0f;
+      for (uint x = 0; x < width; x++) {
+        row[x] = maskrasterize_layer_blend(layer, row[x], value_layer);
+      }
+      continue;
+    }
+
+    for (uint x = 0; x < width; x++) {
+      xy[0] = ((float)x * x_inv) + x_px_ofs;
+      row[x] = maskrasterize_layer_blend(layer, row[x], maskrasterize_layer_sample(layer, xy));
+    }
   }
 }
 
@@ -60,6 +60,7 @@
 #include "BLO_read_write.h"
 
 using blender::float3;
+using blender::IndexRange;
 
 static void mesh_clear_geometry(Mesh *mesh);
 static void mesh_tessface_clear_intern(Mesh *mesh, int free_customdata);
@@ -87,6 +88,9 @@ static void mesh_init_data(ID *id)
   mesh->face_sets_color_seed = BLI_hash_int(PIL_check_seconds_timer_i() & UINT_MAX);
 }
 
+/** Number of face corners from which the custom data domains are copied in parallel. */
+#define MESH_COPY_PARALLEL_LOOPS_MIN (1 << 16)
+
 static void mesh_copy_data(Main *bmain, ID *id_dst, const ID *id_src, const int flag)
 {
   Mesh *mesh_dst = (Mesh *)id_dst;
@@ -123,10 +127,31 @@ static void mesh_copy_data(Main *bmain, ID *id_dst, const ID *id_src, const int
   BKE_defgroup_copy_list(&mesh_dst->vertex_group_names, &mesh_src->vertex_group_names);
 
   const eCDAllocType alloc_type = (flag & LIB_ID_COPY_CD_REFERENCE) ? CD_REFERENCE : CD_DUPLICATE;
-  CustomData_copy(&mesh_src->vdata, &mesh_dst->vdata, mask.vmask, alloc_type, mesh_dst->totvert);
-  CustomData_copy(&mesh_src->edata, &mesh_dst->edata, mask.emask, alloc_type, mesh_dst->totedge);
-  CustomData_copy(&mesh_src->ldata, &mesh_dst->ldata, mask.lmask, alloc_type, mesh_dst->totloop);
-  CustomData_copy(&mesh_src->pdata, &mesh_dst->pdata, mask.pmask, alloc_type, mesh_dst->totpoly);
+  auto copy_vert_data = [&]() {
+    CustomData_copy(&mesh_src->vdata, &mesh_dst->vdata, mask.vmask, alloc_type, mesh_dst->totvert);
+  };
+  auto copy_edge_data = [&]() {
+    CustomData_copy(&mesh_src->edata, &mesh_dst->edata, mask.emask, alloc_type, mesh_dst->totedge);
+  };
+  auto copy_loop_data = [&]() {
+    CustomData_copy(&mesh_src->ldata, &mesh_dst->ldata, mask.lmask, alloc_type, mesh_dst->totloop);
+  };
+  auto copy_poly_data = [&]() {
+    CustomData_copy(&mesh_src->pdata, &mesh_dst->pdata, mask.pmask, alloc_type, mesh_dst->totpoly);
+  };
+  /* Duplicating the layers of big meshes is bound by memory bandwidth rather than by a single
+   * core, so copy the domains in parallel. This is what dominates the first copy-on-write update
+   * of scenes with heavy meshes. */
+  if (alloc_type == CD_DUPLICATE && mesh_src->totloop >= MESH_COPY_PARALLEL_LOOPS_MIN) {
+    blender::threading::parallel_invoke(
+        copy_vert_data, copy_edge_data, copy_loop_data, copy_poly_data);
+  }
+  else {
+    copy_vert_data();
+    copy_edge_data();
+    copy_loop_data();
+    copy_poly_data();
+  }
   if (do_tessface) {
     CustomData_copy(&mesh_src->fdata, &mesh_dst->fdata, mask.fmask, alloc_type, mesh_dst->totface);
   }
@@ -149,6 +174,8 @@ static void mesh_copy_data(Main *bmain, ID *id_dst, const ID *id_src, const int
    * copied as the cost would be much lower. */
   BKE_mesh_normals_tag_dirty(mesh_dst);
 
+  BKE_mesh_runtime_looptris_share(mesh_dst, mesh_src);
+
   /* TODO: Do we want to add flag to prevent this? */
   if (mesh_src->key && (flag & LIB_ID_COPY_SHAPEKEY)) {
     BKE_id_copy_ex(bmain, &mesh_src->key->id, (ID **)&mesh_dst->key, flag);
@@ -1880,12 +1907,19 @@ void BKE_mesh_count_selected_items(const Mesh *mesh, int r_count[3])
   /* We could support faces in paint modes. */
 }
 
+/* Copying positions in and out of the mesh happens for every run of deform modifiers in the
+ * modifier stack, so do it in parallel for big meshes. */
+#define MESH_VERT_COORDS_GRAIN_SIZE 4096
+
 void BKE_mesh_vert_coords_get(const Mesh *mesh, float (*vert_coords)[3])
 {
-  const MVert *mv = mesh->mvert;
-  for (int i = 0; i < mesh->totvert; i++, mv++) {
-    copy_v3_v3(vert_coords[i], mv->co);
-  }
+  const MVert *mvert = mesh->mvert;
+  blender::threading::parallel_for(
+      IndexRange(mesh->totvert), MESH_VERT_COORDS_GRAIN_SIZE, [&](IndexRange range) {
+        for (const int i : range) {
+          copy_v3_v3(vert_coords[i], mvert[i].co);
+        }
+      });
 }
 
 float (*BKE_mesh_vert_coords_alloc(const Mesh *mesh, int *r_vert_len))[3]
@@ -1904,9 +1938,12 @@ void BKE_mesh_vert_coords_apply(Mesh *mesh, const float (*vert_coords)[3])
   MVert *mv = (MVert *)CustomData_duplicate_referenced_layer(
       &mesh->vdata, CD_MVERT, mesh->totvert);
   mesh->mvert = mv;
-  for (int i = 0; i < mesh->totvert; i++, mv++) {
-    copy_v3_v3(mv->co, vert_coords[i]);
-  }
+  blender::threading::parallel_for(
+      IndexRange(mesh->totvert), MESH_VERT_COORDS_GRAIN_SIZE, [&](IndexRange range) {
+        for (const int i : range) {
+          copy_v3_v3(mv[i].co, vert_coords[i]);
+        }
+      });
   BKE_mesh_normals_tag_dirty(mesh);
 }
 
@@ -1918,9 +1955,12 @@ void BKE_mesh_vert_coords_apply_with_mat4(Mesh *mesh,
   MVert *mv = (MVert *)CustomData_duplicate_referenced_layer(
       &mesh->vdata, CD_MVERT, mesh->totvert);
   mesh->mvert = mv;
-  for (int i = 0; i < mesh->totvert; i++, mv++) {
-    mul_v3_m4v3(mv->co, mat, vert_coords[i]);
-  }
+  blender::threading::parallel_for(
+      IndexRange(mesh->totvert), MESH_VERT_COORDS_GRAIN_SIZE, [&](IndexRange range) {
+        for (const int i : range) {
+          mul_v3_m4v3(mv[i].co, mat, vert_coords[i]);
+        }
+      });
   BKE_mesh_normals_tag_dirty(mesh);
 }
 
@@ -35,8 +35,6 @@
 #include "BKE_global.h"
 #include "BKE_mesh.h"
 
-#include "atomic_ops.h"
-
 using blender::Span;
 
 // #define DEBUG_TIME
@@ -46,46 +44,6 @@ using blender::Span;
 #  include "PIL_time_utildefines.h"
 #endif
 
-/* -------------------------------------------------------------------- */
-/** \name Private Utility Functions
- * \{ */
-
-/**
- * A thread-safe version of #add_v3_v3 that uses a spin-lock.
- *
- * \note Avoid using this when the chance of contention is high.
- */
-static void add_v3_v3_atomic(float r[3], const float a[3])
-{
-#define FLT_EQ_NONAN(_fa, _fb) (*((const uint32_t *)&_fa) == *((const uint32_t *)&_fb))
-
-  float virtual_lock = r[0];
-  while (true) {
-    /* This loops until following conditions are met:
-     * - `r[0]` has same value as virtual_lock (i.e. it did not change since last try).
-     * - `r[0]` was not `FLT_MAX`, i.e. it was not locked by another thread. */
-    const float test_lock = atomic_cas_float(&r[0], virtual_lock, FLT_MAX);
-    if (_ATOMIC_LIKELY(FLT_EQ_NONAN(test_lock, virtual_lock) && (test_lock != FLT_MAX))) {
-      break;
-    }
-    virtual_lock = test_lock;
-  }
-  virtual_lock += a[0];
-  r[1] += a[1];
-  r[2] += a[2];
-
-  /* Second atomic operation to 'release'
-   * our lock on that vector and set its first scalar value. */
-  /* Note that we do not need to loop here, since we 'locked' `r[0]`,
-   * nobody should have changed it in the mean time. */
-  virtual_lock = atomic_cas_float(&r[0], FLT_MAX, virtual_lock);
-  BLI_assert(virtual_lock == FLT_MAX);
-
-#undef FLT_EQ_NONAN
-}
-
-/** \} */
-
 /* -------------------------------------------------------------------- */
 /** \name Public Utility Functions
  *
@@ -96,6 +54,7 @@ void BKE_mesh_normals_tag_dirty(Mesh *mesh)
 {
   mesh->runtime.vert_normals_dirty = true;
   mesh->runtime.poly_normals_dirty = true;
+  mesh->runtime.looptris_positions_dirty = true;
 }
 
 float (*BKE_mesh_vertex_normals_for_write(Mesh *mesh))[3]
@@ -219,15 +178,36 @@ void BKE_mesh_calc_normals_poly(const MVert *mvert,
  * meshes can slow down high-poly meshes. For details on performance, see D11993.
  * \{ */
 
+/**
+ * Vertex normals are summed without atomics: each corner stores its angle weighted polygon
+ * normal, then the corners are grouped by ranges of vertices ("buckets") so that every vertex is
+ * only written by the task that owns its bucket. Corners keep their order within a bucket,
+ * so the result doesn't depend on the threading.
+ */
 struct MeshCalcNormalsData_PolyAndVertex {
   const MVert *mvert;
   const MLoop *mloop;
   const MPoly *mpoly;
+  int mvert_len;
+  int mloop_len;
 
   /** Polygon normal output. */
   float (*pnors)[3];
+  /** Angle weighted polygon normal of each corner. */
+  float (*lnors_weighted)[3];
   /** Vertex normal output. */
   float (*vnors)[3];
+
+  /** Corners are split into this many chunks, vertices into as many buckets. */
+  int tasks_num;
+  int loops_per_chunk;
+  int verts_per_bucket;
+  /** Corner count, then write position, of every chunk in every bucket (`tasks_num ^ 2`). */
+  int *chunk_bucket_offsets;
+  /** Start of every bucket in #bucket_loops (`tasks_num + 1`). */
+  int *bucket_offsets;
+  /** Corner indices grouped by the bucket of their vertex. */
+  int *bucket_loops;
 };
 
 static void mesh_calc_normals_poly_and_vertex_accum_fn(
@@ -237,7 +217,7 @@ static void mesh_calc_normals_poly_and_vertex_accum_fn(
   const MPoly *mp = &data->mpoly[pidx];
   const MLoop *ml = &data->mloop[mp->loopstart];
   const MVert *mverts = data->mvert;
-  float(*vnors)[3] = data->vnors;
+  float(*lnors_weighted)[3] = &data->lnors_weighted[mp->loopstart];
 
   float pnor_temp[3];
   float *pnor = data->pnors ? data->pnors[pidx] : pnor_temp;
@@ -260,7 +240,7 @@ static void mesh_calc_normals_poly_and_vertex_accum_fn(
     }
   }
 
-  /* Accumulate angle weighted face normal into the vertex normal. */
+  /* Store the angle weighted face normal of every corner, summed into the vertex normals later. */
   /* Inline version of #accumulate_vertex_normals_poly_v3. */
   {
     float edvec_prev[3], edvec_next[3], edvec_end[3];
@@ -283,33 +263,65 @@ static void mesh_calc_normals_poly_and_vertex_accum_fn(
 
       /* Calculate angle between the two poly edges incident on this vertex. */
       const float fac = saacos(-dot_v3v3(edvec_prev, edvec_next));
-      const float vnor_add[3] = {pnor[0] * fac, pnor[1] * fac, pnor[2] * fac};
-
-      add_v3_v3_atomic(vnors[ml[i_curr].v], vnor_add);
+      mul_v3_v3fl(lnors_weighted[i_curr], pnor, fac);
       v_curr = v_next;
       copy_v3_v3(edvec_prev, edvec_next);
     }
   }
 }
 
+static void mesh_calc_normals_poly_and_vertex_bucket_count_fn(
+    void *__restrict userdata, const int chunk, const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  MeshCalcNormalsData_PolyAndVertex *data = (MeshCalcNormalsData_PolyAndVertex *)userdata;
+  int *bucket_counts = &data->chunk_bucket_offsets[chunk * data->tasks_num];
+
+  const int loop_start = chunk * data->loops_per_chunk;
+  const int loop_end = min_ii(loop_start + data->loops_per_chunk, data->mloop_len);
+  for (int i = loop_start; i < loop_end; i++) {
+    bucket_counts[data->mloop[i].v / data->verts_per_bucket]++;
+  }
+}
+
+static void mesh_calc_normals_poly_and_vertex_bucket_fill_fn(
+    void *__restrict userdata, const int chunk, const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  MeshCalcNormalsData_PolyAndVertex *data = (MeshCalcNormalsData_PolyAndVertex *)userdata;
+  int *bucket_offsets = &data->chunk_bucket_offsets[chunk * data->tasks_num];
+
+  const int loop_start = chunk * data->loops_per_chunk;
+  const int loop_end = min_ii(loop_start + data->loops_per_chunk, data->mloop_len);
+  for (int i = loop_start; i < loop_end; i++) {
+    data->bucket_loops[bucket_offsets[data->mloop[i].v / data->verts_per_bucket]++] = i;
+  }
+}
+
 static void mesh_calc_normals_poly_and_vertex_finalize_fn(
-    void *__restrict userdata, const int vidx, const TaskParallelTLS *__restrict UNUSED(tls))
+    void *__restrict userdata, const int bucket, const TaskParallelTLS *__restrict UNUSED(tls))
 {
   MeshCalcNormalsData_PolyAndVertex *data = (MeshCalcNormalsData_PolyAndVertex *)userdata;
+  float(*vnors)[3] = data->vnors;
 
-  const MVert *mv = &data->mvert[vidx];
-  float *no = data->vnors[vidx];
+  for (int i = data->bucket_offsets[bucket]; i < data->bucket_offsets[bucket + 1]; i++) {
+    const int loop = data->bucket_loops[i];
+    add_v3_v3(vnors[data->mloop[loop].v], data->lnors_weighted[loop]);
+  }
 
-  if (UNLIKELY(normalize_v3(no) == 0.0f)) {
-    /* Following Mesh convention; we use vertex coordinate itself for normal in this case. */
-    normalize_v3_v3(no, mv->co);
+  const int vert_start = bucket * data->verts_per_bucket;
+  const int vert_end = min_ii(vert_start + data->verts_per_bucket, data->mvert_len);
+  for (int vidx = vert_start; vidx < vert_end; vidx++) {
+    float *no = vnors[vidx];
+    if (UNLIKELY(normalize_v3(no) == 0.0f)) {
+      /* Following Mesh convention; we use vertex coordinate itself for normal in this case. */
+      normalize_v3_v3(no, data->mvert[vidx].co);
+    }
   }
 }
 
 void BKE_mesh_calc_normals_poly_and_vertex(const MVert *mvert,
                                            const int mvert_len,
                                            const MLoop *mloop,
-                                           const int UNUSED(mloop_len),
+                                           const int mloop_len,
                                            const MPoly *mpoly,
                                            const int mpoly_len,
                                            float (*r_poly_normals)[3],
@@ -319,22 +331,67 @@ void BKE_mesh_calc_normals_poly_and_vertex(const MVert *mvert,
   BLI_parallel_range_settings_defaults(&settings);
   settings.min_iter_per_thread = 1024;
 
+  /* The chunk and bucket passes only have a few items per thread. */
+  TaskParallelSettings settings_tasks;
+  BLI_parallel_range_settings_defaults(&settings_tasks);
+
   memset(r_vert_normals, 0, sizeof(*r_vert_normals) * (size_t)mvert_len);
+  if (mvert_len == 0) {
+    return;
+  }
+
+  const int tasks_num = max_ii(
+      1, min_ii(BLI_task_scheduler_num_threads() * 2, mloop_len / settings.min_iter_per_thread));
 
   MeshCalcNormalsData_PolyAndVertex data = {};
   data.mpoly = mpoly;
   data.mloop = mloop;
   data.mvert = mvert;
+  data.mvert_len = mvert_len;
+  data.mloop_len = mloop_len;
   data.pnors = r_poly_normals;
   data.vnors = r_vert_normals;
-
-  /* Compute poly normals, accumulating them into vertex normals. */
+  data.tasks_num = tasks_num;
+  data.loops_per_chunk = (int)divide_ceil_u((uint)mloop_len, (uint)tasks_num);
+  data.verts_per_bucket = (int)divide_ceil_u((uint)mvert_len, (uint)tasks_num);
+  data.lnors_weighted = (float(*)[3])MEM_malloc_arrayN(
+      (size_t)mloop_len, sizeof(*data.lnors_weighted), __func__);
+  data.chunk_bucket_offsets = (int *)MEM_calloc_arrayN(
+      (size_t)(tasks_num * tasks_num), sizeof(*data.chunk_bucket_offsets), __func__);
+  data.bucket_offsets = (int *)MEM_malloc_arrayN(
+      (size_t)(tasks_num + 1), sizeof(*data.bucket_offsets), __func__);
+  data.bucket_loops = (int *)MEM_malloc_arrayN(
+      (size_t)mloop_len, sizeof(*data.bucket_loops), __func__);
+
+  /* Compute poly normals and the angle weighted normal of every corner. */
   BLI_task_parallel_range(
       0, mpoly_len, &data, mesh_calc_normals_poly_and_vertex_accum_fn, &settings);
 
-  /* Normalize and validate computed vertex normals. */
+  /* Group the corners by vertex bucket, keeping them in order within each bucket. */
   BLI_task_parallel_range(
-      0, mvert_len, &data, mesh_calc_normals_poly_and_vertex_finalize_fn, &settings);
+      0, tasks_num, &data, mesh_calc_normals_poly_and_vertex_bucket_count_fn, &settings_tasks);
+  int offset = 0;
+  for (int bucket = 0; bucket < tasks_num; bucket++) {
+    data.bucket_offsets[bucket] = offset;
+    for (int chunk = 0; chunk < tasks_num; chunk++) {
+      int *chunk_offset = &data.chunk_bucket_offsets[chunk * tasks_num + bucket];
+      const int count = *chunk_offset;
+      *chunk_offset = offset;
+      offset += count;
+    }
+  }
+  data.bucket_offsets[tasks_num] = offset;
+  BLI_task_parallel_range(
+      0, tasks_num, &data, mesh_calc_normals_poly_and_vertex_bucket_fill_fn, &settings_tasks);
+
+  /* Sum the corner normals of every vertex, then normalize and validate them. */
+  BLI_task_parallel_range(
+      0, tasks_num, &data, mesh_calc_normals_poly_and_vertex_finalize_fn, &settings_tasks);
+
+  MEM_freeN(data.lnors_weighted);
+  MEM_freeN(data.chunk_bucket_offsets);
+  MEM_freeN(data.bucket_offsets);
+  MEM_freeN(data.bucket_loops);
 }
 
 /** \} */
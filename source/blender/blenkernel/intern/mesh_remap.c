@@ -22,6 +22,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "BKE_bvhutils.h"
@@ -470,6 +471,41 @@ typedef struct IslandResult {
 /* Will be enough in 99% of cases. */
 #define MREMAP_DEFAULT_BUFSIZE 32
 
+typedef struct MeshRemapVertsNearestData {
+  BVHTreeFromMesh *treedata;
+  const SpaceTransform *space_transform;
+  const MVert *verts_dst;
+  float max_dist_sq;
+  /** Nearest source vertex for each destination vertex, -1 when there is none. */
+  int *r_indices_src;
+} MeshRemapVertsNearestData;
+
+static void mesh_remap_verts_nearest_cb(void *__restrict userdata,
+                                        const int i,
+                                        const TaskParallelTLS *__restrict tls)
+{
+  MeshRemapVertsNearestData *data = userdata;
+  /* Per thread, so that the previous result of the same thread is used as a starting point. */
+  BVHTreeNearest *nearest = tls->userdata_chunk;
+  float tmp_co[3];
+  float hit_dist;
+
+  copy_v3_v3(tmp_co, data->verts_dst[i].co);
+
+  /* Convert the vertex to tree coordinates, if needed. */
+  if (data->space_transform) {
+    BLI_space_transform_apply(data->space_transform, tmp_co);
+  }
+
+  if (mesh_remap_bvhtree_query_nearest(
+          data->treedata, nearest, tmp_co, data->max_dist_sq, &hit_dist)) {
+    data->r_indices_src[i] = nearest->index;
+  }
+  else {
+    data->r_indices_src[i] = -1;
+  }
+}
+
 void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
                                          const SpaceTransform *space_transform,
                                          const float max_dist,
@@ -505,23 +541,34 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_VERTS, 2);
       nearest.index = -1;
 
-      for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, verts_dst[i].co);
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+      /* Search in parallel, the map items are allocated from a memory arena afterwards. */
+      int *indices_src = MEM_malloc_arrayN((size_t)numverts_dst, sizeof(*indices_src), __func__);
+      MeshRemapVertsNearestData data = {
+          .treedata = &treedata,
+          .space_transform = space_transform,
+          .verts_dst = verts_dst,
+          .max_dist_sq = max_dist_sq,
+          .r_indices_src = indices_src,
+      };
+      TaskParallelSettings settings;
+      BLI_parallel_range_settings_defaults(&settings);
+      settings.min_iter_per_thread = 1024;
+      settings.userdata_chunk = &nearest;
+      settings.userdata_chunk_size = sizeof(nearest);
+      BLI_task_parallel_range(0, numverts_dst, &data, mesh_remap_verts_nearest_cb, &settings);
 
-        if (mesh_remap_bvhtree_query_nearest(
-                &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist)) {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
+      for (i = 0; i < numverts_dst; i++) {
+        if (indices_src[i] != -1) {
+          /* The hit distance is not stored. */
+          mesh_remap_item_define(r_map, i, 0.0f, 0, 1, &indices_src[i], &full_weight);
         }
         else {
           /* No source for this dest vertex! */
           BKE_mesh_remap_item_define_invalid(r_map, i);
         }
       }
+
+      MEM_freeN(indices_src);
     }
     else if (ELEM(mode, MREMAP_MODE_VERT_EDGE_NEAREST, MREMAP_MODE_VERT_EDGEINTERP_NEAREST)) {
       MEdge *edges_src = me_src->medge;
@@ -727,13 +774,10 @@ void BKE_mesh_remap_calc_edges_from_mesh(const int mode,
     float tmp_co[3], tmp_no[3];
 
     if (mode == MREMAP_MODE_EDGE_VERT_NEAREST) {
-      const int num_verts_src = me_src->totvert;
-      const int num_edges_src = me_src->totedge;
       MEdge *edges_src = me_src->medge;
       float(*vcos_src)[3] = BKE_mesh_vert_coords_alloc(me_src, NULL);
 
-      MeshElemMap *vert_to_edge_src_map;
-      int *vert_to_edge_src_map_mem;
+      const MeshElemMap *vert_to_edge_src_map = BKE_mesh_runtime_vert_edge_map_ensure(me_src);
 
       struct {
         float hit_dist;
@@ -745,12 +789,6 @@ void BKE_mesh_remap_calc_edges_from_mesh(const int mode,
         v_dst_to_src_map[i].hit_dist = -1.0f;
       }
 
-      BKE_mesh_vert_edge_map_create(&vert_to_edge_src_map,
-                                    &vert_to_edge_src_map_mem,
-                                    edges_src,
-                                    num_verts_src,
-                                    num_edges_src);
-
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_VERTS, 2);
       nearest.index = -1;
 
@@ -850,8 +888,6 @@ void BKE_mesh_remap_calc_edges_from_mesh(const int mode,
 
       MEM_freeN(vcos_src);
       MEM_freeN(v_dst_to_src_map);
-      MEM_freeN(vert_to_edge_src_map);
-      MEM_freeN(vert_to_edge_src_map_mem);
     }
     else if (mode == MREMAP_MODE_EDGE_NEAREST) {
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_EDGES, 2);
@@ -1049,7 +1085,7 @@ static void mesh_island_to_astar_graph_edge_process(MeshIslandStore *islands,
                                                     MLoop *loops,
                                                     const int edge_idx,
                                                     BLI_bitmap *done_edges,
-                                                    MeshElemMap *edge_to_poly_map,
+                                                    const MeshElemMap *edge_to_poly_map,
                                                     const bool is_edge_innercut,
                                                     const int *poly_island_index_map,
                                                     float (*poly_centers)[3],
@@ -1103,7 +1139,7 @@ static void mesh_island_to_astar_graph_edge_process(MeshIslandStore *islands,
 static void mesh_island_to_astar_graph(MeshIslandStore *islands,
                                        const int island_index,
                                        MVert *verts,
-                                       MeshElemMap *edge_to_poly_map,
+                                       const MeshElemMap *edge_to_poly_map,
                                        const int numedges,
                                        MLoop *loops,
                                        MPoly *polys,
@@ -1295,10 +1331,8 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
 
     MeshElemMap *vert_to_loop_map_src = NULL;
     int *vert_to_loop_map_src_buff = NULL;
-    MeshElemMap *vert_to_poly_map_src = NULL;
-    int *vert_to_poly_map_src_buff = NULL;
-    MeshElemMap *edge_to_poly_map_src = NULL;
-    int *edge_to_poly_map_src_buff = NULL;
+    const MeshElemMap *vert_to_poly_map_src = NULL;
+    const MeshElemMap *edge_to_poly_map_src = NULL;
     MeshElemMap *poly_to_looptri_map_src = NULL;
     int *poly_to_looptri_map_src_buff = NULL;
 
@@ -1397,25 +1431,12 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
                                     num_polys_src,
                                     num_loops_src);
       if (mode & MREMAP_USE_POLY) {
-        BKE_mesh_vert_poly_map_create(&vert_to_poly_map_src,
-                                      &vert_to_poly_map_src_buff,
-                                      polys_src,
-                                      loops_src,
-                                      num_verts_src,
-                                      num_polys_src,
-                                      num_loops_src);
+        vert_to_poly_map_src = BKE_mesh_runtime_vert_poly_map_ensure(me_src);
       }
     }
 
     /* Needed for islands (or plain mesh) to AStar graph conversion. */
-    BKE_mesh_edge_poly_map_create(&edge_to_poly_map_src,
-                                  &edge_to_poly_map_src_buff,
-                                  edges_src,
-                                  num_edges_src,
-                                  polys_src,
-                                  num_polys_src,
-                                  loops_src,
-                                  num_loops_src);
+    edge_to_poly_map_src = BKE_mesh_runtime_edge_poly_map_ensure(me_src);
     if (use_from_vert) {
       loop_to_poly_map_src = MEM_mallocN(sizeof(*loop_to_poly_map_src) * (size_t)num_loops_src,
                                          __func__);
@@ -1598,7 +1619,7 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
         ml_dst = &loops_dst[mp_dst->loopstart];
         for (plidx_dst = 0; plidx_dst < mp_dst->totloop; plidx_dst++, ml_dst++) {
           if (use_from_vert) {
-            MeshElemMap *vert_to_refelem_map_src = NULL;
+            const MeshElemMap *vert_to_refelem_map_src = NULL;
 
             copy_v3_v3(tmp_co, verts_dst[ml_dst->v].co);
             nearest.index = -1;
@@ -2111,18 +2132,6 @@ void BKE_mesh_remap_calc_loops_from_mesh(const int mode,
     if (vert_to_loop_map_src_buff) {
       MEM_freeN(vert_to_loop_map_src_buff);
     }
-    if (vert_to_poly_map_src) {
-      MEM_freeN(vert_to_poly_map_src);
-    }
-    if (vert_to_poly_map_src_buff) {
-      MEM_freeN(vert_to_poly_map_src_buff);
-    }
-    if (edge_to_poly_map_src) {
-      MEM_freeN(edge_to_poly_map_src);
-    }
-    if (edge_to_poly_map_src_buff) {
-      MEM_freeN(edge_to_poly_map_src_buff);
-    }
     if (poly_to_looptri_map_src) {
       MEM_freeN(poly_to_looptri_map_src);
     }
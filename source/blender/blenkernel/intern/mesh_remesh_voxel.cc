@@ -19,6 +19,7 @@
 #include "BLI_math_vec_types.hh"
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
@@ -194,16 +195,20 @@ static openvdb::FloatGrid::Ptr remesh_voxel_level_set_create(const Mesh *mesh,
   std::vector<openvdb::Vec3s> points(mesh->totvert);
   std::vector<openvdb::Vec3I> triangles(looptris.size());
 
-  for (const int i : IndexRange(mesh->totvert)) {
-    const float3 co = mesh->mvert[i].co;
-    points[i] = openvdb::Vec3s(co.x, co.y, co.z);
-  }
+  blender::threading::parallel_for(IndexRange(mesh->totvert), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      const float3 co = mesh->mvert[i].co;
+      points[i] = openvdb::Vec3s(co.x, co.y, co.z);
+    }
+  });
 
-  for (const int i : IndexRange(looptris.size())) {
-    const MLoopTri &loop_tri = looptris[i];
-    triangles[i] = openvdb::Vec3I(
-        mloop[loop_tri.tri[0]].v, mloop[loop_tri.tri[1]].v, mloop[loop_tri.tri[2]].v);
-  }
+  blender::threading::parallel_for(looptris.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      const MLoopTri &loop_tri = looptris[i];
+      triangles[i] = openvdb::Vec3I(
+          mloop[loop_tri.tri[0]].v, mloop[loop_tri.tri[1]].v, mloop[loop_tri.tri[2]].v);
+    }
+  });
 
   openvdb::math::Transform::Ptr transform = openvdb::math::Transform::createLinearTransform(
       voxel_size);
@@ -230,31 +235,37 @@ static Mesh *remesh_voxel_volume_to_mesh(const openvdb::FloatGrid::Ptr level_set
   MutableSpan<MLoop> mloops{mesh->mloop, mesh->totloop};
   MutableSpan<MPoly> mpolys{mesh->mpoly, mesh->totpoly};
 
-  for (const int i : mverts.index_range()) {
-    copy_v3_v3(mverts[i].co, float3(vertices[i].x(), vertices[i].y(), vertices[i].z()));
-  }
-
-  for (const int i : IndexRange(quads.size())) {
-    MPoly &poly = mpolys[i];
-    const int loopstart = i * 4;
-    poly.loopstart = loopstart;
-    poly.totloop = 4;
-    mloops[loopstart].v = quads[i][0];
-    mloops[loopstart + 1].v = quads[i][3];
-    mloops[loopstart + 2].v = quads[i][2];
-    mloops[loopstart + 3].v = quads[i][1];
-  }
+  blender::threading::parallel_for(mverts.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      copy_v3_v3(mverts[i].co, float3(vertices[i].x(), vertices[i].y(), vertices[i].z()));
+    }
+  });
+
+  blender::threading::parallel_for(IndexRange(quads.size()), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      MPoly &poly = mpolys[i];
+      const int loopstart = i * 4;
+      poly.loopstart = loopstart;
+      poly.totloop = 4;
+      mloops[loopstart].v = quads[i][0];
+      mloops[loopstart + 1].v = quads[i][3];
+      mloops[loopstart + 2].v = quads[i][2];
+      mloops[loopstart + 3].v = quads[i][1];
+    }
+  });
 
   const int triangle_loop_start = quads.size() * 4;
-  for (const int i : IndexRange(tris.size())) {
-    MPoly &poly = mpolys[quads.size() + i];
-    const int loopstart = triangle_loop_start + i * 3;
-    poly.loopstart = loopstart;
-    poly.totloop = 3;
-    mloops[loopstart].v = tris[i][2];
-    mloops[loopstart + 1].v = tris[i][1];
-    mloops[loopstart + 2].v = tris[i][0];
-  }
+  blender::threading::parallel_for(IndexRange(tris.size()), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      MPoly &poly = mpolys[quads.size() + i];
+      const int loopstart = triangle_loop_start + i * 3;
+      poly.loopstart = loopstart;
+      poly.totloop = 3;
+      mloops[loopstart].v = tris[i][2];
+      mloops[loopstart + 1].v = tris[i][1];
+      mloops[loopstart + 2].v = tris[i][0];
+    }
+  });
 
   BKE_mesh_calc_edges(mesh, false, false);
   BKE_mesh_normals_tag_dirty(mesh);
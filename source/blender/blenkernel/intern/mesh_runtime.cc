@@ -13,16 +13,188 @@
 #include "DNA_meshdata_types.h"
 #include "DNA_object_types.h"
 
+#include <mutex>
+
+#include "BLI_array.hh"
+#include "BLI_implicit_sharing.hh"
+#include "BLI_index_mask_ops.hh"
 #include "BLI_math_geom.h"
 #include "BLI_task.hh"
 
 #include "BKE_bvhutils.h"
 #include "BKE_lib_id.h"
 #include "BKE_mesh.h"
+#include "BKE_mesh_mapping.h"
 #include "BKE_mesh_runtime.h"
 #include "BKE_shrinkwrap.h"
 #include "BKE_subdiv_ccg.h"
 
+/* -------------------------------------------------------------------- */
+/** \name Mesh Topology Maps
+ * \{ */
+
+struct MeshTopologyMap {
+  MeshElemMap *map = nullptr;
+  int *mem = nullptr;
+};
+
+struct MeshTopologyMaps {
+  std::mutex mutex;
+  MeshTopologyMap vert_poly;
+  MeshTopologyMap vert_edge;
+  MeshTopologyMap edge_poly;
+  bool loose_geom_valid = false;
+  MeshLooseGeom loose_geom = {};
+};
+
+static void mesh_topology_map_free(MeshTopologyMap &map)
+{
+  MEM_SAFE_FREE(map.map);
+  MEM_SAFE_FREE(map.mem);
+}
+
+static void mesh_topology_maps_free(Mesh *mesh)
+{
+  MeshTopologyMaps *maps = mesh->runtime.topology_maps;
+  if (maps == nullptr) {
+    return;
+  }
+  mesh_topology_map_free(maps->vert_poly);
+  mesh_topology_map_free(maps->vert_edge);
+  mesh_topology_map_free(maps->edge_poly);
+  MEM_SAFE_FREE(maps->loose_geom.verts);
+  MEM_SAFE_FREE(maps->loose_geom.edges);
+  MEM_delete(maps);
+  mesh->runtime.topology_maps = nullptr;
+}
+
+static MeshTopologyMaps &mesh_topology_maps_ensure(const Mesh *mesh)
+{
+  MeshTopologyMaps *maps = mesh->runtime.topology_maps;
+  if (maps != nullptr) {
+    return *maps;
+  }
+  MeshTopologyMaps *new_maps = MEM_new<MeshTopologyMaps>(__func__);
+  maps = static_cast<MeshTopologyMaps *>(atomic_cas_ptr(
+      (void **)&const_cast<Mesh *>(mesh)->runtime.topology_maps, nullptr, new_maps));
+  if (maps != nullptr) {
+    /* Another thread allocated the maps in the meantime. */
+    MEM_delete(new_maps);
+    return *maps;
+  }
+  return *new_maps;
+}
+
+template<typename CreateFn>
+static const MeshElemMap *mesh_topology_map_ensure(const Mesh *mesh,
+                                                   MeshTopologyMap MeshTopologyMaps::*member,
+                                                   const CreateFn &create_fn)
+{
+  MeshTopologyMaps &maps = mesh_topology_maps_ensure(mesh);
+  std::lock_guard lock{maps.mutex};
+  MeshTopologyMap &map = maps.*member;
+  if (map.map == nullptr) {
+    create_fn(&map.map, &map.mem);
+  }
+  return map.map;
+}
+
+const MeshElemMap *BKE_mesh_runtime_vert_poly_map_ensure(const Mesh *mesh)
+{
+  return mesh_topology_map_ensure(
+      mesh, &MeshTopologyMaps::vert_poly, [&](MeshElemMap **r_map, int **r_mem) {
+        BKE_mesh_vert_poly_map_create(r_map,
+                                      r_mem,
+                                      mesh->mpoly,
+                                      mesh->mloop,
+                                      mesh->totvert,
+                                      mesh->totpoly,
+                                      mesh->totloop);
+      });
+}
+
+const MeshElemMap *BKE_mesh_runtime_vert_edge_map_ensure(const Mesh *mesh)
+{
+  return mesh_topology_map_ensure(
+      mesh, &MeshTopologyMaps::vert_edge, [&](MeshElemMap **r_map, int **r_mem) {
+        BKE_mesh_vert_edge_map_create(r_map, r_mem, mesh->medge, mesh->totvert, mesh->totedge);
+      });
+}
+
+const MeshElemMap *BKE_mesh_runtime_edge_poly_map_ensure(const Mesh *mesh)
+{
+  return mesh_topology_map_ensure(
+      mesh, &MeshTopologyMaps::edge_poly, [&](MeshElemMap **r_map, int **r_mem) {
+        BKE_mesh_edge_poly_map_create(r_map,
+                                      r_mem,
+                                      mesh->medge,
+                                      mesh->totedge,
+                                      mesh->mpoly,
+                                      mesh->totpoly,
+                                      mesh->mloop,
+                                      mesh->totloop);
+      });
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Mesh Loose Geometry
+ * \{ */
+
+static int *mesh_loose_indices_from_mask(const blender::IndexMask mask, int *r_len)
+{
+  int *indices = static_cast<int *>(MEM_malloc_arrayN(mask.size(), sizeof(int), __func__));
+  for (const int64_t i : mask.index_range()) {
+    indices[i] = int(mask[i]);
+  }
+  *r_len = int(mask.size());
+  return indices;
+}
+
+static void mesh_loose_geom_calc(const Mesh *mesh, MeshLooseGeom &r_loose_geom)
+{
+  using namespace blender;
+  const Span<MEdge> edges(mesh->medge, mesh->totedge);
+
+  threading::parallel_invoke(
+      [&]() {
+        Vector<int64_t> indices;
+        const IndexMask mask = index_mask_ops::find_indices_based_on_predicate(
+            edges.index_range(), 4096, indices, [&](const int64_t i) {
+              return (edges[i].flag & ME_LOOSEEDGE) != 0;
+            });
+        r_loose_geom.edges = mesh_loose_indices_from_mask(mask, &r_loose_geom.edges_len);
+      },
+      [&]() {
+        Array<bool> used_verts(mesh->totvert, false);
+        for (const MEdge &edge : edges) {
+          used_verts[edge.v1] = true;
+          used_verts[edge.v2] = true;
+        }
+        Vector<int64_t> indices;
+        const IndexMask mask = index_mask_ops::find_indices_based_on_predicate(
+            IndexRange(mesh->totvert), 4096, indices, [&](const int64_t i) {
+              return !used_verts[i];
+            });
+        r_loose_geom.verts = mesh_loose_indices_from_mask(mask, &r_loose_geom.verts_len);
+      });
+}
+
+const MeshLooseGeom *BKE_mesh_runtime_loose_geom_ensure(const Mesh *mesh)
+{
+  MeshTopologyMaps &maps = mesh_topology_maps_ensure(mesh);
+  std::lock_guard lock{maps.mutex};
+  if (!maps.loose_geom_valid) {
+    /* Isolate task because a mutex is locked and the calculation is multi-threaded. */
+    blender::threading::isolate_task([&]() { mesh_loose_geom_calc(mesh, maps.loose_geom); });
+    maps.loose_geom_valid = true;
+  }
+  return &maps.loose_geom;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Mesh Runtime Struct Utils
  * \{ */
@@ -89,8 +261,11 @@ void BKE_mesh_runtime_reset_on_copy(Mesh *mesh, const int UNUSED(flag))
 
   runtime->vert_normals_dirty = true;
   runtime->poly_normals_dirty = true;
+  runtime->looptris_positions_dirty = false;
   runtime->vert_normals = nullptr;
   runtime->poly_normals = nullptr;
+  runtime->topology_maps = nullptr;
+  runtime->looptris_sharing_info = nullptr;
 
   mesh_runtime_init_mutexes(mesh);
 }
@@ -108,6 +283,97 @@ void BKE_mesh_runtime_clear_cache(Mesh *mesh)
   BKE_mesh_clear_derived_normals(mesh);
 }
 
+struct MeshLoopTrisSharing : public blender::ImplicitSharingInfo {
+  MLoopTri *array;
+
+  MeshLoopTrisSharing(MLoopTri *array) : array(array)
+  {
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    MEM_freeN(array);
+    MEM_delete(this);
+  }
+};
+
+/**
+ * Make the triangulation of the mesh shareable. The mesh is const for the caller, so it can be
+ * copied from multiple threads at the same time.
+ */
+static const MeshLoopTrisSharing *mesh_looptris_ensure_sharing(Mesh *mesh)
+{
+  if (mesh->runtime.looptris_sharing_info != nullptr) {
+    return mesh->runtime.looptris_sharing_info;
+  }
+  MeshLoopTrisSharing *sharing_info = MEM_new<MeshLoopTrisSharing>(__func__,
+                                                                   mesh->runtime.looptris.array);
+  if (atomic_cas_ptr((void **)&mesh->runtime.looptris_sharing_info, nullptr, sharing_info) !=
+      nullptr) {
+    /* Another thread made the array shareable first, the data is not owned by this info. */
+    MEM_delete(sharing_info);
+    return mesh->runtime.looptris_sharing_info;
+  }
+  return sharing_info;
+}
+
+/** Make sure the mesh owns its triangulation, copying it when it is still used by other meshes. */
+static void mesh_looptris_unshare(Mesh *mesh)
+{
+  const MeshLoopTrisSharing *sharing_info = mesh->runtime.looptris_sharing_info;
+  if (sharing_info == nullptr) {
+    return;
+  }
+  if (sharing_info->is_mutable()) {
+    /* This is the last user, take over the ownership of the array. */
+    MEM_delete(sharing_info);
+  }
+  else {
+    mesh->runtime.looptris.array = static_cast<MLoopTri *>(
+        MEM_dupallocN(mesh->runtime.looptris.array));
+    sharing_info->remove_user_and_delete_if_last();
+  }
+  mesh->runtime.looptris_sharing_info = nullptr;
+}
+
+/** Drop the reference to a shared triangulation, the array is freed by its last user. */
+static void mesh_looptris_release_shared(Mesh *mesh)
+{
+  const MeshLoopTrisSharing *sharing_info = mesh->runtime.looptris_sharing_info;
+  if (sharing_info == nullptr) {
+    return;
+  }
+  sharing_info->remove_user_and_delete_if_last();
+  mesh->runtime.looptris.array = nullptr;
+  mesh->runtime.looptris.len = 0;
+  mesh->runtime.looptris.len_alloc = 0;
+  mesh->runtime.looptris_sharing_info = nullptr;
+}
+
+void BKE_mesh_runtime_looptris_share(Mesh *mesh_dst, const Mesh *mesh_src)
+{
+  const MLoopTri_Store &looptris_src = mesh_src->runtime.looptris;
+  if (looptris_src.array == nullptr || mesh_src->runtime.looptris_positions_dirty) {
+    return;
+  }
+  const int looptris_len = poly_to_tri_count(mesh_dst->totpoly, mesh_dst->totloop);
+  if (looptris_src.len != looptris_len) {
+    return;
+  }
+  BLI_assert(mesh_dst->runtime.looptris.array == nullptr);
+  const MeshLoopTrisSharing *sharing_info = mesh_looptris_ensure_sharing(
+      const_cast<Mesh *>(mesh_src));
+  sharing_info->add_user();
+
+  MLoopTri_Store &looptris_dst = mesh_dst->runtime.looptris;
+  looptris_dst.array = sharing_info->array;
+  looptris_dst.len = looptris_len;
+  looptris_dst.len_alloc = looptris_len;
+  mesh_dst->runtime.looptris_sharing_info = sharing_info;
+  mesh_dst->runtime.looptris_positions_dirty = false;
+}
+
 /**
  * Ensure the array is large enough
  *
@@ -122,6 +388,9 @@ static void mesh_ensure_looptri_data(Mesh *mesh)
 
   BLI_assert(mesh->runtime.looptris.array_wip == nullptr);
 
+  /* A shared array can't be reused as work buffer, other meshes still read it. */
+  mesh_looptris_release_shared(mesh);
+
   SWAP(MLoopTri *, mesh->runtime.looptris.array, mesh->runtime.looptris.array_wip);
 
   if ((looptris_len > mesh->runtime.looptris.len_alloc) ||
@@ -153,6 +422,7 @@ void BKE_mesh_runtime_looptri_recalc(Mesh *mesh)
                           mesh->totloop,
                           mesh->totpoly,
                           mesh->runtime.looptris.array_wip);
+  mesh->runtime.looptris_positions_dirty = false;
 
   BLI_assert(mesh->runtime.looptris.array == nullptr);
   atomic_cas_ptr((void **)&mesh->runtime.looptris.array,
@@ -176,7 +446,25 @@ const MLoopTri *BKE_mesh_runtime_looptri_ensure(const Mesh *mesh)
 
   MLoopTri *looptri = mesh->runtime.looptris.array;
 
-  if (looptri != nullptr) {
+  if (looptri != nullptr && mesh->runtime.looptris_positions_dirty) {
+    if (mesh->runtime.looptris.len == poly_to_tri_count(mesh->totpoly, mesh->totloop)) {
+      /* Only the tessellation of quads and n-gons depends on positions, update it in place. */
+      mesh_looptris_unshare(const_cast<Mesh *>(mesh));
+      looptri = mesh->runtime.looptris.array;
+      blender::threading::isolate_task([&]() {
+        BKE_mesh_recalc_looptri_positions(
+            mesh->mloop, mesh->mpoly, mesh->mvert, mesh->totloop, mesh->totpoly, looptri);
+      });
+      const_cast<Mesh *>(mesh)->runtime.looptris_positions_dirty = false;
+    }
+    else {
+      /* The topology changed without clearing the geometry caches. */
+      blender::threading::isolate_task(
+          [&]() { BKE_mesh_runtime_looptri_recalc(const_cast<Mesh *>(mesh)); });
+      looptri = mesh->runtime.looptris.array;
+    }
+  }
+  else if (looptri != nullptr) {
     BLI_assert(BKE_mesh_runtime_looptri_len(mesh) == mesh->runtime.looptris.len);
   }
   else {
@@ -247,6 +535,7 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
     bvhcache_free(mesh->runtime.bvh_cache);
     mesh->runtime.bvh_cache = nullptr;
   }
+  mesh_looptris_release_shared(mesh);
   MEM_SAFE_FREE(mesh->runtime.looptris.array);
   /* TODO(sergey): Does this really belong here? */
   if (mesh->runtime.subdiv_ccg != nullptr) {
@@ -254,6 +543,7 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
     mesh->runtime.subdiv_ccg = nullptr;
   }
   BKE_shrinkwrap_discard_boundary_data(mesh);
+  mesh_topology_maps_free(mesh);
 }
 
 /** \} */
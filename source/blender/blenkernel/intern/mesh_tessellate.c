@@ -536,13 +536,18 @@ static void mesh_calc_tessellation_for_face_with_normal(const MLoop *mloop,
       mloop, mpoly, mvert, poly_index, mlt, pf_arena_p, true, normal_precalc);
 }
 
+/**
+ * \param skip_tris: Leave the triangles of \a mlooptri untouched, when updating an existing
+ * tessellation after vertex positions changed, since only quads and n-gons depend on positions.
+ */
 static void mesh_recalc_looptri__single_threaded(const MLoop *mloop,
                                                  const MPoly *mpoly,
                                                  const MVert *mvert,
                                                  int totloop,
                                                  int totpoly,
                                                  MLoopTri *mlooptri,
-                                                 const float (*poly_normals)[3])
+                                                 const float (*poly_normals)[3],
+                                                 const bool skip_tris)
 {
   MemArena *pf_arena = NULL;
   const MPoly *mp = mpoly;
@@ -550,6 +555,10 @@ static void mesh_recalc_looptri__single_threaded(const MLoop *mloop,
 
   if (poly_normals != NULL) {
     for (uint poly_index = 0; poly_index < (uint)totpoly; poly_index++, mp++) {
+      if (skip_tris && mp->totloop == 3) {
+        tri_index++;
+        continue;
+      }
       mesh_calc_tessellation_for_face_with_normal(mloop,
                                                   mpoly,
                                                   mvert,
@@ -562,6 +571,10 @@ static void mesh_recalc_looptri__single_threaded(const MLoop *mloop,
   }
   else {
     for (uint poly_index = 0; poly_index < (uint)totpoly; poly_index++, mp++) {
+      if (skip_tris && mp->totloop == 3) {
+        tri_index++;
+        continue;
+      }
       mesh_calc_tessellation_for_face(
           mloop, mpoly, mvert, poly_index, &mlooptri[tri_index], &pf_arena);
       tri_index += (uint)(mp->totloop - 2);
@@ -586,6 +599,9 @@ struct TessellationUserData {
 
   /** Optional pre-calculated polygon normals array. */
   const float (*poly_normals)[3];
+
+  /** Only update quads and n-gons, see #mesh_recalc_looptri__single_threaded. */
+  bool skip_tris;
 };
 
 struct TessellationUserTLS {
@@ -597,6 +613,9 @@ static void mesh_calc_tessellation_for_face_fn(void *__restrict userdata,
                                                const TaskParallelTLS *__restrict tls)
 {
   const struct TessellationUserData *data = userdata;
+  if (data->skip_tris && data->mpoly[index].totloop == 3) {
+    return;
+  }
   struct TessellationUserTLS *tls_data = tls->userdata_chunk;
   const int tri_index = poly_to_tri_count(index, data->mpoly[index].loopstart);
   mesh_calc_tessellation_for_face_impl(data->mloop,
@@ -614,6 +633,9 @@ static void mesh_calc_tessellation_for_face_with_normal_fn(void *__restrict user
                                                            const TaskParallelTLS *__restrict tls)
 {
   const struct TessellationUserData *data = userdata;
+  if (data->skip_tris && data->mpoly[index].totloop == 3) {
+    return;
+  }
   struct TessellationUserTLS *tls_data = tls->userdata_chunk;
   const int tri_index = poly_to_tri_count(index, data->mpoly[index].loopstart);
   mesh_calc_tessellation_for_face_impl(data->mloop,
@@ -641,7 +663,8 @@ static void mesh_recalc_looptri__multi_threaded(const MLoop *mloop,
                                                 int UNUSED(totloop),
                                                 int totpoly,
                                                 MLoopTri *mlooptri,
-                                                const float (*poly_normals)[3])
+                                                const float (*poly_normals)[3],
+                                                const bool skip_tris)
 {
   struct TessellationUserTLS tls_data_dummy = {NULL};
 
@@ -651,6 +674,7 @@ static void mesh_recalc_looptri__multi_threaded(const MLoop *mloop,
       .mvert = mvert,
       .mlooptri = mlooptri,
       .poly_normals = poly_normals,
+      .skip_tris = skip_tris,
   };
 
   TaskParallelSettings settings;
@@ -677,10 +701,29 @@ void BKE_mesh_recalc_looptri(const MLoop *mloop,
                              MLoopTri *mlooptri)
 {
   if (totloop < MESH_FACE_TESSELLATE_THREADED_LIMIT) {
-    mesh_recalc_looptri__single_threaded(mloop, mpoly, mvert, totloop, totpoly, mlooptri, NULL);
+    mesh_recalc_looptri__single_threaded(
+        mloop, mpoly, mvert, totloop, totpoly, mlooptri, NULL, false);
+  }
+  else {
+    mesh_recalc_looptri__multi_threaded(
+        mloop, mpoly, mvert, totloop, totpoly, mlooptri, NULL, false);
+  }
+}
+
+void BKE_mesh_recalc_looptri_positions(const MLoop *mloop,
+                                       const MPoly *mpoly,
+                                       const MVert *mvert,
+                                       int totloop,
+                                       int totpoly,
+                                       MLoopTri *mlooptri)
+{
+  if (totloop < MESH_FACE_TESSELLATE_THREADED_LIMIT) {
+    mesh_recalc_looptri__single_threaded(
+        mloop, mpoly, mvert, totloop, totpoly, mlooptri, NULL, true);
   }
   else {
-    mesh_recalc_looptri__multi_threaded(mloop, mpoly, mvert, totloop, totpoly, mlooptri, NULL);
+    mesh_recalc_looptri__multi_threaded(
+        mloop, mpoly, mvert, totloop, totpoly, mlooptri, NULL, true);
   }
 }
 
@@ -695,11 +738,11 @@ void BKE_mesh_recalc_looptri_with_normals(const MLoop *mloop,
   BLI_assert(poly_normals != NULL);
   if (totloop < MESH_FACE_TESSELLATE_THREADED_LIMIT) {
     mesh_recalc_looptri__single_threaded(
-        mloop, mpoly, mvert, totloop, totpoly, mlooptri, poly_normals);
+        mloop, mpoly, mvert, totloop, totpoly, mlooptri, poly_normals, false);
   }
   else {
     mesh_recalc_looptri__multi_threaded(
-        mloop, mpoly, mvert, totloop, totpoly, mlooptri, poly_normals);
+        mloop, mpoly, mvert, totloop, totpoly, mlooptri, poly_normals, false);
   }
 }
 
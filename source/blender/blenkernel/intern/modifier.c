@@ -34,6 +34,7 @@
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
+#include "BLI_profile.h"
 #include "BLI_session_uuid.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
@@ -1002,7 +1003,12 @@ struct Mesh *BKE_modifier_modify_mesh(ModifierData *md,
   if (mti->dependsOnNormals && mti->dependsOnNormals(md)) {
     modwrap_dependsOnNormals(me);
   }
-  return mti->modifyMesh(md, ctx, me);
+
+  Mesh *result;
+  BLI_PROFILE_SCOPE_BEGIN("Modifier");
+  result = mti->modifyMesh(md, ctx, me);
+  BLI_PROFILE_SCOPE_END(md->name);
+  return result;
 }
 
 void BKE_modifier_deform_verts(ModifierData *md,
@@ -1015,7 +1021,9 @@ void BKE_modifier_deform_verts(ModifierData *md,
   if (me && mti->dependsOnNormals && mti->dependsOnNormals(md)) {
     modwrap_dependsOnNormals(me);
   }
+  BLI_PROFILE_SCOPE_BEGIN("Modifier");
   mti->deformVerts(md, ctx, me, vertexCos, numVerts);
+  BLI_PROFILE_SCOPE_END(md->name);
 }
 
 void BKE_modifier_deform_vertsEM(ModifierData *md,
@@ -1029,7 +1037,9 @@ void BKE_modifier_deform_vertsEM(ModifierData *md,
   if (me && mti->dependsOnNormals && mti->dependsOnNormals(md)) {
     BKE_mesh_calc_normals(me);
   }
+  BLI_PROFILE_SCOPE_BEGIN("Modifier");
   mti->deformVertsEM(md, ctx, em, me, vertexCos, numVerts);
+  BLI_PROFILE_SCOPE_END(md->name);
 }
 
 /* end modifier callback wrappers */
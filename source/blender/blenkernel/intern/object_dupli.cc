@@ -86,6 +86,8 @@ struct DupliContext {
   int level;
 
   const struct DupliGenerator *gen;
+  /** Hash of the name of #object, used for the random id of instances of other objects. */
+  uint object_name_hash;
 
   /** Result containers. */
   ListBase *duplilist; /* Legacy doubly-linked list. */
@@ -98,6 +100,20 @@ struct DupliGenerator {
 
 static const DupliGenerator *get_dupli_generator(const DupliContext *ctx);
 
+static uint dupli_object_name_hash(const Object *ob)
+{
+  return BLI_hash_int(BLI_hash_string(ob->id.name + 2));
+}
+
+/**
+ * Cheap check to avoid creating a sub-context for every instance of an object that can't
+ * generate instances itself, see #get_dupli_generator.
+ */
+static bool object_may_generate_duplis(const Object *ob)
+{
+  return (ob->transflag & OB_DUPLI) || ob->runtime.geometry_set_eval != nullptr;
+}
+
 /**
  * Create initial context for root object.
  */
@@ -124,6 +140,7 @@ static void init_context(DupliContext *r_ctx,
   r_ctx->level = 0;
 
   r_ctx->gen = get_dupli_generator(r_ctx);
+  r_ctx->object_name_hash = r_ctx->gen ? dupli_object_name_hash(ob) : 0;
 
   r_ctx->duplilist = nullptr;
 }
@@ -156,6 +173,9 @@ static bool copy_dupli_context(
   }
 
   r_ctx->gen = get_dupli_generator(r_ctx);
+  if (r_ctx->gen && ob != ctx->object) {
+    r_ctx->object_name_hash = dupli_object_name_hash(ob);
+  }
   return true;
 }
 
@@ -220,7 +240,7 @@ static DupliObject *make_dupli(const DupliContext *ctx,
   }
 
   if (ctx->object != ob) {
-    dob->random_id ^= BLI_hash_int(BLI_hash_string(ctx->object->id.name + 2));
+    dob->random_id ^= ctx->object_name_hash;
   }
 
   return dob;
@@ -236,6 +256,11 @@ static void make_recursive_duplis(const DupliContext *ctx,
                                   const float space_mat[4][4],
                                   int index)
 {
+  /* Objects that are already on the instance stack generate instances, so checking this first
+   * doesn't skip the warning below. */
+  if (!object_may_generate_duplis(ob)) {
+    return;
+  }
   if (ctx->instance_stack->contains(ob)) {
     /* Avoid recursive instances. */
     printf("Warning: '%s' object is trying to instance itself.\n", ob->id.name + 2);
@@ -835,10 +860,12 @@ static void make_duplis_geometry_set_impl(const DupliContext *ctx,
         mul_m4_m4m4(matrix, parent_transform, instance_offset_matrices[i].values);
         make_dupli(instances_ctx, &object, matrix, id);
 
-        float space_matrix[4][4];
-        mul_m4_m4m4(space_matrix, instance_offset_matrices[i].values, object.imat);
-        mul_m4_m4_pre(space_matrix, parent_transform);
-        make_recursive_duplis(instances_ctx, &object, space_matrix, id);
+        if (object_may_generate_duplis(&object)) {
+          float space_matrix[4][4];
+          mul_m4_m4m4(space_matrix, instance_offset_matrices[i].values, object.imat);
+          mul_m4_m4_pre(space_matrix, parent_transform);
+          make_recursive_duplis(instances_ctx, &object, space_matrix, id);
+        }
         break;
       }
       case InstanceReference::Type::Collection: {
@@ -184,7 +184,8 @@ float BKE_ocean_jminus_to_foam(float jminus, float coverage)
   return foam;
 }
 
-void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float v)
+/* Needs the ocean mutex to be locked for reading. */
+static void ocean_eval_uv_locked(struct Ocean *oc, struct OceanResult *ocr, float u, float v)
 {
   int i0, i1, j0, j1;
   float frac_x, frac_z;
@@ -201,8 +202,6 @@ void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float
     v += 1.0f;
   }
 
-  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
-
   uu = u * oc->_M;
   vv = v * oc->_N;
 
@@ -251,7 +250,24 @@ void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float
     }
   }
 #  undef BILERP
+}
+
+void BKE_ocean_eval_uv(struct Ocean *oc, struct OceanResult *ocr, float u, float v)
+{
+  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
+  ocean_eval_uv_locked(oc, ocr, u, v);
+  BLI_rw_mutex_unlock(&oc->oceanmutex);
+}
 
+void BKE_ocean_eval_uv_array(struct Ocean *oc,
+                             struct OceanResult *r_ocr,
+                             const float (*uv)[2],
+                             const int uv_num)
+{
+  BLI_rw_mutex_lock(&oc->oceanmutex, THREAD_LOCK_READ);
+  for (int i = 0; i < uv_num; i++) {
+    ocean_eval_uv_locked(oc, &r_ocr[i], uv[i][0], uv[i][1]);
+  }
   BLI_rw_mutex_unlock(&oc->oceanmutex);
 }
 
@@ -1569,6 +1585,14 @@ void BKE_ocean_eval_uv(struct Ocean *UNUSED(oc),
 {
 }
 
+void BKE_ocean_eval_uv_array(struct Ocean *oc,
+                             struct OceanResult *r_ocr,
+                             const float (*uv)[2],
+                             const int uv_num)
+{
+  UNUSED_VARS(oc, r_ocr, uv, uv_num);
+}
+
 /* use catmullrom interpolation rather than linear */
 void BKE_ocean_eval_uv_catrom(struct Ocean *UNUSED(oc),
                               struct OceanResult *UNUSED(ocr),
@@ -2702,10 +2702,31 @@ void psys_find_parents(ParticleSimulationData *sim, const bool use_render_params
 
   BLI_kdtree_3d_balance(tree);
 
-  for (; p < totchild; p++, cpa++) {
-    psys_particle_on_emitter(
-        sim->psmd, from, cpa->num, DMCACHE_ISCHILD, cpa->fuv, cpa->foffset, co, 0, 0, 0, orco);
-    cpa->parent = BLI_kdtree_3d_find_nearest(tree, orco, NULL);
+  /* Look up the parents of all remaining children at once, that runs in parallel. */
+  const int children_num = totchild - p;
+  if (children_num > 0) {
+    float(*child_orcos)[3] = MEM_mallocN(sizeof(*child_orcos) * children_num, __func__);
+    KDTreeNearest_3d *nearest = MEM_mallocN(sizeof(*nearest) * children_num, __func__);
+    for (int i = 0; i < children_num; i++) {
+      ChildParticle *child = &cpa[i];
+      psys_particle_on_emitter(sim->psmd,
+                               from,
+                               child->num,
+                               DMCACHE_ISCHILD,
+                               child->fuv,
+                               child->foffset,
+                               co,
+                               0,
+                               0,
+                               0,
+                               child_orcos[i]);
+    }
+    BLI_kdtree_3d_find_nearest_array(tree, child_orcos, (uint)children_num, nearest);
+    for (int i = 0; i < children_num; i++) {
+      cpa[i].parent = nearest[i].index;
+    }
+    MEM_freeN(child_orcos);
+    MEM_freeN(nearest);
   }
 
   BLI_kdtree_3d_free(tree);
@@ -3806,6 +3806,49 @@ static void dynamics_step_sph_classical_integrate_task_cb_ex(void *__restrict us
   }
 }
 
+static void dynamics_step_newton_integrate_task_cb_ex(
+    void *__restrict userdata, const int p, const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DynamicStepSolverTaskData *data = userdata;
+  ParticleSimulationData *sim = data->sim;
+  ParticleSystem *psys = sim->psys;
+
+  ParticleData *pa;
+
+  if ((pa = psys->particles + p)->state.time <= 0.0f) {
+    return;
+  }
+
+  basic_integrate(sim, p, pa->state.time, data->cfra);
+}
+
+/**
+ * Whether the particles can be integrated in parallel. Two cases have to stay serial to remain
+ * deterministic:
+ * - Integration draws from shared random number generators for brownian motion and for the noise
+ *   of force fields, so the result depends on the order in which particles are processed.
+ * - With #PART_SELF_EFFECT the system is one of its own effectors. Evaluating it reads the state
+ *   of other particles, which other threads are writing at the same time.
+ */
+static bool dynamics_step_newton_use_threading(ParticleSimulationData *sim)
+{
+  if (sim->psys->part->brownfac != 0.0f) {
+    return false;
+  }
+  if (sim->psys->effectors == NULL) {
+    return true;
+  }
+  LISTBASE_FOREACH (EffectorCache *, eff, sim->psys->effectors) {
+    if (eff->psys == sim->psys) {
+      return false;
+    }
+    if (eff->pd && eff->pd->f_noise > 0.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /* unbaked particles are calculated dynamically */
 static void dynamics_step(ParticleSimulationData *sim, float cfra)
 {
@@ -3934,6 +3977,32 @@ static void dynamics_step(ParticleSimulationData *sim, float cfra)
 
   switch (part->phystype) {
     case PART_PHYS_NEWTON: {
+      if (psys->totpart > 100 && dynamics_step_newton_use_threading(sim)) {
+        DynamicStepSolverTaskData task_data = {
+            .sim = sim,
+            .cfra = cfra,
+            .timestep = timestep,
+            .dtime = dtime,
+        };
+
+        TaskParallelSettings settings;
+        BLI_parallel_range_settings_defaults(&settings);
+        BLI_task_parallel_range(
+            0, psys->totpart, &task_data, dynamics_step_newton_integrate_task_cb_ex, &settings);
+
+        /* Collision response uses the shared random number generator, so it stays serial and
+         * in particle order. */
+        LOOP_DYNAMIC_PARTICLES
+        {
+          if (sim->colliders) {
+            collision_check(sim, p, pa->state.time, cfra);
+          }
+
+          basic_rotate(part, pa, pa->state.time, timestep);
+        }
+        break;
+      }
+
       LOOP_DYNAMIC_PARTICLES
       {
         /* do global forces & effectors */
@@ -1053,6 +1053,14 @@ static void pbvh_update_normals_accum_task_cb(void *__restrict userdata,
       };
       const int sides = 3;
 
+      /* Triangles at the edge of the brush often have no vertices to update, skip them to avoid
+       * computing face normals that are not used. */
+      if (!BLI_BITMAP_TEST(pbvh->vert_bitmap, vtri[0]) &&
+          !BLI_BITMAP_TEST(pbvh->vert_bitmap, vtri[1]) &&
+          !BLI_BITMAP_TEST(pbvh->vert_bitmap, vtri[2])) {
+        continue;
+      }
+
       /* Face normal and mask */
       if (lt->poly != mpoly_prev) {
         const MPoly *mp = &pbvh->mpoly[lt->poly];
@@ -2087,6 +2087,21 @@ void BKE_pbvh_bmesh_after_stroke(PBVH *pbvh)
   }
 }
 
+bool BKE_pbvh_bmesh_needs_rebuild(const PBVH *pbvh)
+{
+  int totleaf = 0;
+  for (int i = 0; i < pbvh->totnode; i++) {
+    if (pbvh->nodes[i].flag & PBVH_Leaf) {
+      totleaf++;
+    }
+  }
+
+  /* Building only splits leaves that exceed `leaf_limit` faces, while edge collapses remove faces
+   * from leaves without ever merging them. Rebuild once the average drops well below the limit. */
+  const int min_average_faces = pbvh->leaf_limit / 4;
+  return totleaf > 1 && (int64_t)totleaf * min_average_faces > pbvh->bm->totface;
+}
+
 void BKE_pbvh_bmesh_detail_size_set(PBVH *pbvh, float detail_size)
 {
   pbvh->bm_max_edge_len = detail_size;
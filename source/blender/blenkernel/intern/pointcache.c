@@ -1627,32 +1627,81 @@ static int ptcache_file_write(PTCacheFile *pf, const void *f, unsigned int tot,
 {
   return (fwrite(f, size, tot, pf->fp) == tot);
 }
-static int ptcache_file_data_read(PTCacheFile *pf)
+/* Size of one point in an uncompressed file, where all data types of a point are interleaved. */
+static unsigned int ptcache_file_point_size(unsigned int data_types)
 {
-  int i;
+  unsigned int size = 0;
 
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    if ((pf->data_types & (1 << i)) &&
-        !ptcache_file_read(pf, pf->cur[i], 1, ptcache_data_size[i])) {
-      return 0;
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if (data_types & (1 << i)) {
+      size += ptcache_data_size[i];
     }
   }
 
-  return 1;
+  return size;
 }
-static int ptcache_file_data_write(PTCacheFile *pf)
+/* Read all points of an uncompressed frame with a single read, instead of one read per data
+ * type and point, and split the interleaved data into the arrays of `pm`. */
+static int ptcache_file_points_read(PTCacheFile *pf, PTCacheMem *pm)
 {
-  int i;
+  const unsigned int point_size = ptcache_file_point_size(pm->data_types);
+  unsigned char *buffer = MEM_mallocN((size_t)pm->totpoint * point_size, "PTCacheFile points");
 
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    if ((pf->data_types & (1 << i)) &&
-        !ptcache_file_write(pf, pf->cur[i], 1, ptcache_data_size[i])) {
-      return 0;
+  if (!ptcache_file_read(pf, buffer, pm->totpoint, point_size)) {
+    MEM_freeN(buffer);
+    return 0;
+  }
+
+  size_t offset = 0;
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if ((pm->data_types & (1 << i)) == 0) {
+      continue;
     }
+    const unsigned int size = ptcache_data_size[i];
+    const unsigned char *src = buffer + offset;
+    unsigned char *dst = pm->data[i];
+    for (unsigned int p = 0; p < pm->totpoint; p++) {
+      memcpy(dst, src, size);
+      dst += size;
+      src += point_size;
+    }
+    offset += size;
   }
 
+  MEM_freeN(buffer);
   return 1;
 }
+/* Interleave the arrays of `pm` per point and write them with a single write. */
+static int ptcache_file_points_write(PTCacheFile *pf, PTCacheMem *pm)
+{
+  const unsigned int point_size = ptcache_file_point_size(pm->data_types);
+  unsigned char *buffer = MEM_callocN((size_t)pm->totpoint * point_size, "PTCacheFile points");
+
+  size_t offset = 0;
+  for (int i = 0; i < BPHYS_TOT_DATA; i++) {
+    if ((pm->data_types & (1 << i)) == 0) {
+      continue;
+    }
+    const unsigned int size = ptcache_data_size[i];
+    const unsigned char *src = pm->data[i];
+    if (src == NULL) {
+      /* Leave the points zeroed when a data type has no array (see durian file 03.4b_comp). */
+      offset += size;
+      continue;
+    }
+    unsigned char *dst = buffer + offset;
+    for (unsigned int p = 0; p < pm->totpoint; p++) {
+      memcpy(dst, src, size);
+      src += size;
+      dst += point_size;
+    }
+    offset += size;
+  }
+
+  const int ok = ptcache_file_write(pf, buffer, pm->totpoint, point_size);
+  MEM_freeN(buffer);
+  return ok;
+}
 static int ptcache_file_header_begin_read(PTCacheFile *pf)
 {
   unsigned int typeflag = 0;
@@ -1819,18 +1868,6 @@ static void ptcache_data_free(PTCacheMem *pm)
     }
   }
 }
-static void ptcache_data_copy(void *from[], void *to[])
-{
-  int i;
-  for (i = 0; i < BPHYS_TOT_DATA; i++) {
-    /* NOTE: durian file 03.4b_comp crashes if to[i] is not tested
-     * its NULL, not sure if this should be fixed elsewhere but for now its needed */
-    if (from[i] && to[i]) {
-      memcpy(to[i], from[i], ptcache_data_size[i]);
-    }
-  }
-}
-
 static void ptcache_extra_free(PTCacheMem *pm)
 {
   PTCacheExtra *extra = pm->extradata.first;
@@ -1960,19 +1997,8 @@ static PTCacheMem *ptcache_disk_frame_to_mem(PTCacheID *pid, int cfra)
         }
       }
     }
-    else {
-      void *cur[BPHYS_TOT_DATA];
-      BKE_ptcache_mem_pointers_init(pm, cur);
-      ptcache_file_pointers_init(pf);
-
-      for (i = 0; i < pm->totpoint; i++) {
-        if (!ptcache_file_data_read(pf)) {
-          error = 1;
-          break;
-        }
-        ptcache_data_copy(pf->cur, cur);
-        BKE_ptcache_mem_pointers_incr(cur);
-      }
+    else if (!ptcache_file_points_read(pf, pm)) {
+      error = 1;
     }
   }
 
@@ -2062,19 +2088,8 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
         }
       }
     }
-    else {
-      void *cur[BPHYS_TOT_DATA];
-      BKE_ptcache_mem_pointers_init(pm, cur);
-      ptcache_file_pointers_init(pf);
-
-      for (i = 0; i < pm->totpoint; i++) {
-        ptcache_data_copy(cur, pf->cur);
-        if (!ptcache_file_data_write(pf)) {
-          error = 1;
-          break;
-        }
-        BKE_ptcache_mem_pointers_incr(cur);
-      }
+    else if (!ptcache_file_points_write(pf, pm)) {
+      error = 1;
     }
   }
 
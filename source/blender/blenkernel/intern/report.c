@@ -258,6 +258,9 @@ char *BKE_reports_string(ReportList *reports, eReportType level)
 
 bool BKE_reports_print_test(const ReportList *reports, eReportType type)
 {
+  if (reports && (reports->flag & RPT_PRINT_HANDLED_BY_OWNER)) {
+    return false;
+  }
   /* In background mode always print otherwise there are cases the errors won't be displayed,
    * but still add to the report list since this is used for python exception handling. */
   return (G.background || (reports == NULL) ||
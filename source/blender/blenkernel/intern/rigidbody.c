@@ -1660,8 +1660,34 @@ static void rigidbody_update_sim_world(Scene *scene, RigidBodyWorld *rbw)
   rigidbody_update_ob_array(rbw);
 }
 
-static void rigidbody_update_sim_ob(
-    Depsgraph *depsgraph, Scene *scene, RigidBodyWorld *rbw, Object *ob, RigidBodyOb *rbo)
+/**
+ * Force fields with noise reseed their random number generator whenever an effector list is
+ * created, every body then has to create its own list to keep getting the same noise.
+ */
+static bool rigidbody_effectors_are_shareable(const ListBase *effectors)
+{
+  if (effectors == NULL) {
+    return true;
+  }
+  LISTBASE_FOREACH (const EffectorCache *, eff, effectors) {
+    if (eff->pd->f_noise > 0.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * \param shared_effectors: Effectors of the world, or NULL when `use_shared_effectors` is false
+ * and every body has to create its own list.
+ */
+static void rigidbody_update_sim_ob(Depsgraph *depsgraph,
+                                    Scene *scene,
+                                    RigidBodyWorld *rbw,
+                                    Object *ob,
+                                    RigidBodyOb *rbo,
+                                    ListBase *shared_effectors,
+                                    const bool use_shared_effectors)
 {
   /* only update if rigid body exists */
   if (rbo->shared->physics_object == NULL) {
@@ -1721,7 +1747,9 @@ static void rigidbody_update_sim_ob(
     ListBase *effectors;
 
     /* get effectors present in the group specified by effector_weights */
-    effectors = BKE_effectors_create(depsgraph, ob, NULL, effector_weights, false);
+    effectors = use_shared_effectors ?
+                    shared_effectors :
+                    BKE_effectors_create(depsgraph, ob, NULL, effector_weights, false);
     if (effectors) {
       float eff_force[3] = {0.0f, 0.0f, 0.0f};
       float eff_loc[3], eff_vel[3];
@@ -1756,7 +1784,9 @@ static void rigidbody_update_sim_ob(
     }
 
     /* cleanup */
-    BKE_effectors_free(effectors);
+    if (!use_shared_effectors) {
+      BKE_effectors_free(effectors);
+    }
   }
   /* NOTE: passive objects don't need to be updated since they don't move */
 
@@ -1804,6 +1834,15 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
     FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
   }
 
+  /* The bodies that are affected by effectors are no effectors themselves, so they all get the
+   * same list and it only has to be created once instead of once per body. */
+  ListBase *effectors = BKE_effectors_create(depsgraph, NULL, NULL, rbw->effector_weights, false);
+  const bool use_shared_effectors = rigidbody_effectors_are_shareable(effectors);
+  if (!use_shared_effectors) {
+    BKE_effectors_free(effectors);
+    effectors = NULL;
+  }
+
   /* update objects */
   FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (rbw->group, ob) {
     if (ob->type == OB_MESH) {
@@ -1854,11 +1893,13 @@ static void rigidbody_update_simulation(Depsgraph *depsgraph,
       rbo->flag &= ~(RBO_FLAG_NEEDS_VALIDATE | RBO_FLAG_NEEDS_RESHAPE);
 
       /* update simulation object... */
-      rigidbody_update_sim_ob(depsgraph, scene, rbw, ob, rbo);
+      rigidbody_update_sim_ob(depsgraph, scene, rbw, ob, rbo, effectors, use_shared_effectors);
     }
   }
   FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
 
+  BKE_effectors_free(effectors);
+
   /* update constraints */
   if (rbw->constraints == NULL) { /* no constraints, move on */
     return;
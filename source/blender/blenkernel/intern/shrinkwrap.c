@@ -85,6 +85,8 @@ typedef struct ShrinkwrapCalcCBData {
 
   float *proj_axis;
   SpaceTransform *local2aux;
+  /** Upper bound of the ray length in the target spaces, for the projection limit. */
+  float proj_limit_ray_dist;
 } ShrinkwrapCalcCBData;
 
 bool BKE_shrinkwrap_needs_normals(int shrinkType, int shrinkMode)
@@ -535,7 +537,7 @@ static void shrinkwrap_calc_normal_projection_cb_ex(void *__restrict userdata,
   hit->index = -1;
 
   /* TODO: we should use FLT_MAX here, but sweepsphere code isn't prepared for that */
-  hit->dist = BVH_RAYCAST_DIST_MAX;
+  hit->dist = data->proj_limit_ray_dist;
 
   bool is_aux = false;
 
@@ -678,6 +680,23 @@ static void shrinkwrap_calc_normal_projection(ShrinkwrapCalcData *calc)
     aux_tree = &aux_tree_stack;
   }
 
+  /* Hits further away than the projection limit are discarded, so don't trace rays beyond it.
+   * The exact limit is still checked in local space, the ray length is in the target spaces,
+   * so scale it by an upper bound of the space transforms scale (the Frobenius norm). */
+  float proj_limit_ray_dist = BVH_RAYCAST_DIST_MAX;
+  if (calc->smd->projLimit != 0.0f) {
+    float scale = len_squared_v3(calc->local2target.local2target[0]) +
+                  len_squared_v3(calc->local2target.local2target[1]) +
+                  len_squared_v3(calc->local2target.local2target[2]);
+    if (aux_tree) {
+      scale = max_ff(scale,
+                     len_squared_v3(local2aux.local2target[0]) +
+                         len_squared_v3(local2aux.local2target[1]) +
+                         len_squared_v3(local2aux.local2target[2]));
+    }
+    proj_limit_ray_dist = min_ff(calc->smd->projLimit * sqrtf(scale), BVH_RAYCAST_DIST_MAX);
+  }
+
   /* After successfully build the trees, start projection vertices. */
   ShrinkwrapCalcCBData data = {
       .calc = calc,
@@ -685,6 +704,7 @@ static void shrinkwrap_calc_normal_projection(ShrinkwrapCalcData *calc)
       .aux_tree = aux_tree,
       .proj_axis = proj_axis,
       .local2aux = &local2aux,
+      .proj_limit_ray_dist = proj_limit_ray_dist,
   };
   TaskParallelSettings settings;
   BLI_parallel_range_settings_defaults(&settings);
@@ -709,6 +709,15 @@ bool BKE_autotrack_context_step(AutoTrackContext *context)
     return false;
   }
 
+  /* Decode the frames which are about to be tracked once, before all markers are requesting
+   * them from the threads. */
+  const int frame_delta = context->is_backwards ? -1 : 1;
+  for (int i = 0; i < context->num_autotrack_markers; i++) {
+    const libmv_Marker *libmv_marker = &context->autotrack_markers[i].libmv_marker;
+    tracking_image_accessor_prefetch_frame(
+        context->image_accessor, libmv_marker->clip, libmv_marker->frame + frame_delta);
+  }
+
   AutoTrackTLS tls;
   BLI_listbase_clear(&tls.results);
 
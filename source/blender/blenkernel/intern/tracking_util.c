@@ -596,6 +596,67 @@ MovieTrackingMarker *tracking_get_keyframed_marker(MovieTrackingTrack *track,
 /** \name Frame Accessor
  * \{ */
 
+/* Look up the frame in the accessor's cache, the returned buffer is referenced. */
+static ImBuf *accessor_cached_frame_get(TrackingImageAccessor *accessor,
+                                       int clip_index,
+                                       int frame)
+{
+  ImBuf *ibuf = NULL;
+
+  BLI_spin_lock(&accessor->cache_lock);
+  for (int i = 0; i < MAX_ACCESSOR_CACHED_FRAMES; i++) {
+    TrackingImageAccessorFrame *cached_frame = &accessor->cached_frames[i];
+    if (cached_frame->ibuf != NULL && cached_frame->clip_index == clip_index &&
+        cached_frame->frame == frame) {
+      cached_frame->last_used = ++accessor->cache_use_counter;
+      ibuf = cached_frame->ibuf;
+      IMB_refImBuf(ibuf);
+      break;
+    }
+  }
+  BLI_spin_unlock(&accessor->cache_lock);
+
+  return ibuf;
+}
+
+/* Store the frame in the accessor's cache, replacing the least recently used one. */
+static void accessor_cached_frame_put(TrackingImageAccessor *accessor,
+                                      int clip_index,
+                                      int frame,
+                                      ImBuf *ibuf)
+{
+  ImBuf *evicted_ibuf = NULL;
+
+  BLI_spin_lock(&accessor->cache_lock);
+  TrackingImageAccessorFrame *slot = &accessor->cached_frames[0];
+  for (int i = 0; i < MAX_ACCESSOR_CACHED_FRAMES; i++) {
+    TrackingImageAccessorFrame *cached_frame = &accessor->cached_frames[i];
+    if (cached_frame->ibuf != NULL && cached_frame->clip_index == clip_index &&
+        cached_frame->frame == frame) {
+      /* Another thread has stored this frame already. */
+      slot = NULL;
+      break;
+    }
+    if (cached_frame->ibuf == NULL ||
+        (slot->ibuf != NULL && cached_frame->last_used < slot->last_used)) {
+      slot = cached_frame;
+    }
+  }
+  if (slot != NULL) {
+    evicted_ibuf = slot->ibuf;
+    IMB_refImBuf(ibuf);
+    slot->ibuf = ibuf;
+    slot->clip_index = clip_index;
+    slot->frame = frame;
+    slot->last_used = ++accessor->cache_use_counter;
+  }
+  BLI_spin_unlock(&accessor->cache_lock);
+
+  if (evicted_ibuf != NULL) {
+    IMB_freeImBuf(evicted_ibuf);
+  }
+}
+
 static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
                                              int clip_index,
                                              int frame)
@@ -607,6 +668,11 @@ static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
 
   BLI_assert(clip_index < accessor->num_clips);
 
+  ibuf = accessor_cached_frame_get(accessor, clip_index, frame);
+  if (ibuf != NULL) {
+    return ibuf;
+  }
+
   clip = accessor->clips[clip_index];
   scene_frame = BKE_movieclip_remap_clip_to_scene_frame(clip, frame);
   BKE_movieclip_user_set_frame(&user, scene_frame);
@@ -614,6 +680,10 @@ static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
   user.render_flag = 0;
   ibuf = BKE_movieclip_get_ibuf(clip, &user);
 
+  if (ibuf != NULL) {
+    accessor_cached_frame_put(accessor, clip_index, frame, ibuf);
+  }
+
   return ibuf;
 }
 
@@ -912,10 +982,25 @@ TrackingImageAccessor *tracking_image_accessor_new(MovieClip *clips[MAX_ACCESSOR
 
 void tracking_image_accessor_destroy(TrackingImageAccessor *accessor)
 {
+  for (int i = 0; i < MAX_ACCESSOR_CACHED_FRAMES; i++) {
+    if (accessor->cached_frames[i].ibuf != NULL) {
+      IMB_freeImBuf(accessor->cached_frames[i].ibuf);
+    }
+  }
   libmv_FrameAccessorDestroy(accessor->libmv_accessor);
   BLI_spin_end(&accessor->cache_lock);
   MEM_freeN(accessor->tracks);
   MEM_freeN(accessor);
 }
 
+void tracking_image_accessor_prefetch_frame(TrackingImageAccessor *accessor,
+                                            int clip_index,
+                                            int frame)
+{
+  ImBuf *ibuf = accessor_get_preprocessed_ibuf(accessor, clip_index, frame);
+  if (ibuf != NULL) {
+    IMB_freeImBuf(ibuf);
+  }
+}
+
 /** \} */
@@ -51,6 +51,11 @@
 
 #  include "ffmpeg_compat.h"
 
+/* Threaded pixel format conversion with #sws_scale_frame was added in FFmpeg 5.0. */
+#  if LIBSWSCALE_VERSION_INT >= AV_VERSION_INT(6, 1, 100)
+#    define FFMPEG_SWSCALE_THREADING
+#  endif
+
 struct StampData;
 
 typedef struct FFMpegContext {
@@ -113,6 +118,11 @@ static void ffmpeg_filepath_get(FFMpegContext *context,
 static void delete_picture(AVFrame *f)
 {
   if (f) {
+    if (f->buf[0]) {
+      /* Reference counted buffer, owned by FFmpeg. */
+      av_frame_free(&f);
+      return;
+    }
     if (f->data[0]) {
       MEM_freeN(f->data[0]);
     }
@@ -243,6 +253,60 @@ static AVFrame *alloc_picture(int pix_fmt, int width, int height)
   return f;
 }
 
+/* Allocate a frame for the pixel format conversion, which has to be reference counted when it is
+ * converted with #sws_scale_frame. */
+static AVFrame *alloc_convert_picture(int pix_fmt, int width, int height, int align)
+{
+#  ifdef FFMPEG_SWSCALE_THREADING
+  AVFrame *f = av_frame_alloc();
+  if (!f) {
+    return NULL;
+  }
+  f->format = pix_fmt;
+  f->width = width;
+  f->height = height;
+  if (av_frame_get_buffer(f, align) < 0) {
+    av_frame_free(&f);
+    return NULL;
+  }
+  return f;
+#  else
+  UNUSED_VARS(align);
+  return alloc_picture(pix_fmt, width, height);
+#  endif
+}
+
+static struct SwsContext *get_threaded_sws_context(int width,
+                                                   int height,
+                                                   int src_format,
+                                                   int dst_format)
+{
+#  ifdef FFMPEG_SWSCALE_THREADING
+  /* Let FFmpeg convert slices of the frame in parallel. */
+  struct SwsContext *c = sws_alloc_context();
+  if (c == NULL) {
+    return NULL;
+  }
+  av_opt_set_int(c, "srcw", width, 0);
+  av_opt_set_int(c, "srch", height, 0);
+  av_opt_set_int(c, "src_format", src_format, 0);
+  av_opt_set_int(c, "dstw", width, 0);
+  av_opt_set_int(c, "dsth", height, 0);
+  av_opt_set_int(c, "dst_format", dst_format, 0);
+  av_opt_set_int(c, "sws_flags", SWS_BICUBIC, 0);
+  av_opt_set_int(c, "threads", BLI_system_thread_count(), 0);
+
+  if (sws_init_context(c, NULL, NULL) < 0) {
+    sws_freeContext(c);
+    return NULL;
+  }
+  return c;
+#  else
+  return sws_getContext(
+      width, height, src_format, width, height, dst_format, SWS_BICUBIC, NULL, NULL, NULL);
+#  endif
+}
+
 /* Get the correct file extensions for the requested format,
  * first is always desired guess_format parameter */
 static const char **get_file_extensions(int format)
@@ -401,6 +465,19 @@ static AVFrame *generate_video_frame(FFMpegContext *context, const uint8_t *pixe
   /* Convert to the output pixel format, if it's different that Blender's internal one. */
   if (context->img_convert_frame != NULL) {
     BLI_assert(context->img_convert_ctx != NULL);
+#  ifdef FFMPEG_SWSCALE_THREADING
+    /* The encoder may still reference the previous frame. */
+    int ret = av_frame_make_writable(context->current_frame);
+    if (ret < 0) {
+      fprintf(stderr, "Can't make video frame writable: %s\n", av_err2str(ret));
+      return NULL;
+    }
+    ret = sws_scale_frame(context->img_convert_ctx, context->current_frame, rgb_frame);
+    if (ret < 0) {
+      fprintf(stderr, "Can't convert video frame: %s\n", av_err2str(ret));
+      return NULL;
+    }
+#  else
     sws_scale(context->img_convert_ctx,
               (const uint8_t *const *)rgb_frame->data,
               rgb_frame->linesize,
@@ -408,6 +485,7 @@ static AVFrame *generate_video_frame(FFMpegContext *context, const uint8_t *pixe
               codec->height,
               context->current_frame->data,
               context->current_frame->linesize);
+#  endif
   }
 
   return context->current_frame;
@@ -671,26 +749,20 @@ static AVStream *alloc_video_stream(FFMpegContext *context,
   av_dict_free(&opts);
 
   /* FFmpeg expects its data in the output pixel format. */
-  context->current_frame = alloc_picture(c->pix_fmt, c->width, c->height);
-
   if (c->pix_fmt == AV_PIX_FMT_RGBA) {
     /* Output pixel format is the same we use internally, no conversion necessary. */
+    context->current_frame = alloc_picture(c->pix_fmt, c->width, c->height);
     context->img_convert_frame = NULL;
     context->img_convert_ctx = NULL;
   }
   else {
-    /* Output pixel format is different, allocate frame for conversion. */
-    context->img_convert_frame = alloc_picture(AV_PIX_FMT_RGBA, c->width, c->height);
-    context->img_convert_ctx = sws_getContext(c->width,
-                                              c->height,
-                                              AV_PIX_FMT_RGBA,
-                                              c->width,
-                                              c->height,
-                                              c->pix_fmt,
-                                              SWS_BICUBIC,
-                                              NULL,
-                                              NULL,
-                                              NULL);
+    /* Output pixel format is different, allocate frame for conversion. The RGBA frame is tightly
+     * packed, as Blender's pixels are copied into it row by row. */
+    context->current_frame = alloc_convert_picture(c->pix_fmt, c->width, c->height, 0);
+    context->img_convert_frame = alloc_convert_picture(
+        AV_PIX_FMT_RGBA, c->width, c->height, 1);
+    context->img_convert_ctx = get_threaded_sws_context(
+        c->width, c->height, AV_PIX_FMT_RGBA, c->pix_fmt);
   }
 
   avcodec_parameters_from_context(st->codecpar, c);
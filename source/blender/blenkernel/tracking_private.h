@@ -145,6 +145,17 @@ float *tracking_track_get_mask_for_region(int frame_width,
 struct libmv_FrameAccessor;
 
 #define MAX_ACCESSOR_CLIP 64
+#define MAX_ACCESSOR_CACHED_FRAMES 4
+
+/* Frame of a clip which is shared by all tracks which are accessing it. */
+typedef struct TrackingImageAccessorFrame {
+  struct ImBuf *ibuf;
+  int clip_index;
+  int frame;
+  /* Value of the accessor's use counter at the last access, used to find the frame to evict. */
+  int last_used;
+} TrackingImageAccessorFrame;
+
 typedef struct TrackingImageAccessor {
   struct MovieClip *clips[MAX_ACCESSOR_CLIP];
   int num_clips;
@@ -156,6 +167,11 @@ typedef struct TrackingImageAccessor {
   int num_tracks;
 
   struct libmv_FrameAccessor *libmv_accessor;
+
+  /* Most recently used frames, so that tracks which are tracked in parallel don't go through the
+   * movie clip cache (and its lock) for every marker. Protected by the cache lock. */
+  TrackingImageAccessorFrame cached_frames[MAX_ACCESSOR_CACHED_FRAMES];
+  int cache_use_counter;
   SpinLock cache_lock;
 } TrackingImageAccessor;
 
@@ -172,6 +188,14 @@ TrackingImageAccessor *tracking_image_accessor_new(MovieClip *clips[MAX_ACCESSOR
                                                    int num_tracks);
 void tracking_image_accessor_destroy(TrackingImageAccessor *accessor);
 
+/**
+ * Make sure the given frame is decoded and kept in the accessor's frame cache, so that the
+ * tracks which are tracked in parallel afterwards can share it.
+ */
+void tracking_image_accessor_prefetch_frame(TrackingImageAccessor *accessor,
+                                            int clip_index,
+                                            int frame);
+
 #ifdef __cplusplus
 }
 #endif
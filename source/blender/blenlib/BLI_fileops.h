@@ -236,6 +236,25 @@ bool BLI_file_alias_target(const char *filepath, char *r_targetpath) ATTR_WARN_U
 
 bool BLI_file_magic_is_gzip(const char header[4]);
 
+struct ZSTD_CCtx_s;
+/**
+ * Create a compression context which compresses large inputs with multiple threads. The worker
+ * threads are kept alive between calls of #BLI_file_zstd_from_mem_at_pos_ex, so a context should
+ * be reused for all data written by the same writer.
+ */
+struct ZSTD_CCtx_s *BLI_file_zstd_compress_context_create(void) ATTR_WARN_UNUSED_RESULT;
+void BLI_file_zstd_compress_context_free(struct ZSTD_CCtx_s *ctx) ATTR_NONNULL();
+/**
+ * Write `buf` as a single Zstd frame at `file_offset`, returns the number of compressed bytes
+ * written or zero on failure. The context can't be used from multiple threads at the same time.
+ */
+size_t BLI_file_zstd_from_mem_at_pos_ex(struct ZSTD_CCtx_s *ctx,
+                                        void *buf,
+                                        size_t len,
+                                        FILE *file,
+                                        size_t file_offset,
+                                        int compression_level) ATTR_WARN_UNUSED_RESULT
+    ATTR_NONNULL();
 size_t BLI_file_zstd_from_mem_at_pos(void *buf,
                                      size_t len,
                                      FILE *file,
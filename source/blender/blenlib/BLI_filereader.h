@@ -60,6 +60,13 @@ FileReader *BLI_filereader_new_zstd(FileReader *base) ATTR_WARN_UNUSED_RESULT AT
 /** Create #FileReader from applying `Gzip` decompression on an underlying file. */
 FileReader *BLI_filereader_new_gzip(FileReader *base) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL();
 
+/**
+ * Hint that the data of a memory-mapped #FileReader will mostly be accessed on demand in random
+ * order, so only the pages that are actually read are loaded from disk.
+ * Does nothing for other types of #FileReader.
+ */
+void BLI_filereader_hint_random_access(FileReader *reader) ATTR_NONNULL();
+
 #ifdef __cplusplus
 }
 #endif
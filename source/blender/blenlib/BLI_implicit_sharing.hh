@@ -0,0 +1,62 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Implicit sharing (also known as copy-on-write) allows multiple owners to use the same data
+ * until one of them wants to modify it. Only then the data is copied, so that the other owners
+ * are not affected.
+ */
+
+#include <atomic>
+
+#include "BLI_assert.h"
+#include "BLI_utility_mixins.hh"
+
+namespace blender {
+
+/**
+ * Reference counter which is stored separately from the shared data. Every owner of the data
+ * holds one user. The owner may only modify the data when it is the only user, otherwise it has
+ * to make its own copy first and remove its user.
+ */
+class ImplicitSharingInfo : NonCopyable, NonMovable {
+ private:
+  mutable std::atomic<int> users_;
+
+ public:
+  ImplicitSharingInfo(const int initial_users = 1) : users_(initial_users)
+  {
+  }
+
+  virtual ~ImplicitSharingInfo() = default;
+
+  /** True when the data is owned by a single user, so it can be modified in place. */
+  bool is_mutable() const
+  {
+    return users_.load(std::memory_order_acquire) == 1;
+  }
+
+  void add_user() const
+  {
+    users_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /** Remove one user, the shared data and this info are freed when it was the last one. */
+  void remove_user_and_delete_if_last() const
+  {
+    const int old_user_count = users_.fetch_sub(1, std::memory_order_acq_rel);
+    BLI_assert(old_user_count >= 1);
+    if (old_user_count == 1) {
+      const_cast<ImplicitSharingInfo *>(this)->delete_self_with_data();
+    }
+  }
+
+ private:
+  /** Free the shared data and the info itself. */
+  virtual void delete_self_with_data() = 0;
+};
+
+}  // namespace blender
@@ -29,6 +29,10 @@ void BLI_kdtree_nd_(insert)(KDTree *tree, int index, const float co[KD_DIMS]) AT
 int BLI_kdtree_nd_(find_nearest)(const KDTree *tree,
                                  const float co[KD_DIMS],
                                  KDTreeNearest *r_nearest) ATTR_NONNULL(1, 2);
+void BLI_kdtree_nd_(find_nearest_array)(const KDTree *tree,
+                                        const float (*co)[KD_DIMS],
+                                        unsigned int co_len,
+                                        KDTreeNearest *r_nearest) ATTR_NONNULL(1);
 
 int BLI_kdtree_nd_(find_nearest_n)(const KDTree *tree,
                                    const float co[KD_DIMS],
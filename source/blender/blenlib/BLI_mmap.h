@@ -33,6 +33,11 @@ bool BLI_mmap_read(BLI_mmap_file *file, void *dest, size_t offset, size_t length
 
 void *BLI_mmap_get_pointer(BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT;
 
+/* Hints to the OS that the mapped file will be accessed in random order, so pages should only
+ * be read in when they are actually accessed instead of using read-ahead.
+ * Useful when only a small part of a large file is expected to be read. */
+void BLI_mmap_advise_random_access(BLI_mmap_file *file) ATTR_NONNULL(1);
+
 void BLI_mmap_free(BLI_mmap_file *file) ATTR_NONNULL(1);
 
 #ifdef __cplusplus
@@ -0,0 +1,70 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Low overhead tracing of named scopes, which can be exported as a Chrome trace
+ * (`chrome://tracing` or https://ui.perfetto.dev).
+ *
+ * Every thread records its scopes into its own fixed size ring buffer, so recording doesn't take
+ * any locks. While no trace is recorded, #BLI_profile_scope_begin returns zero and
+ * #BLI_profile_scope_end returns immediately, so annotations can stay in release builds.
+ */
+
+#include "BLI_compiler_attrs.h"
+#include "BLI_sys_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Start recording scopes of all threads. The trace is written to `filepath` by
+ * #BLI_profile_trace_end.
+ */
+void BLI_profile_trace_begin(const char *filepath) ATTR_NONNULL();
+/**
+ * Stop recording and write the trace file given to #BLI_profile_trace_begin.
+ * Does nothing when no trace is being recorded.
+ *
+ * \note Must be called when no other threads are recording scopes anymore.
+ * \return False when the file could not be written.
+ */
+bool BLI_profile_trace_end(void);
+/**
+ * Write the recorded scopes in the Chrome trace event format.
+ * \return False when the file could not be written.
+ */
+bool BLI_profile_trace_write(const char *filepath) ATTR_NONNULL();
+bool BLI_profile_trace_is_enabled(void);
+
+/**
+ * \return The start time of a scope, or zero when no trace is being recorded.
+ */
+uint64_t BLI_profile_scope_begin(void);
+/**
+ * Record a scope that started at `start_time`.
+ *
+ * \param category: Static string used to group scopes, is not copied.
+ * \param name: Optional name of this specific scope (e.g. of a data-block), is copied.
+ * When null, the category is used as name.
+ */
+void BLI_profile_scope_end(const char *category, const char *name, uint64_t start_time)
+    ATTR_NONNULL(1);
+
+/** Record a scope of the current C block, `category` has to be a static string. */
+#define BLI_PROFILE_SCOPE_BEGIN(category) \
+  { \
+    const char *_profile_category = (category); \
+    const uint64_t _profile_start = BLI_profile_scope_begin();
+
+#define BLI_PROFILE_SCOPE_END(name) \
+  BLI_profile_scope_end(_profile_category, (name), _profile_start); \
+  } \
+  ((void)0)
+
+#ifdef __cplusplus
+}
+#endif
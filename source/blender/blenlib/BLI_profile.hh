@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * C++ helpers for the tracing API in `BLI_profile.h`.
+ */
+
+#include "BLI_profile.h"
+
+namespace blender::profile {
+
+/**
+ * Records the lifetime of this object as a scope in the trace. The name is only computed when a
+ * trace is being recorded, because it may require building a string.
+ */
+class ProfileScope {
+ private:
+  const char *category_;
+  const char *name_;
+  uint64_t start_;
+
+ public:
+  ProfileScope(const char *category, const char *name = nullptr)
+      : category_(category), name_(name), start_(BLI_profile_scope_begin())
+  {
+  }
+
+  ~ProfileScope()
+  {
+    if (start_ != 0) {
+      BLI_profile_scope_end(category_, name_, start_);
+    }
+  }
+
+  ProfileScope(const ProfileScope &other) = delete;
+  ProfileScope &operator=(const ProfileScope &other) = delete;
+};
+
+}  // namespace blender::profile
+
+#define BLI_PROFILE_SCOPE_NAMED(category, name) \
+  blender::profile::ProfileScope profile_scope((category), (name))
+
+#define BLI_PROFILE_SCOPE(category) BLI_PROFILE_SCOPE_NAMED(category, nullptr)
@@ -431,6 +431,21 @@ void BLI_task_graph_edge_create(struct TaskNode *from_node, struct TaskNode *to_
 
 void BLI_task_isolate(void (*func)(void *userdata), void *userdata);
 
+/**
+ * Run the function in a task arena of the given priority. Tasks spawned by the function, for
+ * example with task pools or parallel ranges, are executed in the same arena. When threads have
+ * to choose, they work on tasks of higher priority arenas first, so that background work like
+ * prefetching and preview generation doesn't slow down interactive evaluation and drawing.
+ *
+ * High priority is the priority of the default arena that all other tasks are executed in.
+ *
+ * \note Like isolation, tasks spawned in one arena can only be executed by threads in the same
+ * arena. So tasks must be waited for with the same priority they were spawned with.
+ */
+void BLI_task_run_with_priority(eTaskPriority priority,
+                                void (*func)(void *userdata),
+                                void *userdata);
+
 /** \} */
 
 #ifdef __cplusplus
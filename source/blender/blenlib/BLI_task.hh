@@ -19,6 +19,7 @@
 #  include <tbb/parallel_for_each.h>
 #  include <tbb/parallel_invoke.h>
 #  include <tbb/parallel_reduce.h>
+#  include <tbb/parallel_scan.h>
 #  include <tbb/task_arena.h>
 #  ifdef WIN32
 /* We cannot keep this defined, since other parts of the code deal with this on their own, leading
@@ -31,6 +32,7 @@
 #endif
 
 #include "BLI_index_range.hh"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 namespace blender::threading {
@@ -90,6 +92,38 @@ Value parallel_reduce(IndexRange range,
 #endif
 }
 
+/**
+ * Compute a prefix sum over the range. `function(range, value, is_final_scan)` has to return
+ * `value` combined with the values of all indices in the range, in order. When `is_final_scan`
+ * is true, `value` is the combination of all previous indices and the function should also write
+ * the results of the range. Otherwise it may only compute the combination of the range, and is
+ * called again with `is_final_scan` later. `reduction` combines the results of two adjacent
+ * ranges. Returns the combination of the whole range.
+ */
+template<typename Value, typename Function, typename Reduction>
+Value parallel_scan(IndexRange range,
+                    int64_t grain_size,
+                    const Value &identity,
+                    const Function &function,
+                    const Reduction &reduction)
+{
+#ifdef WITH_TBB
+  /* Invoking tbb for small workloads has a large overhead. */
+  if (range.size() >= grain_size) {
+    return tbb::parallel_scan(
+        tbb::blocked_range<int64_t>(range.first(), range.one_after_last(), grain_size),
+        identity,
+        [&](const tbb::blocked_range<int64_t> &subrange, const Value &value, const bool is_final) {
+          return function(IndexRange(subrange.begin(), subrange.size()), value, is_final);
+        },
+        reduction);
+  }
+#else
+  UNUSED_VARS(grain_size, reduction);
+#endif
+  return function(range, identity, true);
+}
+
 /**
  * Execute all of the provided functions. The functions might be executed in parallel or in serial
  * or some combination of both.
@@ -113,4 +147,13 @@ template<typename Function> void isolate_task(const Function &function)
 #endif
 }
 
+/** See #BLI_task_run_with_priority for a description of task priorities. */
+template<typename Function>
+void run_with_priority(const eTaskPriority priority, const Function &function)
+{
+  BLI_task_run_with_priority(
+      priority, [](void *userdata) { (*static_cast<const Function *>(userdata))(); },
+      const_cast<Function *>(&function));
+}
+
 }  // namespace blender::threading
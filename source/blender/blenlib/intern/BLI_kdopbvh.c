@@ -1783,18 +1783,19 @@ static float fast_ray_nearest_hit(const BVHRayCastData *data, const BVHNode *nod
   return max_fff(t1x, t1y, t1z);
 }
 
-static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
+static float ray_node_nearest_hit(const BVHRayCastData *data, const BVHNode *node)
 {
-  int i;
-
-  /* ray-bv is really fast.. and simple tests revealed its worth to test it
-   * before calling the ray-primitive functions */
   /* XXX: temporary solution for particles until fast_ray_nearest_hit supports ray.radius */
-  float dist = (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
-                                            ray_nearest_hit(data, node->bv);
-  if (dist >= data->hit.dist) {
-    return;
-  }
+  return (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
+                                      ray_nearest_hit(data, node->bv);
+}
+
+/**
+ * \param dist: The distance at which the ray enters the bounds of \a node.
+ */
+static void dfs_raycast(BVHRayCastData *data, BVHNode *node, const float dist)
+{
+  int i;
 
   if (node->node_num == 0) {
     if (data->callback) {
@@ -1805,19 +1806,35 @@ static void dfs_raycast(BVHRayCastData *data, BVHNode *node)
       data->hit.dist = dist;
       madd_v3_v3v3fl(data->hit.co, data->ray.origin, data->ray.direction, dist);
     }
+    return;
   }
-  else {
-    /* pick loop direction to dive into the tree (based on ray direction and split axis) */
-    if (data->ray_dot_axis[node->main_axis] > 0.0f) {
-      for (i = 0; i != node->node_num; i++) {
-        dfs_raycast(data, node->children[i]);
-      }
+
+  /* Test the bounds of all children first (ray-bv is really fast), then dive into them from
+   * front to back. The closest hit is found early that way, so more children can be skipped. */
+  float child_dists[MAX_TREETYPE];
+  BVHNode *child_nodes[MAX_TREETYPE];
+  int children_num = 0;
+  for (i = 0; i != node->node_num; i++) {
+    const float child_dist = ray_node_nearest_hit(data, node->children[i]);
+    if (child_dist >= data->hit.dist) {
+      continue;
     }
-    else {
-      for (i = node->node_num - 1; i >= 0; i--) {
-        dfs_raycast(data, node->children[i]);
-      }
+    /* Insertion sort, there are only a few children. */
+    int j = children_num++;
+    for (; j > 0 && child_dists[j - 1] > child_dist; j--) {
+      child_dists[j] = child_dists[j - 1];
+      child_nodes[j] = child_nodes[j - 1];
     }
+    child_dists[j] = child_dist;
+    child_nodes[j] = node->children[i];
+  }
+
+  for (i = 0; i != children_num; i++) {
+    /* The hit distance may have become smaller in a previous child. */
+    if (child_dists[i] >= data->hit.dist) {
+      break;
+    }
+    dfs_raycast(data, child_nodes[i], child_dists[i]);
   }
 }
 
@@ -1830,9 +1847,7 @@ static void dfs_raycast_all(BVHRayCastData *data, BVHNode *node)
 
   /* ray-bv is really fast.. and simple tests revealed its worth to test it
    * before calling the ray-primitive functions */
-  /* XXX: temporary solution for particles until fast_ray_nearest_hit supports ray.radius */
-  float dist = (data->ray.radius == 0.0f) ? fast_ray_nearest_hit(data, node) :
-                                            ray_nearest_hit(data, node->bv);
+  float dist = ray_node_nearest_hit(data, node);
   if (dist >= data->hit.dist) {
     return;
   }
@@ -1928,8 +1943,10 @@ int BLI_bvhtree_ray_cast_ex(BVHTree *tree,
   }
 
   if (root) {
-    dfs_raycast(&data, root);
-    //      iterative_raycast(&data, root);
+    const float dist = ray_node_nearest_hit(&data, root);
+    if (dist < data.hit.dist) {
+      dfs_raycast(&data, root, dist);
+    }
   }
 
   if (hit) {
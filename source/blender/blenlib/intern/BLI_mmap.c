@@ -207,6 +207,17 @@ void *BLI_mmap_get_pointer(BLI_mmap_file *file)
   return file->memory;
 }
 
+void BLI_mmap_advise_random_access(BLI_mmap_file *file)
+{
+#ifndef WIN32
+  /* This is only a hint, failure is not an error. */
+  posix_madvise(file->memory, file->length, POSIX_MADV_RANDOM);
+#else
+  /* Windows has no equivalent for views of file mappings, read-ahead is left as is. */
+  UNUSED_VARS(file);
+#endif
+}
+
 void BLI_mmap_free(BLI_mmap_file *file)
 {
 #ifndef WIN32
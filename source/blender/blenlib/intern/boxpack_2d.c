@@ -172,6 +172,25 @@ static bool box_isect(const BoxPack *box_a, const BoxPack *box_b)
            box_ymax_get(box_a) - EPSILON <= box_ymin_get(box_b));
 }
 
+/**
+ * Bounds of packed boxes stored contiguously (x-min, y-min, x-max, y-max),
+ * so the exhaustive intersection search doesn't have to go through the box verts.
+ */
+static void box_bounds_update(float (*box_bounds)[4], const BoxPack *boxarray, const BoxPack *box)
+{
+  float *bounds = box_bounds[box - boxarray];
+  bounds[0] = box_xmin_get(box);
+  bounds[1] = box_ymin_get(box);
+  bounds[2] = box_xmax_get(box);
+  bounds[3] = box_ymax_get(box);
+}
+
+static bool box_isect_bounds(const float bounds_a[4], const float bounds_b[4])
+{
+  return !(bounds_a[0] + EPSILON >= bounds_b[2] || bounds_a[1] + EPSILON >= bounds_b[3] ||
+           bounds_a[2] - EPSILON <= bounds_b[0] || bounds_a[3] - EPSILON <= bounds_b[1]);
+}
+
 /** \} */
 
 /* compiler should inline */
@@ -270,11 +289,12 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
 {
   uint box_index, verts_pack_len, i, j, k;
   uint *vertex_pack_indices; /* an array of indices used for sorting verts */
+  float(*box_bounds)[4];     /* bounds of the packed boxes, see #box_bounds_update */
   bool isect;
   float tot_x = 0.0f, tot_y = 0.0f;
 
-  BoxPack *box, *box_test; /* Current box and another for intersection tests. */
-  BoxVert *vert;           /* The current vert. */
+  BoxPack *box;  /* Current box. */
+  BoxVert *vert; /* The current vert. */
 
   struct VertSortContext vs_ctx;
 
@@ -290,6 +310,7 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
   /* Add verts to the boxes, these are only used internally. */
   vert = MEM_mallocN(sizeof(BoxVert[4]) * (size_t)len, "BoxPack Verts");
   vertex_pack_indices = MEM_mallocN(sizeof(int[3]) * (size_t)len, "BoxPack Indices");
+  box_bounds = MEM_mallocN(sizeof(*box_bounds) * (size_t)len, "BoxPack Bounds");
 
   vs_ctx.vertarray = vert;
 
@@ -345,6 +366,7 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
   box_xmin_set(box, 0.0f);
   box_ymin_set(box, 0.0f);
   box->x = box->y = 0.0f;
+  box_bounds_update(box_bounds, boxarray, box);
 
   for (i = 0; i < 4; i++) {
     box->v[i]->used = true;
@@ -432,11 +454,16 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
             /* do a full search for colliding box
              * this is really slow, some spatially divided
              * data-structure would be better */
-            for (box_test = boxarray; box_test != box; box_test++) {
-              if (box_isect(box, box_test)) {
+            float bounds[4];
+            bounds[0] = box_xmin_get(box);
+            bounds[1] = box_ymin_get(box);
+            bounds[2] = box_xmax_get(box);
+            bounds[3] = box_ymax_get(box);
+            for (k = 0; k < box_index; k++) {
+              if (box_isect_bounds(bounds, box_bounds[k])) {
                 /* Store the last intersecting here as cache
                  * for faster checking next time around */
-                vert->isect_cache[j] = box_test;
+                vert->isect_cache[j] = &boxarray[k];
                 isect = true;
                 break;
               }
@@ -619,6 +646,15 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
             }
             /* End logical check */
 
+            /* Merging may have replaced the verts of the neighboring boxes. */
+            box_bounds_update(box_bounds, boxarray, box);
+            const BoxPack *boxes_adjacent[4] = {vert->trb, vert->blb, vert->brb, vert->tlb};
+            for (k = 0; k < 4; k++) {
+              if (boxes_adjacent[k] && boxes_adjacent[k] != box) {
+                box_bounds_update(box_bounds, boxarray, boxes_adjacent[k]);
+              }
+            }
+
             for (k = 0; k < 4; k++) {
               if (box->v[k]->used == false) {
                 box->v[k]->used = true;
@@ -650,6 +686,7 @@ void BLI_box_pack_2d(BoxPack *boxarray, const uint len, float *r_tot_x, float *r
     box->v[0] = box->v[1] = box->v[2] = box->v[3] = NULL;
   }
   MEM_freeN(vertex_pack_indices);
+  MEM_freeN(box_bounds);
   MEM_freeN(vs_ctx.vertarray);
 }
 
@@ -44,15 +44,34 @@
 #include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_sys_types.h" /* for intptr_t support */
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
-size_t BLI_file_zstd_from_mem_at_pos(
-    void *buf, size_t len, FILE *file, size_t file_offset, int compression_level)
+ZSTD_CCtx *BLI_file_zstd_compress_context_create(void)
+{
+  ZSTD_CCtx *ctx = ZSTD_createCCtx();
+  /* Large inputs (such as image buffers) are compressed with multiple threads when the library
+   * supports it, setting the parameter has no effect otherwise. The worker pool belongs to the
+   * context, so it is only started once. */
+  ZSTD_CCtx_setParameter(ctx, ZSTD_c_nbWorkers, BLI_system_thread_count());
+  return ctx;
+}
+
+void BLI_file_zstd_compress_context_free(ZSTD_CCtx *ctx)
+{
+  ZSTD_freeCCtx(ctx);
+}
+
+size_t BLI_file_zstd_from_mem_at_pos_ex(
+    ZSTD_CCtx *ctx, void *buf, size_t len, FILE *file, size_t file_offset, int compression_level)
 {
   fseek(file, file_offset, SEEK_SET);
 
-  ZSTD_CCtx *ctx = ZSTD_createCCtx();
+  /* Start a new frame, in case the previous one was not finished because of an error. */
+  ZSTD_CCtx_reset(ctx, ZSTD_reset_session_only);
   ZSTD_CCtx_setParameter(ctx, ZSTD_c_compressionLevel, compression_level);
+  /* The whole input is known up-front, which lets Zstd pick better parameters. */
+  ZSTD_CCtx_setPledgedSrcSize(ctx, len);
 
   ZSTD_inBuffer input = {buf, len, 0};
 
@@ -88,11 +107,20 @@ size_t BLI_file_zstd_from_mem_at_pos(
   }
 
   MEM_freeN(out_buf);
-  ZSTD_freeCCtx(ctx);
 
   return ZSTD_isError(ret) ? 0 : total_written;
 }
 
+size_t BLI_file_zstd_from_mem_at_pos(
+    void *buf, size_t len, FILE *file, size_t file_offset, int compression_level)
+{
+  ZSTD_CCtx *ctx = BLI_file_zstd_compress_context_create();
+  const size_t total_written = BLI_file_zstd_from_mem_at_pos_ex(
+      ctx, buf, len, file, file_offset, compression_level);
+  BLI_file_zstd_compress_context_free(ctx);
+  return total_written;
+}
+
 size_t BLI_file_unzstd_to_mem_at_pos(void *buf, size_t len, FILE *file, size_t file_offset)
 {
   fseek(file, file_offset, SEEK_SET);
@@ -127,3 +127,12 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   return (FileReader *)mem;
 }
+
+void BLI_filereader_hint_random_access(FileReader *reader)
+{
+  if (reader->read != memory_read_mmap) {
+    return;
+  }
+  MemoryReader *mem = (MemoryReader *)reader;
+  BLI_mmap_advise_random_access(mem->mmap);
+}
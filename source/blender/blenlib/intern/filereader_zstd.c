@@ -12,6 +12,7 @@
 #include "BLI_endian_switch.h"
 #include "BLI_filereader.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
 
 #include "MEM_guardedalloc.h"
 
@@ -191,6 +192,73 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
   return uncompressed_data;
 }
 
+typedef struct ZstdDecompressFramesData {
+  const ZstdReader *zstd;
+  int frame_first;
+  const char *compressed_data;
+  char *uncompressed_data;
+  bool error;
+} ZstdDecompressFramesData;
+
+static void zstd_decompress_frame_fn(void *__restrict userdata,
+                                     const int i,
+                                     const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ZstdDecompressFramesData *data = userdata;
+  const ZstdReader *zstd = data->zstd;
+  const int frame = data->frame_first + i;
+
+  const size_t compressed_start = zstd->seek.compressed_ofs[data->frame_first];
+  const size_t uncompressed_start = zstd->seek.uncompressed_ofs[data->frame_first];
+  const size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] -
+                                 zstd->seek.compressed_ofs[frame];
+  const size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                                   zstd->seek.uncompressed_ofs[frame];
+
+  /* Frames are independent, each one can be decoded with its own context. */
+  size_t res = ZSTD_decompress(
+      data->uncompressed_data + (zstd->seek.uncompressed_ofs[frame] - uncompressed_start),
+      uncompressed_size,
+      data->compressed_data + (zstd->seek.compressed_ofs[frame] - compressed_start),
+      compressed_size);
+  if (ZSTD_isError(res) || res < uncompressed_size) {
+    data->error = true;
+  }
+}
+
+/**
+ * Decompress the frames `[frame_first, frame_end)` directly into `buffer`, bypassing the frame
+ * cache. The compressed data is read in one go, the frames are then decoded in parallel.
+ */
+static bool zstd_read_frames_direct(ZstdReader *zstd, int frame_first, int frame_end, char *buffer)
+{
+  const size_t compressed_size = zstd->seek.compressed_ofs[frame_end] -
+                                 zstd->seek.compressed_ofs[frame_first];
+
+  char *compressed_data = MEM_mallocN(compressed_size, __func__);
+  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame_first], SEEK_SET) < 0 ||
+      zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size) {
+    MEM_freeN(compressed_data);
+    return false;
+  }
+
+  ZstdDecompressFramesData data = {
+      .zstd = zstd,
+      .frame_first = frame_first,
+      .compressed_data = compressed_data,
+      .uncompressed_data = buffer,
+      .error = false,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = (frame_end - frame_first) > 1;
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, frame_end - frame_first, &data, zstd_decompress_frame_fn, &settings);
+
+  MEM_freeN(compressed_data);
+  return !data.error;
+}
+
 static ssize_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
 {
   ZstdReader *zstd = (ZstdReader *)reader;
@@ -203,6 +271,28 @@ static ssize_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
       break;
     }
 
+    /* When the read starts at a frame boundary and covers whole frames, decode those straight
+     * into the output buffer, there is no point in caching frames that are consumed entirely. */
+    if (zstd->reader.offset == zstd->seek.uncompressed_ofs[frame] &&
+        frame != zstd->seek.cached_frame) {
+      int frame_end = frame;
+      while (frame_end < zstd->seek.frames_num &&
+             zstd->seek.uncompressed_ofs[frame_end + 1] <= end_offset) {
+        frame_end++;
+      }
+      if (frame_end > frame) {
+        if (!zstd_read_frames_direct(zstd, frame, frame_end, (char *)buffer + read_len)) {
+          /* Error while reading the frames, so return as much as we can. */
+          break;
+        }
+        const size_t frames_read_len = zstd->seek.uncompressed_ofs[frame_end] -
+                                       zstd->reader.offset;
+        read_len += frames_read_len;
+        zstd->reader.offset += frames_read_len;
+        continue;
+      }
+    }
+
     const char *framedata = zstd_ensure_cache(zstd, frame);
     if (framedata == NULL) {
       /* Error while reading the frame, so return as much as we can. */
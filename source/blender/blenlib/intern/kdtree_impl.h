@@ -8,6 +8,7 @@
 
 #include "BLI_kdtree_impl.h"
 #include "BLI_math.h"
+#include "BLI_task.h"
 #include "BLI_strict_flags.h"
 #include "BLI_utildefines.h"
 
@@ -50,6 +51,15 @@ struct KDTree {
  */
 #define KD_NODE_ROOT_IS_INIT ((uint)-2)
 
+/** Sub-trees with fewer nodes are balanced on a single thread. */
+#define KD_BALANCE_THREADED_NODES_MIN 10000
+/** Trees with fewer nodes search for duplicates on a single thread. */
+#define KD_DUPLICATES_THREADED_NODES_MIN 10000
+/** Number of nodes whose neighbors are searched in parallel at once. */
+#define KD_DUPLICATES_CHUNK_NODES 16384
+/** Chunks with more neighbors in total are searched on a single thread, bounding the memory. */
+#define KD_DUPLICATES_CHUNK_NEIGHBORS_MAX (KD_DUPLICATES_CHUNK_NODES * 32)
+
 /* -------------------------------------------------------------------- */
 /** \name Local Math API
  * \{ */
@@ -131,19 +141,14 @@ void BLI_kdtree_nd_(insert)(KDTree *tree, int index, const float co[KD_DIMS])
 #endif
 }
 
-static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+/**
+ * Partition the nodes around their median on the given axis, returns the index of the median.
+ */
+static uint kdtree_balance_partition(KDTreeNode *nodes, uint nodes_len, uint axis)
 {
-  KDTreeNode *node;
   float co;
   uint left, right, median, i, j;
 
-  if (nodes_len <= 0) {
-    return KD_NODE_UNSET;
-  }
-  else if (nodes_len == 1) {
-    return 0 + ofs;
-  }
-
   /* Quick-sort style sorting around median. */
   left = 0;
   right = nodes_len - 1;
@@ -176,6 +181,23 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
     }
   }
 
+  return median;
+}
+
+static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  KDTreeNode *node;
+  uint median;
+
+  if (nodes_len <= 0) {
+    return KD_NODE_UNSET;
+  }
+  else if (nodes_len == 1) {
+    return 0 + ofs;
+  }
+
+  median = kdtree_balance_partition(nodes, nodes_len, axis);
+
   /* Set node and sort sub-nodes. */
   node = &nodes[median];
   node->d = axis;
@@ -187,6 +209,59 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
   return median + ofs;
 }
 
+typedef struct KDTreeBalanceTaskData {
+  KDTreeNode *nodes;
+  uint nodes_len;
+  uint axis;
+  uint ofs;
+  uint *r_root;
+} KDTreeBalanceTaskData;
+
+static uint kdtree_balance_threaded(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs);
+
+static void kdtree_balance_task(TaskPool *__restrict pool, void *taskdata)
+{
+  const KDTreeBalanceTaskData *data = taskdata;
+  *data->r_root = kdtree_balance_threaded(
+      pool, data->nodes, data->nodes_len, data->axis, data->ofs);
+}
+
+/**
+ * Same as #kdtree_balance, but the sub-trees of large trees are balanced in parallel,
+ * since they don't share any nodes after partitioning.
+ */
+static uint kdtree_balance_threaded(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  KDTreeNode *node;
+  uint median;
+
+  if (nodes_len < KD_BALANCE_THREADED_NODES_MIN) {
+    return kdtree_balance(nodes, nodes_len, axis, ofs);
+  }
+
+  median = kdtree_balance_partition(nodes, nodes_len, axis);
+
+  /* Set node, sort the left sub-nodes in a new task and the right sub-nodes in this one. */
+  node = &nodes[median];
+  node->d = axis;
+  axis = (axis + 1) % KD_DIMS;
+
+  KDTreeBalanceTaskData *data = MEM_mallocN(sizeof(*data), __func__);
+  data->nodes = nodes;
+  data->nodes_len = median;
+  data->axis = axis;
+  data->ofs = ofs;
+  data->r_root = &node->left;
+  BLI_task_pool_push(pool, kdtree_balance_task, data, true, NULL);
+
+  node->right = kdtree_balance_threaded(
+      pool, nodes + median + 1, (nodes_len - (median + 1)), axis, (median + 1) + ofs);
+
+  return median + ofs;
+}
+
 void BLI_kdtree_nd_(balance)(KDTree *tree)
 {
   if (tree->root != KD_NODE_ROOT_IS_INIT) {
@@ -196,7 +271,15 @@ void BLI_kdtree_nd_(balance)(KDTree *tree)
     }
   }
 
-  tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  if (tree->nodes_len < KD_BALANCE_THREADED_NODES_MIN) {
+    tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  }
+  else {
+    TaskPool *pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+    tree->root = kdtree_balance_threaded(pool, tree->nodes, tree->nodes_len, 0, 0);
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+  }
 
 #ifdef DEBUG
   tree->is_balanced = true;
@@ -318,6 +401,43 @@ int BLI_kdtree_nd_(find_nearest)(const KDTree *tree,
   return min_node->index;
 }
 
+typedef struct KDTreeFindNearestArrayData {
+  const KDTree *tree;
+  const float (*co)[KD_DIMS];
+  KDTreeNearest *r_nearest;
+} KDTreeFindNearestArrayData;
+
+static void kdtree_find_nearest_array_cb(void *__restrict userdata,
+                                         const int i,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const KDTreeFindNearestArrayData *data = userdata;
+  if (BLI_kdtree_nd_(find_nearest)(data->tree, data->co[i], &data->r_nearest[i]) == -1) {
+    data->r_nearest[i].index = -1;
+  }
+}
+
+/**
+ * Find the nearest node of many coordinates at once, the lookups run in parallel.
+ * The index of a result is -1 when the tree is empty.
+ */
+void BLI_kdtree_nd_(find_nearest_array)(const KDTree *tree,
+                                        const float (*co)[KD_DIMS],
+                                        const uint co_len,
+                                        KDTreeNearest *r_nearest)
+{
+  KDTreeFindNearestArrayData data = {
+      .tree = tree,
+      .co = co,
+      .r_nearest = r_nearest,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+  BLI_task_parallel_range(0, (int)co_len, &data, kdtree_find_nearest_array_cb, &settings);
+}
+
 /**
  * A version of #BLI_kdtree_3d_find_nearest which runs a callback
  * to filter out values.
@@ -852,6 +972,232 @@ static void deduplicate_recursive(const struct DeDuplicateParams *p, uint i)
   }
 }
 
+/** Merge the nodes in range of a node into it, unless it was merged itself already. */
+static void deduplicate_node(struct DeDuplicateParams *p,
+                             const KDTree *tree,
+                             const uint node_index,
+                             const int index)
+{
+  int *duplicates = p->duplicates;
+  if (ELEM(duplicates[index], -1, index)) {
+    p->search = index;
+    copy_vn_vn(p->search_co, tree->nodes[node_index].co);
+    const int found_prev = *p->duplicates_found;
+    deduplicate_recursive(p, tree->root);
+    if (*p->duplicates_found != found_prev) {
+      /* Prevent chains of doubles. */
+      duplicates[index] = index;
+    }
+  }
+}
+
+/**
+ * Same pruning as #deduplicate_recursive, but collects all nodes in range of the searched
+ * coordinate, regardless of whether they are merged already.
+ */
+struct DeDuplicateNeighborParams {
+  const KDTreeNode *nodes;
+  float range;
+  float range_sq;
+
+  /* Per Search */
+  float search_co[KD_DIMS];
+  int search;
+  /** Node indices of the neighbors, they are only counted when null. */
+  uint *neighbors;
+  uint neighbors_num;
+};
+
+static void deduplicate_neighbors_recursive(struct DeDuplicateNeighborParams *p, uint i)
+{
+  const KDTreeNode *node = &p->nodes[i];
+  if (p->search_co[node->d] + p->range <= node->co[node->d]) {
+    if (node->left != KD_NODE_UNSET) {
+      deduplicate_neighbors_recursive(p, node->left);
+    }
+  }
+  else if (p->search_co[node->d] - p->range >= node->co[node->d]) {
+    if (node->right != KD_NODE_UNSET) {
+      deduplicate_neighbors_recursive(p, node->right);
+    }
+  }
+  else {
+    if ((p->search != node->index) && (len_squared_vnvn(node->co, p->search_co) <= p->range_sq)) {
+      if (p->neighbors) {
+        p->neighbors[p->neighbors_num] = i;
+      }
+      p->neighbors_num++;
+    }
+    if (node->left != KD_NODE_UNSET) {
+      deduplicate_neighbors_recursive(p, node->left);
+    }
+    if (node->right != KD_NODE_UNSET) {
+      deduplicate_neighbors_recursive(p, node->right);
+    }
+  }
+}
+
+typedef struct DeDuplicateThreadedData {
+  const KDTree *tree;
+  /** Node index for every iteration step, null when looping over the nodes directly. */
+  const uint *order;
+  const int *duplicates;
+  float range;
+  /** First iteration step of the current chunk. */
+  uint chunk_start;
+  /** Start of the neighbors of every step of the chunk in #neighbors, one longer than the chunk. */
+  size_t *neighbor_offsets;
+  uint *neighbors;
+} DeDuplicateThreadedData;
+
+static void deduplicate_neighbors_search(const DeDuplicateThreadedData *data,
+                                         const uint i,
+                                         uint *neighbors,
+                                         uint *r_neighbors_num)
+{
+  const uint node_index = data->order ? data->order[i] : i;
+  struct DeDuplicateNeighborParams p = {
+      .nodes = data->tree->nodes,
+      .range = data->range,
+      .range_sq = square_f(data->range),
+      .search = data->order ? (int)i : data->tree->nodes[node_index].index,
+      .neighbors = neighbors,
+      .neighbors_num = 0,
+  };
+  copy_vn_vn(p.search_co, data->tree->nodes[node_index].co);
+  deduplicate_neighbors_recursive(&p, data->tree->root);
+  *r_neighbors_num = p.neighbors_num;
+}
+
+static void deduplicate_neighbors_count_cb(void *__restrict userdata,
+                                           const int chunk_i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DeDuplicateThreadedData *data = userdata;
+  const uint i = data->chunk_start + (uint)chunk_i;
+  const int index = data->order ? (int)i : data->tree->nodes[i].index;
+  /* Nodes merged by previous chunks are skipped by the assignment, don't search them. */
+  uint neighbors_num = 0;
+  if (ELEM(data->duplicates[index], -1, index)) {
+    deduplicate_neighbors_search(data, i, NULL, &neighbors_num);
+  }
+  data->neighbor_offsets[chunk_i] = neighbors_num;
+}
+
+static void deduplicate_neighbors_fill_cb(void *__restrict userdata,
+                                          const int chunk_i,
+                                          const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const DeDuplicateThreadedData *data = userdata;
+  if (data->neighbor_offsets[chunk_i] == data->neighbor_offsets[chunk_i + 1]) {
+    return;
+  }
+  uint neighbors_num;
+  deduplicate_neighbors_search(data,
+                               data->chunk_start + (uint)chunk_i,
+                               data->neighbors + data->neighbor_offsets[chunk_i],
+                               &neighbors_num);
+  BLI_assert(neighbors_num ==
+             data->neighbor_offsets[chunk_i + 1] - data->neighbor_offsets[chunk_i]);
+}
+
+/**
+ * Threaded version of #BLI_kdtree_3d_calc_duplicates_fast with the same result. The expensive
+ * tree searches for the neighbors of the nodes run in parallel. Only assigning the merge targets
+ * in order, which depends on the previous merges, is done on a single thread.
+ *
+ * Nodes are handled in chunks, so nodes merged by earlier chunks aren't searched and only the
+ * neighbors of one chunk are stored at a time. Chunks with more neighbors than
+ * #KD_DUPLICATES_CHUNK_NEIGHBORS_MAX (dense clusters) are handled on a single thread instead.
+ */
+static int kdtree_calc_duplicates_threaded(const KDTree *tree,
+                                           const float range,
+                                           bool use_index_order,
+                                           int *duplicates)
+{
+  const uint nodes_len = tree->nodes_len;
+  uint *order = use_index_order ? kdtree_order(tree) : NULL;
+  DeDuplicateThreadedData data = {
+      .tree = tree,
+      .order = order,
+      .duplicates = duplicates,
+      .range = range,
+      .neighbor_offsets = MEM_mallocN(sizeof(size_t) * (KD_DUPLICATES_CHUNK_NODES + 1), __func__),
+      .neighbors = NULL,
+  };
+
+  int found = 0;
+  struct DeDuplicateParams p = {
+      .nodes = tree->nodes,
+      .range = range,
+      .range_sq = square_f(range),
+      .duplicates = duplicates,
+      .duplicates_found = &found,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1024;
+
+  for (uint chunk_start = 0; chunk_start < nodes_len; chunk_start += KD_DUPLICATES_CHUNK_NODES) {
+    const uint chunk_len = min_uu(nodes_len - chunk_start, KD_DUPLICATES_CHUNK_NODES);
+    data.chunk_start = chunk_start;
+    BLI_task_parallel_range(0, (int)chunk_len, &data, deduplicate_neighbors_count_cb, &settings);
+
+    size_t neighbors_num = 0;
+    for (uint chunk_i = 0; chunk_i < chunk_len; chunk_i++) {
+      const size_t count = data.neighbor_offsets[chunk_i];
+      data.neighbor_offsets[chunk_i] = neighbors_num;
+      neighbors_num += count;
+    }
+    data.neighbor_offsets[chunk_len] = neighbors_num;
+
+    if (neighbors_num == 0) {
+      continue;
+    }
+    if (neighbors_num > KD_DUPLICATES_CHUNK_NEIGHBORS_MAX) {
+      for (uint i = chunk_start; i < chunk_start + chunk_len; i++) {
+        const uint node_index = order ? order[i] : i;
+        const int index = order ? (int)i : tree->nodes[i].index;
+        deduplicate_node(&p, tree, node_index, index);
+      }
+      continue;
+    }
+
+    if (data.neighbors == NULL) {
+      data.neighbors = MEM_mallocN(sizeof(uint) * KD_DUPLICATES_CHUNK_NEIGHBORS_MAX, __func__);
+    }
+    BLI_task_parallel_range(0, (int)chunk_len, &data, deduplicate_neighbors_fill_cb, &settings);
+
+    for (uint chunk_i = 0; chunk_i < chunk_len; chunk_i++) {
+      const uint i = chunk_start + chunk_i;
+      const int index = order ? (int)i : tree->nodes[i].index;
+      if (ELEM(duplicates[index], -1, index)) {
+        const int found_prev = found;
+        for (size_t j = data.neighbor_offsets[chunk_i]; j < data.neighbor_offsets[chunk_i + 1];
+             j++) {
+          const int neighbor_index = tree->nodes[data.neighbors[j]].index;
+          if (duplicates[neighbor_index] == -1) {
+            duplicates[neighbor_index] = index;
+            found += 1;
+          }
+        }
+        if (found != found_prev) {
+          /* Prevent chains of doubles. */
+          duplicates[index] = index;
+        }
+      }
+    }
+  }
+
+  MEM_SAFE_FREE(data.neighbors);
+  MEM_freeN(data.neighbor_offsets);
+  if (order) {
+    MEM_freeN(order);
+  }
+  return found;
+}
+
 /**
  * Find duplicate points in \a range.
  * Favors speed over quality since it doesn't find the best target vertex for merging.
@@ -875,6 +1221,10 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
                                          bool use_index_order,
                                          int *duplicates)
 {
+  if (tree->nodes_len >= KD_DUPLICATES_THREADED_NODES_MIN) {
+    return kdtree_calc_duplicates_threaded(tree, range, use_index_order, duplicates);
+  }
+
   int found = 0;
   struct DeDuplicateParams p = {
       .nodes = tree->nodes,
@@ -887,35 +1237,13 @@ int BLI_kdtree_nd_(calc_duplicates_fast)(const KDTree *tree,
   if (use_index_order) {
     uint *order = kdtree_order(tree);
     for (uint i = 0; i < tree->nodes_len; i++) {
-      const uint node_index = order[i];
-      const int index = (int)i;
-      if (ELEM(duplicates[index], -1, index)) {
-        p.search = index;
-        copy_vn_vn(p.search_co, tree->nodes[node_index].co);
-        int found_prev = found;
-        deduplicate_recursive(&p, tree->root);
-        if (found != found_prev) {
-          /* Prevent chains of doubles. */
-          duplicates[index] = index;
-        }
-      }
+      deduplicate_node(&p, tree, order[i], (int)i);
     }
     MEM_freeN(order);
   }
   else {
     for (uint i = 0; i < tree->nodes_len; i++) {
-      const uint node_index = i;
-      const int index = p.nodes[node_index].index;
-      if (ELEM(duplicates[index], -1, index)) {
-        p.search = index;
-        copy_vn_vn(p.search_co, tree->nodes[node_index].co);
-        int found_prev = found;
-        deduplicate_recursive(&p, tree->root);
-        if (found != found_prev) {
-          /* Prevent chains of doubles. */
-          duplicates[index] = index;
-        }
-      }
+      deduplicate_node(&p, tree, i, p.nodes[i].index);
     }
   }
   return found;
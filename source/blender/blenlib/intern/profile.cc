@@ -0,0 +1,224 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "BLI_array.hh"
+#include "BLI_fileops.h"
+#include "BLI_index_range.hh"
+#include "BLI_profile.h"
+#include "BLI_string.h"
+#include "BLI_vector.hh"
+
+namespace blender::profile {
+
+/** Number of scopes every thread keeps, older scopes are overwritten. */
+static constexpr int64_t thread_buffer_size = 1 << 16;
+
+struct ProfileEvent {
+  const char *category;
+  uint64_t start;
+  uint64_t end;
+  char name[40];
+};
+
+struct ThreadBuffer {
+  int thread_index;
+  /** Total number of recorded scopes, may be larger than the buffer size. */
+  int64_t events_num = 0;
+  Array<ProfileEvent> events;
+
+  ThreadBuffer(const int thread_index)
+      : thread_index(thread_index), events(thread_buffer_size, NoInitialization())
+  {
+  }
+};
+
+struct ProfileTrace {
+  std::atomic<bool> is_enabled = false;
+  /** Incremented for every trace, so that threads don't use buffers of a previous trace. */
+  std::atomic<int> generation = 0;
+  uint64_t start_time = 0;
+  std::string filepath;
+
+  /** Protects #thread_buffers. */
+  std::mutex mutex;
+  Vector<std::unique_ptr<ThreadBuffer>> thread_buffers;
+};
+
+static ProfileTrace &get_trace()
+{
+  static ProfileTrace trace;
+  return trace;
+}
+
+static uint64_t profile_time_now()
+{
+  using namespace std::chrono;
+  /* Add one, so that a valid time is never zero. */
+  return uint64_t(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count()) +
+         1;
+}
+
+static ThreadBuffer &get_thread_buffer(ProfileTrace &trace)
+{
+  static thread_local ThreadBuffer *buffer = nullptr;
+  static thread_local int buffer_generation = -1;
+
+  const int generation = trace.generation.load(std::memory_order_relaxed);
+  if (buffer_generation != generation) {
+    std::lock_guard lock{trace.mutex};
+    const int thread_index = int(trace.thread_buffers.size());
+    trace.thread_buffers.append(std::make_unique<ThreadBuffer>(thread_index));
+    buffer = trace.thread_buffers.last().get();
+    buffer_generation = generation;
+  }
+  return *buffer;
+}
+
+static void write_json_string(FILE *file, const char *str)
+{
+  fputc('"', file);
+  for (const char *c = str; *c; c++) {
+    if (ELEM(*c, '"', '\\')) {
+      fputc('\\', file);
+      fputc(*c, file);
+    }
+    else if (uchar(*c) < 0x20) {
+      fputc(' ', file);
+    }
+    else {
+      fputc(*c, file);
+    }
+  }
+  fputc('"', file);
+}
+
+static bool trace_write(ProfileTrace &trace, const char *filepath)
+{
+  FILE *file = BLI_fopen(filepath, "w");
+  if (file == nullptr) {
+    return false;
+  }
+
+  std::lock_guard lock{trace.mutex};
+
+  fputs("{\"traceEvents\":[\n", file);
+  bool is_first = true;
+  for (const std::unique_ptr<ThreadBuffer> &buffer : trace.thread_buffers) {
+    const int64_t events_num = std::min(buffer->events_num, thread_buffer_size);
+    const int64_t first_event = buffer->events_num - events_num;
+    for (const int64_t i : IndexRange(first_event, events_num)) {
+      const ProfileEvent &event = buffer->events[i % thread_buffer_size];
+      if (!is_first) {
+        fputs(",\n", file);
+      }
+      is_first = false;
+      /* Chrome trace time stamps are in microseconds. */
+      fprintf(file, "{\"name\":");
+      write_json_string(file, event.name[0] ? event.name : event.category);
+      fprintf(file, ",\"cat\":");
+      write_json_string(file, event.category);
+      fprintf(file,
+              ",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+              buffer->thread_index,
+              double(event.start - std::min(event.start, trace.start_time)) / 1000.0,
+              double(event.end - event.start) / 1000.0);
+    }
+  }
+  fputs("\n]}\n", file);
+
+  const bool success = ferror(file) == 0;
+  fclose(file);
+  return success;
+}
+
+}  // namespace blender::profile
+
+using namespace blender::profile;
+
+void BLI_profile_trace_begin(const char *filepath)
+{
+  ProfileTrace &trace = get_trace();
+  {
+    std::lock_guard lock{trace.mutex};
+    trace.thread_buffers.clear();
+    trace.filepath = filepath;
+    trace.start_time = profile_time_now();
+  }
+  trace.generation.fetch_add(1, std::memory_order_relaxed);
+  trace.is_enabled.store(true, std::memory_order_release);
+}
+
+bool BLI_profile_trace_end(void)
+{
+  ProfileTrace &trace = get_trace();
+  if (!trace.is_enabled.exchange(false)) {
+    return true;
+  }
+
+  const bool success = trace_write(trace, trace.filepath.c_str());
+  if (success) {
+    printf("Profile trace written to '%s'\n", trace.filepath.c_str());
+  }
+  else {
+    fprintf(stderr, "Failed to write profile trace '%s'\n", trace.filepath.c_str());
+  }
+
+  std::lock_guard lock{trace.mutex};
+  trace.thread_buffers.clear_and_make_inline();
+  /* Threads must not refer to the freed buffers anymore. */
+  trace.generation.fetch_add(1, std::memory_order_relaxed);
+  return success;
+}
+
+bool BLI_profile_trace_write(const char *filepath)
+{
+  return trace_write(get_trace(), filepath);
+}
+
+bool BLI_profile_trace_is_enabled(void)
+{
+  return get_trace().is_enabled.load(std::memory_order_relaxed);
+}
+
+uint64_t BLI_profile_scope_begin(void)
+{
+  if (!get_trace().is_enabled.load(std::memory_order_relaxed)) {
+    return 0;
+  }
+  return profile_time_now();
+}
+
+void BLI_profile_scope_end(const char *category, const char *name, const uint64_t start_time)
+{
+  if (start_time == 0) {
+    return;
+  }
+  ProfileTrace &trace = get_trace();
+  if (!trace.is_enabled.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  ThreadBuffer &buffer = get_thread_buffer(trace);
+  ProfileEvent &event = buffer.events[buffer.events_num % thread_buffer_size];
+  event.category = category;
+  event.start = start_time;
+  event.end = profile_time_now();
+  if (name) {
+    BLI_strncpy(event.name, name, sizeof(event.name));
+  }
+  else {
+    event.name[0] = '\0';
+  }
+  buffer.events_num++;
+}
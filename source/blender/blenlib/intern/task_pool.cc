@@ -17,6 +17,7 @@
 #include "BLI_math.h"
 #include "BLI_mempool.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 
 #ifdef WITH_TBB
@@ -110,9 +111,8 @@ class TBBTaskGroup : public tbb::task_group {
   TBBTaskGroup(eTaskPriority priority)
   {
 #  if TBB_INTERFACE_VERSION_MAJOR >= 12
-    /* TODO: support priorities in TBB 2021, where they are only available as
-     * part of task arenas, no longer for task groups. Or remove support for
-     * task priorities if they are no longer useful. */
+    /* In TBB 2021 priorities are only available as part of task arenas, tasks
+     * are run and waited for in the arena of the pool priority instead. */
     UNUSED_VARS(priority);
 #  else
     switch (priority) {
@@ -141,6 +141,7 @@ enum TaskPoolType {
 struct TaskPool {
   TaskPoolType type;
   bool use_threads;
+  eTaskPriority priority;
 
   ThreadMutex user_mutex;
   void *userdata;
@@ -205,7 +206,8 @@ static void tbb_task_pool_run(TaskPool *pool, Task &&task)
 #ifdef WITH_TBB
   else if (pool->use_threads) {
     /* Execute in TBB task group. */
-    pool->tbb_group.run(std::move(task));
+    blender::threading::run_with_priority(pool->priority,
+                                          [&]() { pool->tbb_group.run(std::move(task)); });
   }
 #endif
   else {
@@ -222,9 +224,12 @@ static void tbb_task_pool_work_and_wait(TaskPool *pool)
 
     BLI_mempool_iter iter;
     BLI_mempool_iternew(pool->suspended_mempool, &iter);
-    while (Task *task = (Task *)BLI_mempool_iterstep(&iter)) {
-      tbb_task_pool_run(pool, std::move(*task));
-    }
+    /* Enter the arena of the pool priority once for all tasks. */
+    blender::threading::run_with_priority(pool->priority, [&]() {
+      while (Task *task = (Task *)BLI_mempool_iterstep(&iter)) {
+        tbb_task_pool_run(pool, std::move(*task));
+      }
+    });
 
     BLI_mempool_clear(pool->suspended_mempool);
   }
@@ -233,8 +238,9 @@ static void tbb_task_pool_work_and_wait(TaskPool *pool)
   if (pool->use_threads) {
     /* This is called wait(), but internally it can actually do work. This
      * matters because we don't want recursive usage of task pools to run
-     * out of threads and get stuck. */
-    pool->tbb_group.wait();
+     * out of threads and get stuck. The tasks are only executed by threads in
+     * the arena they were spawned in, so wait with the same priority. */
+    blender::threading::run_with_priority(pool->priority, [&]() { pool->tbb_group.wait(); });
   }
 #endif
 }
@@ -244,7 +250,7 @@ static void tbb_task_pool_cancel(TaskPool *pool)
 #ifdef WITH_TBB
   if (pool->use_threads) {
     pool->tbb_group.cancel();
-    pool->tbb_group.wait();
+    blender::threading::run_with_priority(pool->priority, [&]() { pool->tbb_group.wait(); });
   }
 #else
   UNUSED_VARS(pool);
@@ -365,6 +371,7 @@ static TaskPool *task_pool_create_ex(void *userdata, TaskPoolType type, eTaskPri
 
   pool->type = type;
   pool->use_threads = use_threads;
+  pool->priority = priority;
 
   pool->userdata = userdata;
   BLI_mutex_init(&pool->user_mutex);
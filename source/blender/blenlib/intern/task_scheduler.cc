@@ -19,6 +19,9 @@
 #    include <tbb/global_control.h>
 #    define WITH_TBB_GLOBAL_CONTROL
 #  endif
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+#    define WITH_TBB_ARENA_PRIORITY
+#  endif
 #endif
 
 /* Task Scheduler */
@@ -27,6 +30,10 @@ static int task_scheduler_num_threads = 1;
 #ifdef WITH_TBB_GLOBAL_CONTROL
 static tbb::global_control *task_scheduler_global_control = nullptr;
 #endif
+#ifdef WITH_TBB_ARENA_PRIORITY
+/* Arena for #TASK_PRIORITY_LOW, high priority tasks run in the default arena. */
+static tbb::task_arena *task_scheduler_low_priority_arena = nullptr;
+#endif
 
 void BLI_task_scheduler_init()
 {
@@ -50,6 +57,14 @@ void BLI_task_scheduler_init()
 #else
   task_scheduler_num_threads = BLI_system_thread_count();
 #endif
+
+#ifdef WITH_TBB_ARENA_PRIORITY
+  if (task_scheduler_low_priority_arena == nullptr) {
+    /* The arena is only initialized when it is first used, so this is cheap. */
+    task_scheduler_low_priority_arena = MEM_new<tbb::task_arena>(
+        __func__, tbb::task_arena::automatic, 1, tbb::task_arena::priority::low);
+  }
+#endif
 }
 
 void BLI_task_scheduler_exit()
@@ -57,6 +72,10 @@ void BLI_task_scheduler_exit()
 #ifdef WITH_TBB_GLOBAL_CONTROL
   MEM_delete(task_scheduler_global_control);
 #endif
+#ifdef WITH_TBB_ARENA_PRIORITY
+  MEM_delete(task_scheduler_low_priority_arena);
+  task_scheduler_low_priority_arena = nullptr;
+#endif
 }
 
 int BLI_task_scheduler_num_threads()
@@ -72,3 +91,19 @@ void BLI_task_isolate(void (*func)(void *userdata), void *userdata)
   func(userdata);
 #endif
 }
+
+void BLI_task_run_with_priority(eTaskPriority priority,
+                                void (*func)(void *userdata),
+                                void *userdata)
+{
+#ifdef WITH_TBB_ARENA_PRIORITY
+  if (priority == TASK_PRIORITY_LOW && task_scheduler_low_priority_arena != nullptr &&
+      task_scheduler_num_threads > 1) {
+    task_scheduler_low_priority_arena->execute([&] { func(userdata); });
+    return;
+  }
+#else
+  UNUSED_VARS(priority);
+#endif
+  func(userdata);
+}
@@ -111,6 +111,7 @@ TEST_PARSE_FAIL(Truncated7, "1 and")
 TEST_PARSE_FAIL(Truncated8, "1 or")
 TEST_PARSE_FAIL(Truncated9, "sqrt(1")
 TEST_PARSE_FAIL(Truncated10, "fmod(1,")
+TEST_PARSE_FAIL(Truncated11, "2 **")
 
 /* Constant expression with working constant folding */
 #define TEST_CONST(name, str, value) \
@@ -205,6 +206,23 @@ TEST_EVAL(BinaryMul, "x*3", 2, 6.0)
 TEST_CONST(BinaryDiv, "3/2", 1.5)
 TEST_EVAL(BinaryDiv, "3/x", 2, 1.5)
 
+TEST_CONST(BinaryMod1, "7 % 3", 1.0)
+TEST_CONST(BinaryMod2, "-7 % 3", 2.0)
+TEST_CONST(BinaryMod3, "7 % -3", -2.0)
+TEST_EVAL(BinaryMod, "x % 2", 3.5, 1.5)
+
+TEST_CONST(Power1, "2 ** 3", 8.0)
+TEST_CONST(Power2, "-2 ** 2", -4.0)
+TEST_CONST(Power3, "2 ** -1", 0.5)
+TEST_CONST(Power4, "2 ** 3 ** 2", 512.0)
+TEST_EVAL(Power, "x ** 2 * 3", 2, 12.0)
+
+TEST_CONST(Log2, "log2(8)", 3.0)
+TEST_CONST(Log10, "log10(1000)", 3.0)
+TEST_CONST(Hypot, "hypot(3, 4)", 5.0)
+TEST_CONST(CopySign, "copysign(2, -1)", -2.0)
+TEST_CONST(Tanh, "tanh(0)", 0.0)
+
 TEST_CONST(Arith1, "1 + -2 * 3", -5.0)
 TEST_CONST(Arith2, "(1 + -2) * 3", -3.0)
 TEST_CONST(Arith3, "-1 + 2 * 3", 5.0)
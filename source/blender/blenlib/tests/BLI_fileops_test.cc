@@ -1,6 +1,8 @@
 /* SPDX-License-Identifier: Apache-2.0 */
 
+#include "BLI_fileops.h"
 #include "BLI_fileops.hh"
+#include "BLI_vector.hh"
 
 #include "testing/testing.h"
 
@@ -37,4 +39,54 @@ TEST(fileops, fstream_open_charptr_filename)
   /* Reading the file not tested here. That's deferred to `std::fstream` anyway. */
 }
 
+TEST(fileops, zstd_from_mem_at_pos)
+{
+  FILE *file = tmpfile();
+  ASSERT_NE(file, nullptr);
+
+  /* Large enough for Zstd to split the work into multiple jobs when threading is supported. */
+  Vector<int> data(4 * 1024 * 1024);
+  for (const int i : data.index_range()) {
+    data[i] = i % 1000;
+  }
+  const size_t size = data.as_span().size_in_bytes();
+
+  const size_t offset = 16;
+  const size_t written = BLI_file_zstd_from_mem_at_pos(data.data(), size, file, offset, 3);
+  EXPECT_GT(written, 0);
+  EXPECT_LT(written, size);
+
+  Vector<int> result(data.size(), 0);
+  EXPECT_EQ(BLI_file_unzstd_to_mem_at_pos(result.data(), size, file, offset), size);
+  EXPECT_TRUE(result.as_span() == data.as_span());
+
+  fclose(file);
+}
+
+TEST(fileops, zstd_from_mem_at_pos_reuse_context)
+{
+  FILE *file = tmpfile();
+  ASSERT_NE(file, nullptr);
+
+  Vector<int> data(1024 * 1024);
+  for (const int i : data.index_range()) {
+    data[i] = i % 1000;
+  }
+  const size_t size = data.as_span().size_in_bytes();
+
+  /* Write multiple frames with the same context, as the sequencer disk cache does. */
+  ZSTD_CCtx_s *ctx = BLI_file_zstd_compress_context_create();
+  for (const int i : IndexRange(3)) {
+    const size_t offset = i * size;
+    EXPECT_GT(BLI_file_zstd_from_mem_at_pos_ex(ctx, data.data(), size, file, offset, i + 1), 0);
+
+    Vector<int> result(data.size(), 0);
+    EXPECT_EQ(BLI_file_unzstd_to_mem_at_pos(result.data(), size, file, offset), size);
+    EXPECT_TRUE(result.as_span() == data.as_span());
+  }
+  BLI_file_zstd_compress_context_free(ctx);
+
+  fclose(file);
+}
+
 }  // namespace blender::tests
@@ -0,0 +1,47 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_implicit_sharing.hh"
+
+namespace blender::tests {
+
+class TestSharingInfo : public ImplicitSharingInfo {
+ public:
+  bool *deleted_;
+
+  TestSharingInfo(bool *deleted) : deleted_(deleted)
+  {
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    *deleted_ = true;
+    delete this;
+  }
+};
+
+TEST(implicit_sharing, SingleUser)
+{
+  bool deleted = false;
+  const TestSharingInfo *info = new TestSharingInfo(&deleted);
+  EXPECT_TRUE(info->is_mutable());
+  info->remove_user_and_delete_if_last();
+  EXPECT_TRUE(deleted);
+}
+
+TEST(implicit_sharing, MultipleUsers)
+{
+  bool deleted = false;
+  const TestSharingInfo *info = new TestSharingInfo(&deleted);
+  info->add_user();
+  EXPECT_FALSE(info->is_mutable());
+  info->remove_user_and_delete_if_last();
+  EXPECT_FALSE(deleted);
+  EXPECT_TRUE(info->is_mutable());
+  info->remove_user_and_delete_if_last();
+  EXPECT_TRUE(deleted);
+}
+
+}  // namespace blender::tests
@@ -2,7 +2,7 @@
 
 #include "testing/testing.h"
 
-/* TODO: ray intersection, overlap ... etc. */
+/* TODO: overlap ... etc. */
 
 #include "MEM_guardedalloc.h"
 
@@ -132,3 +132,86 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+struct RaycastSpheres {
+  float (*centers)[3];
+  float radius;
+};
+
+static void raycast_sphere_callback(void *userdata,
+                                    int index,
+                                    const BVHTreeRay *ray,
+                                    BVHTreeRayHit *hit)
+{
+  const RaycastSpheres *spheres = (const RaycastSpheres *)userdata;
+  float to_center[3];
+  sub_v3_v3v3(to_center, spheres->centers[index], ray->origin);
+  const float dist_closest = dot_v3v3(to_center, ray->direction);
+  const float offset_sq = len_squared_v3(to_center) - dist_closest * dist_closest;
+  const float radius_sq = spheres->radius * spheres->radius;
+  if (offset_sq > radius_sq) {
+    return;
+  }
+  const float dist = dist_closest - sqrtf(radius_sq - offset_sq);
+  if (dist >= 0.0f && dist < hit->dist) {
+    hit->index = index;
+    hit->dist = dist;
+  }
+}
+
+static void raycast_spheres_test(int points_len, char tree_type, int random_seed)
+{
+  struct RNG *rng = BLI_rng_new(random_seed);
+  RaycastSpheres spheres;
+  spheres.radius = 0.05f;
+  spheres.centers = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+
+  /* Use the radius as epsilon, so that the spheres are inside of the leaf bounds. */
+  BVHTree *tree = BLI_bvhtree_new(points_len, spheres.radius, tree_type, 6);
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(spheres.centers[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, spheres.centers[i], 1);
+  }
+  BLI_bvhtree_balance(tree);
+
+  for (int ray_index = 0; ray_index < 200; ray_index++) {
+    float origin[3], direction[3];
+    rng_v3_round(origin, 3, rng, 1000, 2.0f);
+    do {
+      rng_v3_round(direction, 3, rng, 1000, 1.0f);
+    } while (normalize_v3(direction) == 0.0f);
+
+    BVHTreeRayHit hit;
+    hit.index = -1;
+    hit.dist = BVH_RAYCAST_DIST_MAX;
+    BLI_bvhtree_ray_cast(
+        tree, origin, direction, 0.0f, &hit, raycast_sphere_callback, &spheres);
+
+    /* Compare with testing all spheres. */
+    BVHTreeRay ray;
+    copy_v3_v3(ray.origin, origin);
+    copy_v3_v3(ray.direction, direction);
+    BVHTreeRayHit expected_hit;
+    expected_hit.index = -1;
+    expected_hit.dist = BVH_RAYCAST_DIST_MAX;
+    for (int i = 0; i < points_len; i++) {
+      raycast_sphere_callback(&spheres, i, &ray, &expected_hit);
+    }
+
+    EXPECT_EQ(hit.index, expected_hit.index);
+    EXPECT_FLOAT_EQ(hit.dist, expected_hit.dist);
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(spheres.centers);
+}
+
+TEST(kdopbvh, RaycastSpheres_Binary)
+{
+  raycast_spheres_test(500, 2, 12);
+}
+TEST(kdopbvh, RaycastSpheres_Quad)
+{
+  raycast_spheres_test(500, 4, 123);
+}
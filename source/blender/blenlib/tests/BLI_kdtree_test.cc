@@ -0,0 +1,161 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_array.hh"
+#include "BLI_kdtree.h"
+#include "BLI_math_vector.h"
+#include "BLI_rand.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
+
+static void find_nearest_array_test(const int points_len, const int random_seed)
+{
+  RNG *rng = BLI_rng_new(random_seed);
+  float(*points)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  float(*queries)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+
+  KDTree_3d *tree = BLI_kdtree_3d_new(points_len);
+  for (int i = 0; i < points_len; i++) {
+    BLI_rng_get_float_unit_v3(rng, points[i]);
+    mul_v3_fl(points[i], BLI_rng_get_float(rng));
+    BLI_rng_get_float_unit_v3(rng, queries[i]);
+    BLI_kdtree_3d_insert(tree, i, points[i]);
+  }
+  BLI_kdtree_3d_balance(tree);
+
+  KDTreeNearest_3d *nearest = (KDTreeNearest_3d *)MEM_mallocN(
+      sizeof(KDTreeNearest_3d) * points_len, __func__);
+  BLI_kdtree_3d_find_nearest_array(tree, queries, points_len, nearest);
+
+  for (int i = 0; i < points_len; i++) {
+    /* Every point should find itself. */
+    EXPECT_EQ(BLI_kdtree_3d_find_nearest(tree, points[i], nullptr), i);
+
+    /* Compare with testing all points, only for some queries to keep the test fast. */
+    if (i % 16 != 0) {
+      continue;
+    }
+    float expected_dist_sq = FLT_MAX;
+    for (int j = 0; j < points_len; j++) {
+      expected_dist_sq = min_ff(expected_dist_sq, len_squared_v3v3(queries[i], points[j]));
+    }
+    ASSERT_GE(nearest[i].index, 0);
+    EXPECT_FLOAT_EQ(len_squared_v3v3(queries[i], points[nearest[i].index]), expected_dist_sq);
+  }
+
+  BLI_kdtree_3d_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+  MEM_freeN(queries);
+  MEM_freeN(nearest);
+}
+
+TEST(kdtree, FindNearestArray_Small)
+{
+  find_nearest_array_test(500, 12);
+}
+
+TEST(kdtree, FindNearestArray_Threaded)
+{
+  /* Large enough for the tree to be balanced on multiple threads. */
+  BLI_threadapi_init();
+  BLI_task_scheduler_init();
+  find_nearest_array_test(30000, 123);
+  BLI_task_scheduler_exit();
+  BLI_threadapi_exit();
+}
+
+TEST(kdtree, FindNearestArray_Empty)
+{
+  KDTree_3d *tree = BLI_kdtree_3d_new(0);
+  BLI_kdtree_3d_balance(tree);
+  const float co[1][3] = {{0.0f, 0.0f, 0.0f}};
+  KDTreeNearest_3d nearest;
+  BLI_kdtree_3d_find_nearest_array(tree, co, 1, &nearest);
+  EXPECT_EQ(nearest.index, -1);
+  BLI_kdtree_3d_free(tree);
+}
+
+static void calc_duplicates_test(const int points_len,
+                                 const bool use_index_order,
+                                 const int positions_per_axis = 30)
+{
+  RNG *rng = BLI_rng_new(1234);
+  float(*points)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+
+  /* Round the coordinates to create exact duplicates, far enough from the merge distance. */
+  KDTree_3d *tree = BLI_kdtree_3d_new(points_len);
+  for (int i = 0; i < points_len; i++) {
+    for (int axis = 0; axis < 3; axis++) {
+      points[i][axis] = float(BLI_rng_get_int(rng) % positions_per_axis) / 100.0f;
+    }
+    BLI_kdtree_3d_insert(tree, i, points[i]);
+  }
+  BLI_kdtree_3d_balance(tree);
+
+  int *duplicates = (int *)MEM_mallocN(sizeof(int) * points_len, __func__);
+  for (int i = 0; i < points_len; i++) {
+    duplicates[i] = -1;
+  }
+  const int found = BLI_kdtree_3d_calc_duplicates_fast(tree, 0.005f, use_index_order, duplicates);
+
+  /* Points are merged into a target at the same position, the first point at each position is
+   * the target when using the index order. */
+  blender::Array<int> first_at_position(
+      positions_per_axis * positions_per_axis * positions_per_axis, -1);
+  int merged_num = 0;
+  for (int i = 0; i < points_len; i++) {
+    const int position = (int(points[i][0] * 100.5f) * positions_per_axis +
+                          int(points[i][1] * 100.5f)) *
+                             positions_per_axis +
+                         int(points[i][2] * 100.5f);
+    if (first_at_position[position] == -1) {
+      first_at_position[position] = i;
+    }
+    if (ELEM(duplicates[i], -1, i)) {
+      continue;
+    }
+    const int target = duplicates[i];
+    merged_num++;
+    EXPECT_EQ(duplicates[target], target);
+    EXPECT_EQ_ARRAY(points[i], points[target], 3);
+    if (use_index_order) {
+      EXPECT_EQ(target, first_at_position[position]);
+    }
+  }
+  EXPECT_EQ(found, merged_num);
+
+  /* One point remains at every position. */
+  int positions_num = 0;
+  for (const int first : first_at_position) {
+    positions_num += first != -1;
+  }
+  EXPECT_EQ(points_len - merged_num, positions_num);
+
+  BLI_kdtree_3d_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+  MEM_freeN(duplicates);
+}
+
+TEST(kdtree, CalcDuplicatesFast)
+{
+  calc_duplicates_test(5000, true);
+  calc_duplicates_test(5000, false);
+}
+
+TEST(kdtree, CalcDuplicatesFast_Threaded)
+{
+  BLI_threadapi_init();
+  BLI_task_scheduler_init();
+  calc_duplicates_test(50000, true);
+  calc_duplicates_test(50000, false);
+  /* Dense clusters with too many neighbors to store, searched on a single thread. */
+  calc_duplicates_test(50000, true, 3);
+  calc_duplicates_test(50000, false, 3);
+  BLI_task_scheduler_exit();
+  BLI_threadapi_exit();
+}
@@ -0,0 +1,73 @@
+/* SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <fstream>
+#include <sstream>
+
+#include "BLI_fileops.h"
+#include "BLI_profile.hh"
+#include "BLI_task.hh"
+
+namespace blender::profile::tests {
+
+static std::string read_file(const char *filepath)
+{
+  std::ifstream file(filepath);
+  std::stringstream stream;
+  stream << file.rdbuf();
+  return stream.str();
+}
+
+static int count_occurrences(const std::string &str, const std::string &pattern)
+{
+  int count = 0;
+  for (size_t pos = str.find(pattern); pos != std::string::npos;
+       pos = str.find(pattern, pos + 1)) {
+    count++;
+  }
+  return count;
+}
+
+TEST(profile, DisabledDoesNotRecord)
+{
+  EXPECT_FALSE(BLI_profile_trace_is_enabled());
+  EXPECT_EQ(BLI_profile_scope_begin(), 0u);
+  {
+    BLI_PROFILE_SCOPE("test");
+  }
+  /* Ending without a trace is a no-op. */
+  EXPECT_TRUE(BLI_profile_trace_end());
+}
+
+TEST(profile, ChromeTraceExport)
+{
+#ifdef WIN32
+  const char *filepath = "./profile_trace_test.json";
+#else
+  const char *filepath = "/tmp/profile_trace_test.json";
+#endif
+
+  BLI_profile_trace_begin(filepath);
+  EXPECT_TRUE(BLI_profile_trace_is_enabled());
+  {
+    BLI_PROFILE_SCOPE_NAMED("outer", "Named \"Scope\"");
+    threading::parallel_for(IndexRange(100), 1, [&](const IndexRange range) {
+      for ([[maybe_unused]] const int64_t i : range) {
+        BLI_PROFILE_SCOPE("inner");
+      }
+    });
+  }
+  EXPECT_TRUE(BLI_profile_trace_end());
+  EXPECT_FALSE(BLI_profile_trace_is_enabled());
+
+  const std::string trace = read_file(filepath);
+  BLI_delete(filepath, false, false);
+
+  EXPECT_EQ(trace.rfind("{\"traceEvents\":[", 0), 0u);
+  EXPECT_EQ(count_occurrences(trace, "\"name\":\"inner\""), 100);
+  EXPECT_EQ(count_occurrences(trace, "\"name\":\"Named \\\"Scope\\\"\",\"cat\":\"outer\""), 1);
+  EXPECT_EQ(count_occurrences(trace, "\"ph\":\"X\""), 101);
+}
+
+}  // namespace blender::profile::tests
@@ -10,6 +10,7 @@
 
 #include "BLI_utildefines.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
 #include "BLI_task.h"
@@ -294,3 +295,71 @@ TEST(task, ParallelInvoke)
                                       [&]() { counter++; });
   EXPECT_EQ(counter, 6);
 }
+
+/* *** Task pools of different priority. *** */
+
+static void task_pool_count_func(TaskPool *__restrict pool, void *UNUSED(taskdata))
+{
+  std::atomic<int> *counter = (std::atomic<int> *)BLI_task_pool_user_data(pool);
+  (*counter)++;
+}
+
+TEST(task, PoolPriority)
+{
+  BLI_threadapi_init();
+  BLI_task_scheduler_init();
+
+  for (const eTaskPriority priority : {TASK_PRIORITY_LOW, TASK_PRIORITY_HIGH}) {
+    std::atomic<int> counter = 0;
+    TaskPool *pool = BLI_task_pool_create(&counter, priority);
+    for (int i = 0; i < ITEMS_NUM; i++) {
+      BLI_task_pool_push(pool, task_pool_count_func, nullptr, false, nullptr);
+    }
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+    EXPECT_EQ(counter, ITEMS_NUM);
+  }
+
+  /* Parallel work spawned with low priority inherits the arena. */
+  std::atomic<int> counter = 0;
+  blender::threading::run_with_priority(TASK_PRIORITY_LOW, [&]() {
+    blender::threading::parallel_for(
+        blender::IndexRange(ITEMS_NUM), 32, [&](const blender::IndexRange range) {
+          counter += range.size();
+        });
+  });
+  EXPECT_EQ(counter, ITEMS_NUM);
+
+  BLI_task_scheduler_exit();
+  BLI_threadapi_exit();
+}
+
+TEST(task, ParallelScan)
+{
+  blender::Array<int> values(ITEMS_NUM);
+  for (const int i : values.index_range()) {
+    values[i] = i % 7;
+  }
+  blender::Array<int> offsets(ITEMS_NUM);
+  const int total = blender::threading::parallel_scan(
+      values.index_range(),
+      32,
+      0,
+      [&](const blender::IndexRange range, int sum, const bool is_final_scan) {
+        for (const int i : range) {
+          if (is_final_scan) {
+            offsets[i] = sum;
+          }
+          sum += values[i];
+        }
+        return sum;
+      },
+      std::plus<int>());
+
+  int expected_sum = 0;
+  for (const int i : values.index_range()) {
+    EXPECT_EQ(offsets[i], expected_sum);
+    expected_sum += values[i];
+  }
+  EXPECT_EQ(total, expected_sum);
+}
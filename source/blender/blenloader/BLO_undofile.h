@@ -69,6 +69,13 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
 void BLO_memfile_write_finalize(MemFileWriteData *mem_data);
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size);
+/**
+ * Add the chunks stored for the ID with the given session UUID in the reference #MemFile to the
+ * written one, sharing their memory, instead of writing the ID again.
+ *
+ * \return false when the reference #MemFile has no chunks for that ID.
+ */
+bool BLO_memfile_chunks_reuse_id(MemFileWriteData *mem_data, uint id_session_uuid);
 
 /* exports */
 
@@ -87,6 +94,15 @@ extern void BLO_memfile_merge(MemFile *first, MemFile *second);
  * Clear is_identical_future before adding next memfile.
  */
 extern void BLO_memfile_clear_future(MemFile *memfile);
+/**
+ * Copy all data of `memfile` into a single chunk of `r_memfile_copy`, which does not share
+ * memory with any undo step, so it can be used independently from the undo stack
+ * (e.g. written to disk from another thread).
+ *
+ * \note This allocates the full size of `memfile` again, callers should limit its use to
+ * memfiles which are small compared to the available memory.
+ */
+extern void BLO_memfile_copy_flat(const MemFile *memfile, MemFile *r_memfile_copy);
 
 /* Utilities. */
 
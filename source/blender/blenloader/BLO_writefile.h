@@ -46,6 +46,14 @@ struct BlendFileWriteParams {
   uint use_save_as_copy : 1;
   uint use_userdef : 1;
   const struct BlendThumbnail *thumb;
+  /**
+   * Compression settings, only used with #G_FILE_COMPRESS (zero uses the defaults).
+   * The output is a regular seekable zstd stream either way, reading is not affected.
+   */
+  /** Number of threads compressing frames in parallel. */
+  int compress_threads;
+  /** Uncompressed size in bytes of each compressed frame. */
+  int compress_frame_size;
 };
 
 /**
@@ -18,6 +18,7 @@
 #include "BLI_ghash.h"
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
+#include "BLI_profile.h"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
 
@@ -49,7 +50,7 @@ BlendHandle *BLO_blendhandle_from_file(const char *filepath, BlendFileReadReport
 {
   BlendHandle *bh;
 
-  bh = (BlendHandle *)blo_filedata_from_file(filepath, reports);
+  bh = (BlendHandle *)blo_filedata_from_library_file(filepath, reports);
 
   return bh;
 }
@@ -358,12 +359,14 @@ BlendFileData *BLO_read_from_file(const char *filepath,
   BlendFileData *bfd = NULL;
   FileData *fd;
 
+  BLI_PROFILE_SCOPE_BEGIN("File Read");
   fd = blo_filedata_from_file(filepath, reports);
   if (fd) {
     fd->skip_flags = skip_flags;
     bfd = blo_read_file_internal(fd, filepath);
     blo_filedata_free(fd);
   }
+  BLI_PROFILE_SCOPE_END(filepath);
 
   return bfd;
 }
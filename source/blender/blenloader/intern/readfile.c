@@ -53,6 +53,7 @@
 #include "BLI_math.h"
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "PIL_time.h"
@@ -1258,18 +1259,40 @@ static FileData *blo_filedata_from_file_open(const char *filepath, BlendFileRead
   return blo_filedata_from_file_descriptor(filepath, reports, file);
 }
 
-FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *reports)
+static FileData *blo_filedata_from_file_ex(const char *filepath,
+                                           BlendFileReadReport *reports,
+                                           const bool use_random_access)
 {
   FileData *fd = blo_filedata_from_file_open(filepath, reports);
   if (fd != NULL) {
     /* needed for library_append and read_libraries */
     BLI_strncpy(fd->relabase, filepath, sizeof(fd->relabase));
 
+#ifdef USE_BHEAD_READ_ON_DEMAND
+    if (use_random_access) {
+      /* Only the #BHead index is read up-front, data is read on demand for the IDs that are
+       * actually used. Avoid read-ahead paging in all the data we skip over. */
+      BLI_filereader_hint_random_access(fd->file);
+    }
+#else
+    UNUSED_VARS(use_random_access);
+#endif
+
     return blo_decode_and_check(fd, reports->reports);
   }
   return NULL;
 }
 
+FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *reports)
+{
+  return blo_filedata_from_file_ex(filepath, reports, false);
+}
+
+FileData *blo_filedata_from_library_file(const char *filepath, BlendFileReadReport *reports)
+{
+  return blo_filedata_from_file_ex(filepath, reports, true);
+}
+
 /**
  * Same as blo_filedata_from_file(), but does not reads DNA data, only header.
  * Use it for light access (e.g. thumbnail reading).
@@ -3049,11 +3072,101 @@ static bool direct_link_id(FileData *fd, Main *main, const int tag, ID *id, ID *
   return success;
 }
 
+/**
+ * Total size of the data-blocks of a single ID above which they are read in parallel,
+ * for smaller IDs the threading overhead outweighs the gain.
+ */
+#define READ_DATA_PARALLEL_SIZE_MIN (1 << 20)
+
+/**
+ * Return the number of data-blocks starting at `bhead` when they are worth reading in parallel,
+ * zero otherwise.
+ */
+static int read_data_parallel_count(FileData *fd, BHead *bhead)
+{
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  if (fd->file->seek != NULL) {
+    /* Data is read on demand from the file, which has to happen serially. */
+    return 0;
+  }
+#endif
+
+  int count = 0;
+  size_t size = 0;
+  for (; bhead && bhead->code == DATA; bhead = blo_bhead_next(fd, bhead)) {
+    count++;
+    size += (size_t)bhead->len;
+  }
+  return (count > 1 && size >= READ_DATA_PARALLEL_SIZE_MIN) ? count : 0;
+}
+
+typedef struct ReadDataParallelData {
+  FileData *fd;
+  BHead **bheads;
+  void **data;
+  const char *allocname;
+} ReadDataParallelData;
+
+static void read_data_parallel_fn(void *__restrict userdata,
+                                  const int i,
+                                  const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  ReadDataParallelData *data = userdata;
+  /* Only reads from the (already loaded) #BHead and the DNA, this is thread-safe. */
+  data->data[i] = read_struct(data->fd, data->bheads[i], data->allocname);
+}
+
+/**
+ * Two-phase variant of #read_data_into_datamap: gather the data-blocks of the ID, read them in
+ * parallel, then register them in the #OldNewMap (which is not thread-safe) once all are read.
+ */
+static BHead *read_data_into_datamap_parallel(FileData *fd,
+                                              BHead *bhead,
+                                              const int count,
+                                              const char *allocname)
+{
+  BHead **bheads = MEM_malloc_arrayN((size_t)count, sizeof(*bheads), __func__);
+  void **data = MEM_malloc_arrayN((size_t)count, sizeof(*data), __func__);
+
+  for (int i = 0; i < count; i++) {
+    BLI_assert(bhead->code == DATA);
+    bheads[i] = bhead;
+    bhead = blo_bhead_next(fd, bhead);
+  }
+
+  ReadDataParallelData userdata = {
+      .fd = fd,
+      .bheads = bheads,
+      .data = data,
+      .allocname = allocname,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, count, &userdata, read_data_parallel_fn, &settings);
+
+  for (int i = 0; i < count; i++) {
+    if (data[i]) {
+      oldnewmap_insert(fd->datamap, bheads[i]->old, data[i], 0);
+    }
+  }
+
+  MEM_freeN(bheads);
+  MEM_freeN(data);
+
+  return bhead;
+}
+
 /* Read all data associated with a datablock into datamap. */
 static BHead *read_data_into_datamap(FileData *fd, BHead *bhead, const char *allocname)
 {
   bhead = blo_bhead_next(fd, bhead);
 
+  const int parallel_count = read_data_parallel_count(fd, bhead);
+  if (parallel_count != 0) {
+    return read_data_into_datamap_parallel(fd, bhead, parallel_count, allocname);
+  }
+
   while (bhead && bhead->code == DATA) {
     /* The code below is useful for debugging leaks in data read from the blend file.
      * Without this the messages only tell us what ID-type the memory came from,
@@ -4770,10 +4883,135 @@ static void read_library_clear_weak_links(FileData *basefd, ListBase *mainlist,
   }
 }
 
+/* Libraries whose file is opened in parallel, see #read_libraries_open_files_threaded. */
+typedef struct LibraryFileOpenData {
+  Main *mainptr;
+  FileData *fd;
+  /** Reports of opening the file, added to the reports of the main file by
+   * #read_library_file_data, so they are only reported from the main thread. */
+  ReportList reports;
+} LibraryFileOpenData;
+
+static bool read_library_file_can_open_threaded(Main *mainptr)
+{
+  Library *lib = mainptr->curlib;
+  return lib->filedata == NULL && lib->packedfile == NULL && BLI_exists(lib->filepath_abs) &&
+         has_linked_ids_to_read(mainptr);
+}
+
+static void read_library_file_open_task(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  LibraryFileOpenData *open_data = taskdata;
+  /* The reports of the main file are not thread-safe, store them until the file is used. */
+  BlendFileReadReport reports = {.reports = &open_data->reports};
+  FileData *fd = blo_filedata_from_library_file(open_data->mainptr->curlib->filepath_abs,
+                                                &reports);
+  if (fd) {
+    fd->reports = NULL;
+#ifdef USE_GHASH_BHEAD
+    read_file_bhead_idname_map_create(fd);
+#endif
+  }
+  open_data->fd = fd;
+}
+
+/**
+ * Opening a library reads its whole #BHead index, which mainly waits on file IO. So open the
+ * files of all libraries that will be read in parallel, the actual reading of the linked
+ * data-blocks stays single threaded.
+ *
+ * \return The opened files, to be passed to #read_library_file_data, or NULL when no more than
+ * one file needs to be opened.
+ */
+static LibraryFileOpenData *read_libraries_open_files_threaded(Main *mainl, int *r_open_data_num)
+{
+  int open_data_num = 0;
+  for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
+    if (read_library_file_can_open_threaded(mainptr)) {
+      open_data_num++;
+    }
+  }
+
+  *r_open_data_num = 0;
+  if (open_data_num < 2) {
+    return NULL;
+  }
+
+  LibraryFileOpenData *open_datas = MEM_calloc_arrayN(
+      open_data_num, sizeof(*open_datas), __func__);
+  TaskPool *task_pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+
+  int i = 0;
+  for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
+    if (read_library_file_can_open_threaded(mainptr)) {
+      open_datas[i].mainptr = mainptr;
+      BKE_reports_init(&open_datas[i].reports, RPT_STORE | RPT_PRINT_HANDLED_BY_OWNER);
+      BLI_task_pool_push(task_pool, read_library_file_open_task, &open_datas[i], false, NULL);
+      i++;
+    }
+  }
+
+  BLI_task_pool_work_and_wait(task_pool);
+  BLI_task_pool_free(task_pool);
+
+  *r_open_data_num = open_data_num;
+  return open_datas;
+}
+
+/** The file of `mainptr` opened by #read_libraries_open_files_threaded, if any. */
+static LibraryFileOpenData *read_library_file_opened_find(LibraryFileOpenData *open_datas,
+                                                          const int open_data_num,
+                                                          Main *mainptr)
+{
+  for (int i = 0; i < open_data_num; i++) {
+    if (open_datas[i].mainptr == mainptr) {
+      return &open_datas[i];
+    }
+  }
+  return NULL;
+}
+
+/**
+ * Take ownership of a file opened by #read_libraries_open_files_threaded, adding the reports of
+ * opening it to `reports` (failing to open it is not retried).
+ */
+static FileData *read_library_file_opened_pop(LibraryFileOpenData *open_data,
+                                              BlendFileReadReport *reports)
+{
+  LISTBASE_FOREACH (const Report *, report, &open_data->reports.list) {
+    BKE_report(reports->reports, report->type, report->message);
+  }
+  BKE_reports_clear(&open_data->reports);
+
+  FileData *fd = open_data->fd;
+  open_data->fd = NULL;
+  return fd;
+}
+
+static void read_libraries_open_files_free(LibraryFileOpenData *open_datas,
+                                           const int open_data_num)
+{
+  if (open_datas == NULL) {
+    return;
+  }
+  for (int i = 0; i < open_data_num; i++) {
+    if (open_datas[i].fd) {
+      blo_filedata_free(open_datas[i].fd);
+    }
+    BKE_reports_clear(&open_datas[i].reports);
+  }
+  MEM_freeN(open_datas);
+}
+
+/**
+ * \param open_data: The library file opened by #read_libraries_open_files_threaded,
+ * or NULL to open it here.
+ */
 static FileData *read_library_file_data(FileData *basefd,
                                         ListBase *mainlist,
                                         Main *mainl,
-                                        Main *mainptr)
+                                        Main *mainptr,
+                                        LibraryFileOpenData *open_data)
 {
   FileData *fd = mainptr->curlib->filedata;
 
@@ -4804,7 +5042,9 @@ static FileData *read_library_file_data(FileData *basefd,
                      mainptr->curlib->filepath_abs,
                      mainptr->curlib->filepath,
                      library_parent_filepath(mainptr->curlib));
-    fd = blo_filedata_from_file(mainptr->curlib->filepath_abs, basefd->reports);
+    fd = open_data ? read_library_file_opened_pop(open_data, basefd->reports) :
+                     blo_filedata_from_library_file(mainptr->curlib->filepath_abs,
+                                                    basefd->reports);
   }
 
   if (fd) {
@@ -4828,7 +5068,9 @@ static FileData *read_library_file_data(FileData *basefd,
     /* subversion */
     read_file_version(fd, mainptr);
 #ifdef USE_GHASH_BHEAD
-    read_file_bhead_idname_map_create(fd);
+    if (fd->bhead_idname_hash == NULL) {
+      read_file_bhead_idname_map_create(fd);
+    }
 #endif
   }
   else {
@@ -4866,6 +5108,9 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
   while (do_it) {
     do_it = false;
 
+    int open_data_num;
+    LibraryFileOpenData *open_datas = read_libraries_open_files_threaded(mainl, &open_data_num);
+
     /* Loop over mains of all library blend files encountered so far. Note
      * this list gets longer as more indirectly library blends are found. */
     for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
@@ -4878,7 +5123,12 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
                   mainptr->curlib->filepath);
 
         /* Open file if it has not been done yet. */
-        FileData *fd = read_library_file_data(basefd, mainlist, mainl, mainptr);
+        FileData *fd = read_library_file_data(
+            basefd,
+            mainlist,
+            mainl,
+            mainptr,
+            read_library_file_opened_find(open_datas, open_data_num, mainptr));
 
         if (fd) {
           do_it = true;
@@ -4897,6 +5147,8 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
         BLO_expand_main(fd, mainptr);
       }
     }
+
+    read_libraries_open_files_free(open_datas, open_data_num);
   }
 
   Main *main_newid = BKE_main_new();
@@ -121,6 +121,12 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath);
  * cannot be called with relative paths anymore!
  */
 FileData *blo_filedata_from_file(const char *filepath, struct BlendFileReadReport *reports);
+/**
+ * Same as #blo_filedata_from_file, for files where only some of the IDs are expected to be
+ * read (linked libraries, link/append), data-blocks are then paged in on demand.
+ */
+FileData *blo_filedata_from_library_file(const char *filepath,
+                                         struct BlendFileReadReport *reports);
 FileData *blo_filedata_from_memory(const void *mem,
                                    int memsize,
                                    struct BlendFileReadReport *reports);
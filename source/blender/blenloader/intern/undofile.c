@@ -93,6 +93,33 @@ void BLO_memfile_clear_future(MemFile *memfile)
   }
 }
 
+void BLO_memfile_copy_flat(const MemFile *memfile, MemFile *r_memfile_copy)
+{
+  size_t size = 0;
+  LISTBASE_FOREACH (const MemFileChunk *, chunk, &memfile->chunks) {
+    size += chunk->size;
+  }
+
+  BLI_listbase_clear(&r_memfile_copy->chunks);
+  r_memfile_copy->size = size;
+  if (size == 0) {
+    return;
+  }
+
+  char *buf = MEM_mallocN(size, "Chunk buffer");
+  char *buf_iter = buf;
+  LISTBASE_FOREACH (const MemFileChunk *, chunk, &memfile->chunks) {
+    memcpy(buf_iter, chunk->buf, chunk->size);
+    buf_iter += chunk->size;
+  }
+
+  MemFileChunk *chunk_copy = MEM_callocN(sizeof(MemFileChunk), "MemFileChunk");
+  chunk_copy->buf = buf;
+  chunk_copy->size = size;
+  chunk_copy->id_session_uuid = MAIN_ID_SESSION_UUID_UNSET;
+  BLI_addtail(&r_memfile_copy->chunks, chunk_copy);
+}
+
 void BLO_memfile_write_init(MemFileWriteData *mem_data,
                             MemFile *written_memfile,
                             MemFile *reference_memfile)
@@ -172,6 +199,36 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   }
 }
 
+bool BLO_memfile_chunks_reuse_id(MemFileWriteData *mem_data, const uint id_session_uuid)
+{
+  if (mem_data->id_session_uuid_mapping == NULL) {
+    return false;
+  }
+  MemFileChunk *compchunk = BLI_ghash_lookup(mem_data->id_session_uuid_mapping,
+                                             POINTER_FROM_UINT(id_session_uuid));
+  if (compchunk == NULL) {
+    return false;
+  }
+
+  MemFile *memfile = mem_data->written_memfile;
+  for (; compchunk != NULL && compchunk->id_session_uuid == id_session_uuid;
+       compchunk = compchunk->next) {
+    MemFileChunk *curchunk = MEM_mallocN(sizeof(MemFileChunk), "MemFileChunk");
+    curchunk->size = compchunk->size;
+    curchunk->buf = compchunk->buf;
+    curchunk->is_identical = true;
+    curchunk->is_identical_future = true;
+    curchunk->id_session_uuid = id_session_uuid;
+    BLI_addtail(&memfile->chunks, curchunk);
+
+    compchunk->is_identical_future = true;
+  }
+
+  /* Following IDs are most likely stored right after this one. */
+  mem_data->reference_current_chunk = compchunk;
+  return true;
+}
+
 struct Main *BLO_memfile_main_get(struct MemFile *memfile,
                                   struct Main *bmain,
                                   struct Scene **r_scene)
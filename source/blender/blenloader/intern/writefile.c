@@ -89,6 +89,7 @@
 #include "BLI_linklist.h"
 #include "BLI_math_base.h"
 #include "BLI_mempool.h"
+#include "BLI_profile.h"
 #include "BLI_threads.h"
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
@@ -130,6 +131,9 @@
 
 #define ZSTD_BUFFER_SIZE (1 << 21) /* 2mb */
 #define ZSTD_CHUNK_SIZE (1 << 20)  /* 1mb */
+/* Limits for #BlendFileWriteParams.compress_frame_size. */
+#define ZSTD_BUFFER_SIZE_MIN (1 << 16) /* 64kb */
+#define ZSTD_BUFFER_SIZE_MAX (1 << 28) /* 256mb */
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
@@ -174,6 +178,13 @@ struct WriteWrap {
 
     int level;
     ListBase frames;
+    /** Idle compression contexts (#LinkData with a `ZSTD_CCtx`). */
+    ListBase contexts;
+
+    /** Number of compression threads, zero for the default. */
+    int num_threads;
+    /** Size of the (uncompressed) frames, zero for the default. */
+    int frame_size;
 
     bool write_error;
   } zstd;
@@ -217,14 +228,23 @@ static void *zstd_write_task(void *userdata)
   ZstdWriteBlockTask *task = userdata;
   WriteWrap *ww = task->ww;
 
+  /* Re-use compression contexts between frames, creating one is relatively expensive. */
+  BLI_mutex_lock(&ww->zstd.mutex);
+  LinkData *ctx_link = BLI_pophead(&ww->zstd.contexts);
+  BLI_mutex_unlock(&ww->zstd.mutex);
+  if (ctx_link == NULL) {
+    ctx_link = BLI_genericNodeN(ZSTD_createCCtx());
+  }
+
   size_t out_buf_len = ZSTD_compressBound(task->size);
   void *out_buf = MEM_mallocN(out_buf_len, "Zstd out buffer");
-  size_t out_size = ZSTD_compress(
-      out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
+  size_t out_size = ZSTD_compressCCtx(
+      ctx_link->data, out_buf, out_buf_len, task->data, task->size, ZSTD_COMPRESSION_LEVEL);
 
   MEM_freeN(task->data);
 
   BLI_mutex_lock(&ww->zstd.mutex);
+  BLI_addtail(&ww->zstd.contexts, ctx_link);
 
   while (ww->zstd.next_frame != task->frame_number) {
     BLI_condition_wait(&ww->zstd.condition, &ww->zstd.mutex);
@@ -262,6 +282,9 @@ static bool ww_open_zstd(WriteWrap *ww, const char *filepath)
 
   /* Leave one thread open for the main writing logic, unless we only have one HW thread. */
   int num_threads = max_ii(1, BLI_system_thread_count() - 1);
+  if (ww->zstd.num_threads > 0) {
+    num_threads = min_ii(ww->zstd.num_threads, BLENDER_MAX_THREADS);
+  }
   BLI_threadpool_init(&ww->zstd.threadpool, zstd_write_task, num_threads);
   BLI_mutex_init(&ww->zstd.mutex);
   BLI_condition_init(&ww->zstd.condition);
@@ -315,6 +338,11 @@ static bool ww_close_zstd(WriteWrap *ww)
   BLI_threadpool_end(&ww->zstd.threadpool);
   BLI_freelistN(&ww->zstd.tasks);
 
+  LISTBASE_FOREACH (LinkData *, ctx_link, &ww->zstd.contexts) {
+    ZSTD_freeCCtx(ctx_link->data);
+  }
+  BLI_freelistN(&ww->zstd.contexts);
+
   BLI_mutex_end(&ww->zstd.mutex);
   BLI_condition_end(&ww->zstd.condition);
 
@@ -443,6 +471,12 @@ static WriteData *writedata_new(WriteWrap *ww)
       wd->buffer.max_size = MEM_BUFFER_SIZE;
       wd->buffer.chunk_size = MEM_CHUNK_SIZE;
     }
+    else if (ww->zstd.frame_size > 0) {
+      /* Every flush of the buffer becomes one compressed frame. */
+      wd->buffer.max_size = clamp_i(
+          ww->zstd.frame_size, ZSTD_BUFFER_SIZE_MIN, ZSTD_BUFFER_SIZE_MAX);
+      wd->buffer.chunk_size = wd->buffer.max_size / 2;
+    }
     else {
       wd->buffer.max_size = ZSTD_BUFFER_SIZE;
       wd->buffer.chunk_size = ZSTD_CHUNK_SIZE;
@@ -631,6 +665,23 @@ static void mywrite_id_begin(WriteData *wd, ID *id)
   }
 }
 
+/**
+ * Undo only: re-use the chunks of the previous undo step for an ID that was not tagged for any
+ * update since then (see #UserDef_Experimental.use_undo_skip_unchanged_ids).
+ *
+ * \return true when the ID does not need to be written.
+ */
+static bool mywrite_id_reuse_unchanged(WriteData *wd, ID *id, const bool id_is_unchanged)
+{
+  if (!wd->use_memfile || !id_is_unchanged ||
+      !USER_EXPERIMENTAL_TEST(&U, use_undo_skip_unchanged_ids)) {
+    return false;
+  }
+  /* The data of every ID starts in a new chunk. */
+  BLI_assert(wd->buffer.used_len == 0);
+  return BLO_memfile_chunks_reuse_id(&wd->mem, id->session_uuid);
+}
+
 /**
  * Start writing of data related to a single ID.
  *
@@ -1156,7 +1207,12 @@ static bool write_file_handle(Main *mainvar,
           BKE_lib_override_library_operations_store_start(bmain, override_storage, id);
         }
 
+        /* Whether the ID and its embedded IDs were not tagged for any update since the
+         * previous undo push. */
+        bool id_is_unchanged = false;
         if (wd->use_memfile) {
+          id_is_unchanged = (id->recalc_after_undo_push == 0);
+
           /* Record the changes that happened up to this undo push in
            * recalc_up_to_undo_push, and clear recalc_after_undo_push again
            * to start accumulating for the next undo push. */
@@ -1165,12 +1221,14 @@ static bool write_file_handle(Main *mainvar,
 
           bNodeTree *nodetree = ntreeFromID(id);
           if (nodetree != NULL) {
+            id_is_unchanged &= (nodetree->id.recalc_after_undo_push == 0);
             nodetree->id.recalc_up_to_undo_push = nodetree->id.recalc_after_undo_push;
             nodetree->id.recalc_after_undo_push = 0;
           }
           if (GS(id->name) == ID_SCE) {
             Scene *scene = (Scene *)id;
             if (scene->master_collection != NULL) {
+              id_is_unchanged &= (scene->master_collection->id.recalc_after_undo_push == 0);
               scene->master_collection->id.recalc_up_to_undo_push =
                   scene->master_collection->id.recalc_after_undo_push;
               scene->master_collection->id.recalc_after_undo_push = 0;
@@ -1178,6 +1236,10 @@ static bool write_file_handle(Main *mainvar,
           }
         }
 
+        if (mywrite_id_reuse_unchanged(wd, id, id_is_unchanged)) {
+          continue;
+        }
+
         mywrite_id_begin(wd, id);
 
         memcpy(id_buffer, id, idtype_struct_size);
@@ -1333,6 +1395,10 @@ bool BLO_write_file(Main *mainvar,
   BLI_snprintf(tempname, sizeof(tempname), "%s@", filepath);
 
   ww_handle_init((write_flags & G_FILE_COMPRESS) ? WW_WRAP_ZSTD : WW_WRAP_NONE, &ww);
+  if (write_flags & G_FILE_COMPRESS) {
+    ww.zstd.num_threads = params->compress_threads;
+    ww.zstd.frame_size = params->compress_frame_size;
+  }
 
   if (ww.open(&ww, tempname) == false) {
     BKE_reportf(
@@ -1416,9 +1482,11 @@ bool BLO_write_file(Main *mainvar,
   }
 
   /* actual file writing */
-  const bool err = write_file_handle(mainvar, &ww, NULL, NULL, write_flags, use_userdef, thumb);
-
+  bool err;
+  BLI_PROFILE_SCOPE_BEGIN("File Write");
+  err = write_file_handle(mainvar, &ww, NULL, NULL, write_flags, use_userdef, thumb);
   ww.close(&ww);
+  BLI_PROFILE_SCOPE_END(filepath);
 
   if (UNLIKELY(path_list_backup)) {
     BKE_bpath_list_restore(mainvar, path_list_flag, path_list_backup);
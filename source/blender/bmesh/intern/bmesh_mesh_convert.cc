@@ -83,6 +83,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 
 #include "BKE_customdata.h"
 #include "BKE_mesh.h"
@@ -103,6 +104,7 @@ static CLG_LogRef LOG = {"bmesh.mesh.convert"};
 
 using blender::Array;
 using blender::IndexRange;
+using blender::MutableSpan;
 using blender::Span;
 
 void BM_mesh_cd_flag_ensure(BMesh *bm, Mesh *mesh, const char cd_flag)
@@ -888,6 +890,62 @@ static void bm_to_mesh_shape(BMesh *bm,
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name BMesh to Mesh Element Tables
+ *
+ * Building the tables serially also assigns the element indices, after that the vertex, edge,
+ * loop and face data can be copied in parallel, since the passes only refer to each other by
+ * index. Local tables are used so the BMesh's own element tables are left untouched.
+ * \{ */
+
+static void bm_vert_table_build(BMesh &bm, MutableSpan<BMVert *> table)
+{
+  BMIter iter;
+  BMVert *vert;
+  int i;
+  BM_ITER_MESH_INDEX (vert, &iter, &bm, BM_VERTS_OF_MESH, i) {
+    BM_elem_index_set(vert, i); /* set_inline */
+    table[i] = vert;
+  }
+  bm.elem_index_dirty &= ~BM_VERT;
+}
+
+static void bm_edge_table_build(BMesh &bm, MutableSpan<BMEdge *> table)
+{
+  BMIter iter;
+  BMEdge *edge;
+  int i;
+  BM_ITER_MESH_INDEX (edge, &iter, &bm, BM_EDGES_OF_MESH, i) {
+    BM_elem_index_set(edge, i); /* set_inline */
+    table[i] = edge;
+  }
+  bm.elem_index_dirty &= ~BM_EDGE;
+}
+
+static void bm_face_loop_table_build(BMesh &bm,
+                                     MutableSpan<BMFace *> face_table,
+                                     MutableSpan<BMLoop *> loop_table)
+{
+  BMIter iter;
+  BMFace *face;
+  int face_i;
+  int loop_i = 0;
+  BM_ITER_MESH_INDEX (face, &iter, &bm, BM_FACES_OF_MESH, face_i) {
+    BM_elem_index_set(face, face_i); /* set_inline */
+    face_table[face_i] = face;
+    BMLoop *loop = BM_FACE_FIRST_LOOP(face);
+    for ([[maybe_unused]] const int i : IndexRange(face->len)) {
+      BM_elem_index_set(loop, loop_i); /* set_inline */
+      loop_table[loop_i] = loop;
+      loop_i++;
+      loop = loop->next;
+    }
+  }
+  bm.elem_index_dirty &= ~(BM_FACE | BM_LOOP);
+}
+
+/** \} */
+
 BLI_INLINE void bmesh_quick_edgedraw_flag(MEdge *med, BMEdge *e)
 {
   /* This is a cheap way to set the edge draw, its not precise and will
@@ -907,10 +965,7 @@ BLI_INLINE void bmesh_quick_edgedraw_flag(MEdge *med, BMEdge *e)
 
 void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *me, const struct BMeshToMeshParams *params)
 {
-  MEdge *med;
-  BMVert *v, *eve;
-  BMEdge *e;
-  BMFace *f;
+  BMVert *eve;
   BMIter iter;
   int i, j;
 
@@ -970,90 +1025,92 @@ void BM_mesh_bm_to_me(Main *bmain, BMesh *bm, Mesh *me, const struct BMeshToMesh
   /* This is called again, 'dotess' arg is used there. */
   BKE_mesh_update_customdata_pointers(me, false);
 
-  i = 0;
-  BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
-    copy_v3_v3(mvert->co, v->co);
+  Array<BMVert *> vert_table(bm->totvert);
+  Array<BMEdge *> edge_table(bm->totedge);
+  Array<BMFace *> face_table(bm->totface);
+  Array<BMLoop *> loop_table(bm->totloop);
+  bm_vert_table_build(*bm, vert_table);
+  bm_edge_table_build(*bm, edge_table);
+  bm_face_loop_table_build(*bm, face_table, loop_table);
 
-    mvert->flag = BM_vert_flag_to_mflag(v);
+  blender::threading::parallel_for(vert_table.index_range(), 1024, [&](IndexRange range) {
+    for (const int i : range) {
+      BMVert *v = vert_table[i];
+      MVert *mv = &mvert[i];
+      copy_v3_v3(mv->co, v->co);
 
-    BM_elem_index_set(v, i); /* set_inline */
+      mv->flag = BM_vert_flag_to_mflag(v);
 
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->vdata, &me->vdata, v->head.data, i);
+      /* Copy over custom-data. */
+      CustomData_from_bmesh_block(&bm->vdata, &me->vdata, v->head.data, i);
 
-    if (cd_vert_bweight_offset != -1) {
-      mvert->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(v, cd_vert_bweight_offset);
+      if (cd_vert_bweight_offset != -1) {
+        mv->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(v, cd_vert_bweight_offset);
+      }
+
+      BM_CHECK_ELEMENT(v);
     }
+  });
 
-    i++;
-    mvert++;
+  blender::threading::parallel_for(edge_table.index_range(), 1024, [&](IndexRange range) {
+    for (const int i : range) {
+      BMEdge *e = edge_table[i];
+      MEdge *med = &medge[i];
+      med->v1 = BM_elem_index_get(e->v1);
+      med->v2 = BM_elem_index_get(e->v2);
 
-    BM_CHECK_ELEMENT(v);
-  }
-  bm->elem_index_dirty &= ~BM_VERT;
+      med->flag = BM_edge_flag_to_mflag(e);
 
-  med = medge;
-  i = 0;
-  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
-    med->v1 = BM_elem_index_get(e->v1);
-    med->v2 = BM_elem_index_get(e->v2);
+      /* Copy over custom-data. */
+      CustomData_from_bmesh_block(&bm->edata, &me->edata, e->head.data, i);
 
-    med->flag = BM_edge_flag_to_mflag(e);
+      bmesh_quick_edgedraw_flag(med, e);
 
-    BM_elem_index_set(e, i); /* set_inline */
+      if (cd_edge_crease_offset != -1) {
+        med->crease = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(e, cd_edge_crease_offset);
+      }
+      if (cd_edge_bweight_offset != -1) {
+        med->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(e, cd_edge_bweight_offset);
+      }
 
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->edata, &me->edata, e->head.data, i);
+      BM_CHECK_ELEMENT(e);
+    }
+  });
 
-    bmesh_quick_edgedraw_flag(med, e);
+  blender::threading::parallel_for(loop_table.index_range(), 2048, [&](IndexRange range) {
+    for (const int i : range) {
+      BMLoop *l = loop_table[i];
+      MLoop *ml = &mloop[i];
+      ml->e = BM_elem_index_get(l->e);
+      ml->v = BM_elem_index_get(l->v);
 
-    if (cd_edge_crease_offset != -1) {
-      med->crease = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(e, cd_edge_crease_offset);
-    }
-    if (cd_edge_bweight_offset != -1) {
-      med->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(e, cd_edge_bweight_offset);
+      /* Copy over custom-data. */
+      CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l->head.data, i);
+
+      BM_CHECK_ELEMENT(l);
+      BM_CHECK_ELEMENT(l->e);
+      BM_CHECK_ELEMENT(l->v);
     }
+  });
 
-    i++;
-    med++;
-    BM_CHECK_ELEMENT(e);
-  }
-  bm->elem_index_dirty &= ~BM_EDGE;
-
-  i = 0;
-  j = 0;
-  BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
-    BMLoop *l_iter, *l_first;
-    mpoly->loopstart = j;
-    mpoly->totloop = f->len;
-    mpoly->mat_nr = f->mat_nr;
-    mpoly->flag = BM_face_flag_to_mflag(f);
-
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      mloop->e = BM_elem_index_get(l_iter->e);
-      mloop->v = BM_elem_index_get(l_iter->v);
+  blender::threading::parallel_for(face_table.index_range(), 1024, [&](IndexRange range) {
+    for (const int i : range) {
+      BMFace *f = face_table[i];
+      MPoly *mp = &mpoly[i];
+      mp->loopstart = BM_elem_index_get(BM_FACE_FIRST_LOOP(f));
+      mp->totloop = f->len;
+      mp->mat_nr = f->mat_nr;
+      mp->flag = BM_face_flag_to_mflag(f);
 
       /* Copy over custom-data. */
-      CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l_iter->head.data, j);
-
-      j++;
-      mloop++;
-      BM_CHECK_ELEMENT(l_iter);
-      BM_CHECK_ELEMENT(l_iter->e);
-      BM_CHECK_ELEMENT(l_iter->v);
-    } while ((l_iter = l_iter->next) != l_first);
+      CustomData_from_bmesh_block(&bm->pdata, &me->pdata, f->head.data, i);
 
-    if (f == bm->act_face) {
-      me->act_face = i;
+      BM_CHECK_ELEMENT(f);
     }
+  });
 
-    /* Copy over custom-data. */
-    CustomData_from_bmesh_block(&bm->pdata, &me->pdata, f->head.data, i);
-
-    i++;
-    mpoly++;
-    BM_CHECK_ELEMENT(f);
+  if (bm->act_face) {
+    me->act_face = BM_elem_index_get(bm->act_face);
   }
 
   /* Patch hook indices and vertex parents. */
@@ -1199,15 +1256,10 @@ void BM_mesh_bm_to_me_for_eval(BMesh *bm, Mesh *me, const CustomData_MeshMasks *
 
   BKE_mesh_update_customdata_pointers(me, false);
 
-  BMIter iter;
-  BMVert *eve;
-  BMEdge *eed;
-  BMFace *efa;
   MVert *mvert = me->mvert;
   MEdge *medge = me->medge;
   MLoop *mloop = me->mloop;
   MPoly *mpoly = me->mpoly;
-  unsigned int i, j;
 
   const int cd_vert_bweight_offset = CustomData_get_offset(&bm->vdata, CD_BWEIGHT);
   const int cd_edge_bweight_offset = CustomData_get_offset(&bm->edata, CD_BWEIGHT);
@@ -1219,80 +1271,84 @@ void BM_mesh_bm_to_me_for_eval(BMesh *bm, Mesh *me, const CustomData_MeshMasks *
 
   me->runtime.deformed_only = true;
 
-  BM_ITER_MESH_INDEX (eve, &iter, bm, BM_VERTS_OF_MESH, i) {
-    MVert *mv = &mvert[i];
+  Array<BMVert *> vert_table(bm->totvert);
+  Array<BMEdge *> edge_table(bm->totedge);
+  Array<BMFace *> face_table(bm->totface);
+  Array<BMLoop *> loop_table(bm->totloop);
+  bm_vert_table_build(*bm, vert_table);
+  bm_edge_table_build(*bm, edge_table);
+  bm_face_loop_table_build(*bm, face_table, loop_table);
 
-    copy_v3_v3(mv->co, eve->co);
+  blender::threading::parallel_for(vert_table.index_range(), 1024, [&](IndexRange range) {
+    for (const int i : range) {
+      BMVert *eve = vert_table[i];
+      MVert *mv = &mvert[i];
 
-    BM_elem_index_set(eve, i); /* set_inline */
+      copy_v3_v3(mv->co, eve->co);
 
-    mv->flag = BM_vert_flag_to_mflag(eve);
+      mv->flag = BM_vert_flag_to_mflag(eve);
 
-    if (cd_vert_bweight_offset != -1) {
-      mv->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eve, cd_vert_bweight_offset);
-    }
+      if (cd_vert_bweight_offset != -1) {
+        mv->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eve, cd_vert_bweight_offset);
+      }
 
-    CustomData_from_bmesh_block(&bm->vdata, &me->vdata, eve->head.data, i);
-  }
-  bm->elem_index_dirty &= ~BM_VERT;
+      CustomData_from_bmesh_block(&bm->vdata, &me->vdata, eve->head.data, i);
+    }
+  });
 
-  BM_ITER_MESH_INDEX (eed, &iter, bm, BM_EDGES_OF_MESH, i) {
-    MEdge *med = &medge[i];
+  blender::threading::parallel_for(edge_table.index_range(), 1024, [&](IndexRange range) {
+    for (const int i : range) {
+      BMEdge *eed = edge_table[i];
+      MEdge *med = &medge[i];
 
-    BM_elem_index_set(eed, i); /* set_inline */
+      med->v1 = BM_elem_index_get(eed->v1);
+      med->v2 = BM_elem_index_get(eed->v2);
 
-    med->v1 = BM_elem_index_get(eed->v1);
-    med->v2 = BM_elem_index_get(eed->v2);
+      med->flag = BM_edge_flag_to_mflag(eed);
 
-    med->flag = BM_edge_flag_to_mflag(eed);
+      /* Handle this differently to editmode switching,
+       * only enable draw for single user edges rather than calculating angle. */
+      if ((med->flag & ME_EDGEDRAW) == 0) {
+        if (eed->l && eed->l == eed->l->radial_next) {
+          med->flag |= ME_EDGEDRAW;
+        }
+      }
 
-    /* Handle this differently to editmode switching,
-     * only enable draw for single user edges rather than calculating angle. */
-    if ((med->flag & ME_EDGEDRAW) == 0) {
-      if (eed->l && eed->l == eed->l->radial_next) {
-        med->flag |= ME_EDGEDRAW;
+      if (cd_edge_crease_offset != -1) {
+        med->crease = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eed, cd_edge_crease_offset);
+      }
+      if (cd_edge_bweight_offset != -1) {
+        med->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eed, cd_edge_bweight_offset);
       }
-    }
 
-    if (cd_edge_crease_offset != -1) {
-      med->crease = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eed, cd_edge_crease_offset);
+      CustomData_from_bmesh_block(&bm->edata, &me->edata, eed->head.data, i);
     }
-    if (cd_edge_bweight_offset != -1) {
-      med->bweight = BM_ELEM_CD_GET_FLOAT_AS_UCHAR(eed, cd_edge_bweight_offset);
-    }
-
-    CustomData_from_bmesh_block(&bm->edata, &me->edata, eed->head.data, i);
-  }
-  bm->elem_index_dirty &= ~BM_EDGE;
+  });
 
-  j = 0;
-  BM_ITER_MESH_INDEX (efa, &iter, bm, BM_FACES_OF_MESH, i) {
-    BMLoop *l_iter;
-    BMLoop *l_first;
-    MPoly *mp = &mpoly[i];
+  blender::threading::parallel_for(loop_table.index_range(), 2048, [&](IndexRange range) {
+    for (const int i : range) {
+      BMLoop *l = loop_table[i];
+      MLoop *ml = &mloop[i];
 
-    BM_elem_index_set(efa, i); /* set_inline */
-
-    mp->totloop = efa->len;
-    mp->flag = BM_face_flag_to_mflag(efa);
-    mp->loopstart = j;
-    mp->mat_nr = efa->mat_nr;
-
-    l_iter = l_first = BM_FACE_FIRST_LOOP(efa);
-    do {
-      mloop->v = BM_elem_index_get(l_iter->v);
-      mloop->e = BM_elem_index_get(l_iter->e);
-      CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l_iter->head.data, j);
+      ml->v = BM_elem_index_get(l->v);
+      ml->e = BM_elem_index_get(l->e);
+      CustomData_from_bmesh_block(&bm->ldata, &me->ldata, l->head.data, i);
+    }
+  });
 
-      BM_elem_index_set(l_iter, j); /* set_inline */
+  blender::threading::parallel_for(face_table.index_range(), 1024, [&](IndexRange range) {
+    for (const int i : range) {
+      BMFace *efa = face_table[i];
+      MPoly *mp = &mpoly[i];
 
-      j++;
-      mloop++;
-    } while ((l_iter = l_iter->next) != l_first);
+      mp->totloop = efa->len;
+      mp->flag = BM_face_flag_to_mflag(efa);
+      mp->loopstart = BM_elem_index_get(BM_FACE_FIRST_LOOP(efa));
+      mp->mat_nr = efa->mat_nr;
 
-    CustomData_from_bmesh_block(&bm->pdata, &me->pdata, efa->head.data, i);
-  }
-  bm->elem_index_dirty &= ~(BM_FACE | BM_LOOP);
+      CustomData_from_bmesh_block(&bm->pdata, &me->pdata, efa->head.data, i);
+    }
+  });
 
   me->cd_flag = BM_mesh_cd_flag_from_bmesh(bm);
 }
@@ -16,6 +16,7 @@ extern "C" {
 #endif
 
 struct Depsgraph;
+struct ID;
 struct Scene;
 struct ViewLayer;
 
@@ -42,6 +43,31 @@ void DEG_stats_simple(const struct Depsgraph *graph,
                       size_t *r_operations,
                       size_t *r_relations);
 
+/* ************************************************ */
+/* Evaluation Profile */
+
+/**
+ * Timing of operations is always gathered and accumulated across evaluations of the graph,
+ * per evaluation, per ID and per operation. The profile survives relations update and is only
+ * cleared explicitly.
+ */
+void DEG_debug_profile_reset(struct Depsgraph *depsgraph);
+
+/**
+ * Total time in seconds spent on evaluating the given original ID since the profile was reset.
+ */
+double DEG_debug_profile_id_time(const struct Depsgraph *depsgraph, const struct ID *id);
+
+/**
+ * Write a human readable summary of the profile into the given string: timing of the stored
+ * evaluations followed by the IDs which took most of the evaluation time.
+ * \param max_ids: Maximum number of IDs to be listed.
+ */
+void DEG_debug_profile_report(const struct Depsgraph *depsgraph,
+                              char *str,
+                              size_t str_maxncpy,
+                              int max_ids);
+
 /* ************************************************ */
 /* Diagram-Based Graph Debugging */
 
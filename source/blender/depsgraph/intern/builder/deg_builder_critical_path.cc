@@ -0,0 +1,99 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later
+ * Copyright 2022 Blender Foundation. All rights reserved. */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/builder/deg_builder_critical_path.h"
+
+#include "intern/node/deg_node.h"
+#include "intern/node/deg_node_operation.h"
+
+#include "intern/depsgraph.h"
+#include "intern/depsgraph_relation.h"
+
+namespace blender::deg {
+
+static bool is_critical_path_relation(const Relation *rel)
+{
+  /* Cyclic relations are ignored during evaluation, ignore them here as well to get an acyclic
+   * graph. */
+  return rel->from->type == NodeType::OPERATION && rel->to->type == NodeType::OPERATION &&
+         (rel->flag & RELATION_FLAG_CYCLIC) == 0;
+}
+
+/* Average evaluation time of the operations measured by the profile of the graph, in seconds.
+ * Operations which were never evaluated are assumed to take this long. Without any measured
+ * operations every operation counts as one unit, giving a purely structural estimate. */
+static float operation_cost_default(const DepsgraphProfile &profile)
+{
+  double time = 0.0;
+  int num_operations = 0;
+  for (const DepsgraphProfileOperation &operation : profile.operations) {
+    if (operation.num_evaluations != 0) {
+      time += operation.time / operation.num_evaluations;
+      num_operations++;
+    }
+  }
+  return (num_operations != 0) ? float(time / num_operations) : 1.0f;
+}
+
+static float operation_cost_estimate(const DepsgraphProfile &profile,
+                                     const OperationNode *op_node,
+                                     const float default_cost)
+{
+  /* No-op nodes are skipped by the scheduler. */
+  if (op_node->is_noop()) {
+    return 0.0f;
+  }
+  const DepsgraphProfileOperation &operation = profile.operations[op_node->profile_index];
+  if (operation.num_evaluations == 0) {
+    return default_cost;
+  }
+  return float(operation.time / operation.num_evaluations);
+}
+
+void deg_graph_calculate_critical_path(Depsgraph *graph)
+{
+  /* Traverse the graph in reverse topological order, so all children of an operation are
+   * handled before the operation itself. The number of children which are not handled yet is
+   * stored in #OperationNode.num_links_pending, it is re-initialized before evaluation. */
+  DepsgraphProfile &profile = graph->profile;
+  Vector<OperationNode *> queue;
+  for (OperationNode *op_node : graph->operations) {
+    op_node->critical_path_cost = 0.0f;
+    op_node->profile_index = profile.operation_index_ensure(op_node);
+    op_node->num_links_pending = 0;
+    for (const Relation *rel : op_node->outlinks) {
+      if (is_critical_path_relation(rel)) {
+        op_node->num_links_pending++;
+      }
+    }
+    if (op_node->num_links_pending == 0) {
+      queue.append(op_node);
+    }
+  }
+
+  /* Use the timing measured in previous evaluations, so that a few expensive operations (like
+   * modifier stacks) outweigh long chains of cheap ones. */
+  const float default_cost = operation_cost_default(profile);
+  while (!queue.is_empty()) {
+    OperationNode *op_node = queue.pop_last();
+    op_node->critical_path_cost += operation_cost_estimate(profile, op_node, default_cost);
+    for (Relation *rel : op_node->inlinks) {
+      if (!is_critical_path_relation(rel)) {
+        continue;
+      }
+      OperationNode *parent = static_cast<OperationNode *>(rel->from);
+      parent->critical_path_cost = std::max(parent->critical_path_cost,
+                                            op_node->critical_path_cost);
+      BLI_assert(parent->num_links_pending > 0);
+      if (--parent->num_links_pending == 0) {
+        queue.append(parent);
+      }
+    }
+  }
+}
+
+}  // namespace blender::deg
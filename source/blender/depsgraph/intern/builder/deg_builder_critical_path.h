@@ -0,0 +1,19 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later
+ * Copyright 2022 Blender Foundation. All rights reserved. */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+namespace blender::deg {
+
+struct Depsgraph;
+
+/* Calculate the cost of the longest chain of operations starting at each operation node, which
+ * is used by the evaluation scheduler to start operations on the critical path first. The cost
+ * of an operation is its average evaluation time from the profile of the graph. */
+void deg_graph_calculate_critical_path(Depsgraph *graph);
+
+}  // namespace blender::deg
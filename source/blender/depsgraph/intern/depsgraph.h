@@ -26,6 +26,7 @@
 
 #include "intern/debug/deg_debug.h"
 #include "intern/depsgraph_type.h"
+#include "intern/eval/deg_eval_profile.h"
 
 struct ID;
 struct Scene;
@@ -144,6 +145,9 @@ struct Depsgraph {
 
   DepsgraphDebug debug;
 
+  /* Timing of operations gathered across evaluations, see #DEG_debug_profile_report(). */
+  DepsgraphProfile profile;
+
   bool is_evaluating;
 
   /* Is set to truth for dependency graph which are used for post-processing (compositor and
@@ -7,7 +7,12 @@
  * Implementation of tools for debugging the depsgraph
  */
 
+#include <algorithm>
+
+#include "BLI_set.hh"
+#include "BLI_string.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "DNA_scene_types.h"
 
@@ -22,8 +27,10 @@
 #include "intern/depsgraph.h"
 #include "intern/depsgraph_relation.h"
 #include "intern/depsgraph_type.h"
+#include "intern/eval/deg_eval_profile.h"
 #include "intern/node/deg_node_component.h"
 #include "intern/node/deg_node_id.h"
+#include "intern/node/deg_node_operation.h"
 #include "intern/node/deg_node_time.h"
 
 namespace deg = blender::deg;
@@ -52,6 +59,58 @@ const char *DEG_debug_name_get(struct Depsgraph *depsgraph)
   return deg_graph->debug.name.c_str();
 }
 
+namespace blender::deg {
+namespace {
+
+/* Key of a node which does not depend on pointers, so that it can be used to match nodes of
+ * different graphs built for the same data. IDs are identified by the session UUID of the
+ * original ID, since linked IDs from different libraries can have the same name. */
+string debug_compare_node_key(const Node *node)
+{
+  if (node->type != NodeType::OPERATION) {
+    return node->identifier();
+  }
+  const OperationNode *op_node = static_cast<const OperationNode *>(node);
+  const ComponentNode *comp_node = op_node->owner;
+  const IDNode *id_node = comp_node->owner;
+  return id_node->name + "[" + to_string(id_node->id_orig_session_uuid) + "]/" +
+         comp_node->identifier() + "/" + op_node->identifier();
+}
+
+void debug_compare_collect(const Depsgraph *graph,
+                           Set<string> &r_operations,
+                           Set<string> &r_relations)
+{
+  for (const OperationNode *op_node : graph->operations) {
+    const string op_key = debug_compare_node_key(op_node);
+    r_operations.add(op_key);
+    for (const Relation *rel : op_node->inlinks) {
+      r_relations.add(debug_compare_node_key(rel->from) + " -> " + op_key + " (" + rel->name +
+                      ")");
+    }
+  }
+}
+
+/* Report keys which are only present in one of the sets, returns the number of such keys. */
+int debug_compare_missing(const Set<string> &keys,
+                          const Set<string> &other_keys,
+                          const char *what,
+                          const char *graph_name)
+{
+  int num_missing = 0;
+  for (const string &key : keys) {
+    if (other_keys.contains(key)) {
+      continue;
+    }
+    printf("%s %s is missing in %s graph.\n", what, key.c_str(), graph_name);
+    ++num_missing;
+  }
+  return num_missing;
+}
+
+}  // namespace
+}  // namespace blender::deg
+
 bool DEG_debug_compare(const struct Depsgraph *graph1, const struct Depsgraph *graph2)
 {
   BLI_assert(graph1 != nullptr);
@@ -61,13 +120,19 @@ bool DEG_debug_compare(const struct Depsgraph *graph1, const struct Depsgraph *g
   if (deg_graph1->operations.size() != deg_graph2->operations.size()) {
     return false;
   }
-  /* TODO(sergey): Currently we only do real stupid check,
-   * which is fast but which isn't 100% reliable.
-   *
-   * Would be cool to make it more robust, but it's good enough
-   * for now. Also, proper graph check is actually NP-complex
-   * problem. */
-  return true;
+  /* Operations and relations are matched by their identifiers rather than by graph isomorphism,
+   * which is enough to validate graphs which are built for the same data, for example a graph
+   * which is expected to be up to date against a freshly built one. */
+  blender::Set<std::string> operations1, relations1;
+  blender::Set<std::string> operations2, relations2;
+  deg::debug_compare_collect(deg_graph1, operations1, relations1);
+  deg::debug_compare_collect(deg_graph2, operations2, relations2);
+  int num_missing = 0;
+  num_missing += deg::debug_compare_missing(operations1, operations2, "Operation", "second");
+  num_missing += deg::debug_compare_missing(operations2, operations1, "Operation", "first");
+  num_missing += deg::debug_compare_missing(relations1, relations2, "Relation", "second");
+  num_missing += deg::debug_compare_missing(relations2, relations1, "Relation", "first");
+  return num_missing == 0;
 }
 
 bool DEG_debug_graph_relations_validate(Depsgraph *graph,
@@ -180,6 +245,64 @@ bool DEG_debug_consistency_check(Depsgraph *graph)
 
 /* ------------------------------------------------ */
 
+void DEG_debug_profile_reset(Depsgraph *depsgraph)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(depsgraph);
+  deg_graph->profile.reset();
+}
+
+double DEG_debug_profile_id_time(const Depsgraph *depsgraph, const ID *id)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+  const deg::DepsgraphProfileID *id_profile = deg_graph->profile.ids.lookup_ptr(id->session_uuid);
+  return (id_profile != nullptr) ? id_profile->time : 0.0;
+}
+
+void DEG_debug_profile_report(const Depsgraph *depsgraph,
+                              char *str,
+                              const size_t str_maxncpy,
+                              const int max_ids)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(depsgraph);
+  const deg::DepsgraphProfile &profile = deg_graph->profile;
+
+  const int num_evaluations = profile.num_evaluations();
+  double total_time = 0.0, max_time = 0.0;
+  for (int i = 0; i < num_evaluations; i++) {
+    const deg::DepsgraphProfileEvaluation &evaluation = profile.evaluation(i);
+    total_time += evaluation.time;
+    max_time = std::max(max_time, evaluation.time);
+  }
+
+  size_t len = BLI_snprintf_rlen(str,
+                                 str_maxncpy,
+                                 "%d evaluations, average %.3f ms, max %.3f ms\n",
+                                 num_evaluations,
+                                 num_evaluations ? total_time * 1000.0 / num_evaluations : 0.0,
+                                 max_time * 1000.0);
+
+  blender::Vector<const deg::DepsgraphProfileID *> ids;
+  for (const deg::DepsgraphProfileID &id_profile : profile.ids.values()) {
+    ids.append(&id_profile);
+  }
+  std::sort(ids.begin(),
+            ids.end(),
+            [](const deg::DepsgraphProfileID *a, const deg::DepsgraphProfileID *b) {
+              return a->time > b->time;
+            });
+
+  const int num_ids = std::min(max_ids, int(ids.size()));
+  for (int i = 0; i < num_ids && len < str_maxncpy; i++) {
+    const deg::DepsgraphProfileID *id_profile = ids[i];
+    len += BLI_snprintf_rlen(str + len,
+                             str_maxncpy - len,
+                             "%s: total %.3f ms in %d evaluations\n",
+                             id_profile->name,
+                             id_profile->time * 1000.0,
+                             id_profile->num_evaluations);
+  }
+}
+
 void DEG_stats_simple(const Depsgraph *graph,
                       size_t *r_outer,
                       size_t *r_operations,
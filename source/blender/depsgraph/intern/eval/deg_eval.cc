@@ -13,6 +13,7 @@
 
 #include "BLI_compiler_attrs.h"
 #include "BLI_gsqueue.h"
+#include "BLI_profile.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
 
@@ -36,6 +37,7 @@
 #include "intern/depsgraph_tag.h"
 #include "intern/eval/deg_eval_copy_on_write.h"
 #include "intern/eval/deg_eval_flush.h"
+#include "intern/eval/deg_eval_profile.h"
 #include "intern/eval/deg_eval_stats.h"
 #include "intern/node/deg_node.h"
 #include "intern/node/deg_node_component.h"
@@ -57,9 +59,27 @@ void schedule_children(DepsgraphEvalState *state,
                        ScheduleFunction *schedule_function,
                        ScheduleFunctionArgs... schedule_function_args);
 
-void schedule_node_to_pool(OperationNode *node, const int UNUSED(thread_id), TaskPool *pool)
+/* Children of an evaluated operation which became ready. The one with the highest critical path
+ * cost is evaluated next by the same thread, which avoids the task overhead for chains of
+ * operations and makes sure the longest chain does not wait for a free worker. The others are
+ * pushed to the pool. */
+struct ScheduleChildrenToPool {
+  TaskPool *pool;
+  OperationNode *next_node;
+};
+
+void schedule_node_to_pool_or_next(OperationNode *node,
+                                   const int UNUSED(thread_id),
+                                   ScheduleChildrenToPool *schedule)
 {
-  BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+  if (schedule->next_node == nullptr) {
+    schedule->next_node = node;
+    return;
+  }
+  if (node->critical_path_cost > schedule->next_node->critical_path_cost) {
+    std::swap(node, schedule->next_node);
+  }
+  BLI_task_pool_push(schedule->pool, deg_task_run_func, node, false, nullptr);
 }
 
 /* Denotes which part of dependency graph is being evaluated. */
@@ -81,7 +101,6 @@ enum class EvaluationStage {
 
 struct DepsgraphEvalState {
   Depsgraph *graph;
-  bool do_stats;
   EvaluationStage stage;
   bool need_single_thread_pass;
 };
@@ -92,15 +111,16 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
 
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
-  /* Perform operation. */
-  if (state->do_stats) {
-    const double start_time = PIL_check_seconds_timer();
-    operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += PIL_check_seconds_timer() - start_time;
-  }
-  else {
-    operation_node->evaluate(depsgraph);
+  /* Perform operation. The timing is always gathered, it is cheap compared to the operations
+   * themselves and is used by the evaluation profile of the graph. */
+  const double start_time = PIL_check_seconds_timer();
+  const uint64_t profile_start = BLI_profile_scope_begin();
+  operation_node->evaluate(depsgraph);
+  if (profile_start != 0) {
+    /* Only build the identifier when a trace is recorded. */
+    BLI_profile_scope_end("Depsgraph", operation_node->full_identifier().c_str(), profile_start);
   }
+  operation_node->stats.current_time += PIL_check_seconds_timer() - start_time;
 }
 
 void deg_task_run_func(TaskPool *pool, void *taskdata)
@@ -108,12 +128,16 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  while (operation_node != nullptr) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, schedule_node_to_pool, pool);
+    /* Schedule children. */
+    ScheduleChildrenToPool schedule = {pool, nullptr};
+    schedule_children(state, operation_node, schedule_node_to_pool_or_next, &schedule);
+    operation_node = schedule.next_node;
+  }
 }
 
 bool check_operation_node_visible(OperationNode *op_node)
@@ -166,15 +190,12 @@ void calculate_pending_parents(Depsgraph *graph)
   }
 }
 
-void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
+void initialize_execution(Depsgraph *graph)
 {
-  const bool do_stats = state->do_stats;
   calculate_pending_parents(graph);
   /* Clear tags and other things which needs to be clear. */
   for (OperationNode *node : graph->operations) {
-    if (do_stats) {
-      node->stats.reset_current();
-    }
+    node->stats.reset_current();
   }
 }
 
@@ -318,6 +339,29 @@ void evaluate_graph_single_threaded(DepsgraphEvalState *state)
   BLI_gsqueue_free(evaluation_queue);
 }
 
+void schedule_node_to_vector(OperationNode *node,
+                             const int /*thread_id*/,
+                             Vector<OperationNode *> *nodes)
+{
+  nodes->append(node);
+}
+
+/* Schedule all operations which are ready at the beginning of an evaluation stage, the ones on
+ * the critical path first. */
+void schedule_graph_to_pool(DepsgraphEvalState *state, TaskPool *pool)
+{
+  Vector<OperationNode *> ready_nodes;
+  schedule_graph(state, schedule_node_to_vector, &ready_nodes);
+  std::stable_sort(ready_nodes.begin(),
+                   ready_nodes.end(),
+                   [](const OperationNode *a, const OperationNode *b) {
+                     return a->critical_path_cost > b->critical_path_cost;
+                   });
+  for (OperationNode *node : ready_nodes) {
+    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+  }
+}
+
 void depsgraph_ensure_view_layer(Depsgraph *graph)
 {
   /* We update copy-on-write scene in the following cases:
@@ -359,28 +403,29 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   BPy_BEGIN_ALLOW_THREADS;
 #endif
 
+  const double evaluation_start_time = PIL_check_seconds_timer();
+
   graph->is_evaluating = true;
   depsgraph_ensure_view_layer(graph);
   /* Set up evaluation state. */
   DepsgraphEvalState state;
   state.graph = graph;
-  state.do_stats = graph->debug.do_time_debug();
   state.need_single_thread_pass = false;
   /* Prepare all nodes for evaluation. */
-  initialize_execution(&state, graph);
+  initialize_execution(graph);
 
   /* Do actual evaluation now. */
   /* First, process all Copy-On-Write nodes. */
   state.stage = EvaluationStage::COPY_ON_WRITE;
   TaskPool *task_pool = deg_evaluate_task_pool_create(&state);
-  schedule_graph(&state, schedule_node_to_pool, task_pool);
+  schedule_graph_to_pool(&state, task_pool);
   BLI_task_pool_work_and_wait(task_pool);
   BLI_task_pool_free(task_pool);
 
   /* After that, process all other nodes. */
   state.stage = EvaluationStage::THREADED_EVALUATION;
   task_pool = deg_evaluate_task_pool_create(&state);
-  schedule_graph(&state, schedule_node_to_pool, task_pool);
+  schedule_graph_to_pool(&state, task_pool);
   BLI_task_pool_work_and_wait(task_pool);
   BLI_task_pool_free(task_pool);
 
@@ -392,9 +437,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   /* Finalize statistics gathering. This is because we only gather single
    * operation timing here, without aggregating anything to avoid any extra
    * synchronization. */
-  if (state.do_stats) {
-    deg_eval_stats_aggregate(graph);
-  }
+  deg_eval_stats_aggregate(graph);
+  deg_eval_profile_update(graph, PIL_check_seconds_timer() - evaluation_start_time);
   /* Clear any uncleared tags - just in case. */
   deg_graph_clear_tags(graph);
   graph->is_evaluating = false;
@@ -1034,6 +1034,7 @@ void deg_evaluate_copy_on_write(struct ::Depsgraph *graph, const IDNode *id_node
      * ensures scene and view layer pointers are valid. */
     return;
   }
+  MEM_CategoryScope mem_category_scope(MEM_CATEGORY_DEPSGRAPH);
   deg_update_copy_on_write_datablock(depsgraph, id_node);
 }
 
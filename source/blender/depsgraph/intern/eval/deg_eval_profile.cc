@@ -0,0 +1,138 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later
+ * Copyright 2022 Blender Foundation. All rights reserved. */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/eval/deg_eval_profile.h"
+
+#include "BLI_hash.hh"
+#include "BLI_string.h"
+#include "BLI_utildefines.h"
+
+#include "intern/depsgraph.h"
+
+#include "intern/node/deg_node_component.h"
+#include "intern/node/deg_node_id.h"
+#include "intern/node/deg_node_operation.h"
+
+namespace blender::deg {
+
+DepsgraphProfileOperationKey::DepsgraphProfileOperationKey(const OperationNode *op_node)
+    : id_session_uuid(op_node->owner->owner->id_orig_session_uuid),
+      component_type(op_node->owner->type),
+      component_name(op_node->owner->name),
+      opcode(op_node->opcode),
+      name(op_node->name),
+      name_tag(op_node->name_tag)
+{
+}
+
+uint64_t DepsgraphProfileOperationKey::hash() const
+{
+  return get_default_hash_4(id_session_uuid,
+                            get_default_hash_2(int(component_type), component_name),
+                            get_default_hash_2(int(opcode), name),
+                            name_tag);
+}
+
+bool operator==(const DepsgraphProfileOperationKey &a, const DepsgraphProfileOperationKey &b)
+{
+  return a.id_session_uuid == b.id_session_uuid && a.component_type == b.component_type &&
+         a.component_name == b.component_name && a.opcode == b.opcode && a.name == b.name &&
+         a.name_tag == b.name_tag;
+}
+
+DepsgraphProfile::DepsgraphProfile() : num_evaluations_(0), next_evaluation_index_(0)
+{
+}
+
+void DepsgraphProfile::reset()
+{
+  ids.clear();
+  for (DepsgraphProfileOperation &operation : operations) {
+    operation.time = 0.0;
+    operation.num_evaluations = 0;
+  }
+  num_evaluations_ = 0;
+  next_evaluation_index_ = 0;
+}
+
+void DepsgraphProfile::add_evaluation(const DepsgraphProfileEvaluation &evaluation)
+{
+  evaluations_[next_evaluation_index_] = evaluation;
+
+  /* Move to the next index, keeping wrapping at the end of array into account. */
+  ++next_evaluation_index_;
+  if (next_evaluation_index_ == MAX_EVALUATIONS) {
+    next_evaluation_index_ = 0;
+  }
+
+  /* Update number of stored evaluations. */
+  if (num_evaluations_ != MAX_EVALUATIONS) {
+    ++num_evaluations_;
+  }
+}
+
+int DepsgraphProfile::operation_index_ensure(const OperationNode *op_node)
+{
+  return operation_indices.lookup_or_add_cb(DepsgraphProfileOperationKey(op_node), [&]() {
+    operations.append({0.0, 0});
+    return int(operations.size()) - 1;
+  });
+}
+
+int DepsgraphProfile::num_evaluations() const
+{
+  return num_evaluations_;
+}
+
+const DepsgraphProfileEvaluation &DepsgraphProfile::evaluation(const int index) const
+{
+  BLI_assert(index >= 0 && index < num_evaluations_);
+  const int first_index = (num_evaluations_ == MAX_EVALUATIONS) ? next_evaluation_index_ : 0;
+  return evaluations_[(first_index + index) % MAX_EVALUATIONS];
+}
+
+void deg_eval_profile_update(Depsgraph *graph, const double evaluation_time)
+{
+  DepsgraphProfile &profile = graph->profile;
+
+  DepsgraphProfileEvaluation evaluation;
+  evaluation.ctime = graph->ctime;
+  evaluation.time = evaluation_time;
+  evaluation.num_operations = 0;
+  for (OperationNode *op_node : graph->operations) {
+    if (op_node->stats.current_time == 0.0) {
+      continue;
+    }
+    ++evaluation.num_operations;
+    /* The index is looked up once after every relations rebuild. */
+    if (op_node->profile_index == -1) {
+      op_node->profile_index = profile.operation_index_ensure(op_node);
+    }
+    DepsgraphProfileOperation &operation = profile.operations[op_node->profile_index];
+    operation.time += op_node->stats.current_time;
+    ++operation.num_evaluations;
+  }
+  profile.add_evaluation(evaluation);
+
+  for (IDNode *id_node : graph->id_nodes) {
+    if (id_node->stats.current_time == 0.0) {
+      continue;
+    }
+    DepsgraphProfileID &id_profile = profile.ids.lookup_or_add_cb(
+        id_node->id_orig_session_uuid, [&]() {
+          DepsgraphProfileID new_id_profile;
+          STRNCPY(new_id_profile.name, id_node->id_orig->name);
+          new_id_profile.time = 0.0;
+          new_id_profile.num_evaluations = 0;
+          return new_id_profile;
+        });
+    id_profile.time += id_node->stats.current_time;
+    ++id_profile.num_evaluations;
+  }
+}
+
+}  // namespace blender::deg
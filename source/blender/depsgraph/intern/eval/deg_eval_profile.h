@@ -0,0 +1,110 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later
+ * Copyright 2022 Blender Foundation. All rights reserved. */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Lightweight evaluation profile which is gathered across evaluations of the graph.
+ */
+
+#pragma once
+
+#include "DNA_ID.h"
+
+#include "intern/depsgraph_type.h"
+#include "intern/node/deg_node.h"
+#include "intern/node/deg_node_operation.h"
+
+namespace blender {
+namespace deg {
+
+struct Depsgraph;
+
+/* Timing of a single evaluation of the dependency graph. */
+struct DepsgraphProfileEvaluation {
+  /* Scene time at which the graph was evaluated. */
+  float ctime;
+  /* Wall time spent on the whole evaluation, in seconds. */
+  double time;
+  /* Number of operations which were evaluated. */
+  int num_operations;
+};
+
+/* Accumulated timing of a single ID across all the profiled evaluations. */
+struct DepsgraphProfileID {
+  char name[MAX_ID_NAME];
+  /* Total time spent on operations of this ID, in seconds. */
+  double time;
+  /* Number of evaluations in which any operation of this ID was evaluated. */
+  int num_evaluations;
+};
+
+/* Identifies an operation across relations rebuilds, which re-create all operation nodes. */
+struct DepsgraphProfileOperationKey {
+  uint id_session_uuid;
+  NodeType component_type;
+  string component_name;
+  OperationCode opcode;
+  string name;
+  int name_tag;
+
+  explicit DepsgraphProfileOperationKey(const OperationNode *op_node);
+
+  uint64_t hash() const;
+  friend bool operator==(const DepsgraphProfileOperationKey &a,
+                         const DepsgraphProfileOperationKey &b);
+};
+
+/* Accumulated timing of a single operation across all the profiled evaluations. */
+struct DepsgraphProfileOperation {
+  /* Total time spent on the operation, in seconds. */
+  double time;
+  /* Number of evaluations in which the operation was evaluated. */
+  int num_evaluations;
+};
+
+/* Profile is kept for the lifetime of the dependency graph and survives relations rebuild.
+ * IDs are identified by their session UUID, so that the profile never dereferences IDs which
+ * might have been freed in the meantime. */
+class DepsgraphProfile {
+ public:
+  /* Maximum number of evaluations stored in the ring buffer. */
+  static const constexpr int MAX_EVALUATIONS = 256;
+
+  DepsgraphProfile();
+
+  void reset();
+
+  void add_evaluation(const DepsgraphProfileEvaluation &evaluation);
+
+  /* Number of stored evaluations. */
+  int num_evaluations() const;
+  /* Get stored evaluation, index 0 corresponds to the oldest one. */
+  const DepsgraphProfileEvaluation &evaluation(int index) const;
+
+  /* Index of the operation in #operations, added when the operation is not profiled yet. */
+  int operation_index_ensure(const OperationNode *op_node);
+
+  Map<uint, DepsgraphProfileID> ids;
+
+  /* Operations are never removed, so that the indices stored in the operation nodes stay valid.
+   * Resetting the profile only clears their timing. */
+  Map<DepsgraphProfileOperationKey, int> operation_indices;
+  Vector<DepsgraphProfileOperation> operations;
+
+ protected:
+  DepsgraphProfileEvaluation evaluations_[MAX_EVALUATIONS];
+
+  /* Number of evaluations which are actually stored in the array. */
+  int num_evaluations_;
+
+  /* Index in the evaluations_ array under which next evaluation will be stored. */
+  int next_evaluation_index_;
+};
+
+/* Accumulate timing of the evaluation which just finished to the graph profile.
+ * Expects operation timing to be aggregated to the ID nodes already. */
+void deg_eval_profile_update(Depsgraph *graph, double evaluation_time);
+
+}  // namespace deg
+}  // namespace blender
@@ -256,6 +256,14 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Estimated cost of the longest chain of operations which depends on this one (including this
+   * operation itself). Ready operations with a higher cost are evaluated first.
+   * See #deg_graph_calculate_critical_path. */
+  float critical_path_cost;
+
+  /* Index of the operation in #DepsgraphProfile.operations, -1 until it is looked up. */
+  int profile_index;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
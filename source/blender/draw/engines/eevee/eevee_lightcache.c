@@ -60,6 +60,10 @@
   (IRRADIANCE_MAX_POOL_SIZE / IRRADIANCE_SAMPLE_SIZE_X) * \
       (IRRADIANCE_MAX_POOL_SIZE / IRRADIANCE_SAMPLE_SIZE_Y)
 
+/* Number of irradiance samples rendered while the draw manager is locked. Higher values avoid
+ * gathering the scene for every sample, lower values keep the UI responsive while baking. */
+#define LIGHTBAKE_GRID_SAMPLE_BATCH_LEN 8
+
 /* TODO: should be replace by a more elegant alternative. */
 extern void DRW_opengl_context_enable(void);
 extern void DRW_opengl_context_disable(void);
@@ -116,6 +120,8 @@ typedef struct EEVEE_LightBake {
   int grid_sample;
   /** Total number of samples for the current grid. */
   int grid_sample_len;
+  /** Number of samples rendered after `grid_sample` with the same draw cache. */
+  int grid_sample_batch_len;
   /** Nth grid in the cache being rendered. */
   int grid_curr;
   /** The current light bounce being evaluated. */
@@ -1096,31 +1102,22 @@ static void grid_loc_to_world_loc(EEVEE_LightGrid *egrid, const int local_cell[3
   madd_v3_v3fl(r_pos, egrid->increment_z, local_cell[2]);
 }
 
-static void eevee_lightbake_render_grid_sample(void *ved, void *user_data)
+static void eevee_lightbake_render_grid_sample(EEVEE_Data *vedata,
+                                               EEVEE_ViewLayerData *sldata,
+                                               EEVEE_LightBake *lbake,
+                                               LightCache *lcache)
 {
-  EEVEE_Data *vedata = (EEVEE_Data *)ved;
-  EEVEE_ViewLayerData *sldata = EEVEE_view_layer_data_ensure();
   EEVEE_CommonUniformBuffer *common_data = &sldata->common_data;
-  EEVEE_LightBake *lbake = (EEVEE_LightBake *)user_data;
   EEVEE_LightGrid *egrid = lbake->grid;
   LightProbe *prb = *lbake->probe;
-  Scene *scene_eval = DEG_get_evaluated_scene(lbake->depsgraph);
-  LightCache *lcache = scene_eval->eevee.light_cache_data;
   int grid_loc[3], sample_id, sample_offset, stride;
   float pos[3];
   const bool is_last_bounce_sample = ((egrid->offset + lbake->grid_sample) ==
                                       (lbake->total_irr_samples - 1));
 
-  /* No bias for rendering the probe. */
-  egrid->level_bias = 1.0f;
-
   /* Use the previous bounce for rendering this bounce. */
   SWAP(GPUTexture *, lbake->grid_prev, lcache->grid_tx.tex);
 
-  /* TODO: do this once for the whole bake when we have independent DRWManagers.
-   * Warning: Some of the things above require this. */
-  eevee_lightbake_cache_create(vedata, lbake);
-
   /* Compute sample position */
   compute_cell_id(egrid, prb, lbake->grid_sample, &sample_id, grid_loc, &stride);
   sample_offset = egrid->offset + sample_id;
@@ -1181,6 +1178,34 @@ static void eevee_lightbake_render_grid_sample(void *ved, void *user_data)
   }
 }
 
+/* Render a batch of samples of the same grid and bounce, so that the scene is only gathered
+ * into the draw cache once for all of them. */
+static void eevee_lightbake_render_grid_samples(void *ved, void *user_data)
+{
+  EEVEE_Data *vedata = (EEVEE_Data *)ved;
+  EEVEE_ViewLayerData *sldata = EEVEE_view_layer_data_ensure();
+  EEVEE_LightBake *lbake = (EEVEE_LightBake *)user_data;
+  Scene *scene_eval = DEG_get_evaluated_scene(lbake->depsgraph);
+  LightCache *lcache = scene_eval->eevee.light_cache_data;
+
+  /* No bias for rendering the probe. */
+  lbake->grid->level_bias = 1.0f;
+
+  SWAP(GPUTexture *, lbake->grid_prev, lcache->grid_tx.tex);
+  eevee_lightbake_cache_create(vedata, lbake);
+  SWAP(GPUTexture *, lbake->grid_prev, lcache->grid_tx.tex);
+
+  const int first_sample = lbake->grid_sample;
+  for (int i = 0; i < lbake->grid_sample_batch_len; i++) {
+    if (G.is_break == true || *lbake->stop) {
+      break;
+    }
+    lbake->grid_sample = first_sample + i;
+    eevee_lightbake_render_grid_sample(vedata, sldata, lbake, lcache);
+  }
+  lbake->grid_sample = first_sample;
+}
+
 static void eevee_lightbake_render_probe_sample(void *ved, void *user_data)
 {
   EEVEE_Data *vedata = (EEVEE_Data *)ved;
@@ -1337,7 +1362,8 @@ void EEVEE_lightbake_update(void *custom_data)
 }
 
 static bool lightbake_do_sample(EEVEE_LightBake *lbake,
-                                void (*render_callback)(void *ved, void *user_data))
+                                void (*render_callback)(void *ved, void *user_data),
+                                const int samples_len)
 {
   if (G.is_break == true || *lbake->stop) {
     return false;
@@ -1348,7 +1374,7 @@ static bool lightbake_do_sample(EEVEE_LightBake *lbake,
   /* TODO: make DRW manager instantiable (and only lock on drawing) */
   eevee_lightbake_context_enable(lbake);
   DRW_custom_pipeline(&draw_engine_eevee_type, depsgraph, render_callback, lbake);
-  lbake->done += 1;
+  lbake->done += samples_len;
   *lbake->progress = lbake->done / (float)lbake->total;
   *lbake->do_update = 1;
   eevee_lightbake_context_disable(lbake);
@@ -1412,7 +1438,7 @@ void EEVEE_lightbake_job(void *custom_data, short *stop, short *do_update, float
   /* Render world irradiance and reflection first */
   if (lcache->flag & LIGHTCACHE_UPDATE_WORLD) {
     lbake->probe = NULL;
-    lightbake_do_sample(lbake, eevee_lightbake_render_world_sample);
+    lightbake_do_sample(lbake, eevee_lightbake_render_world_sample, 1);
   }
 
   /* Render irradiance grids */
@@ -1427,8 +1453,11 @@ void EEVEE_lightbake_job(void *custom_data, short *stop, short *do_update, float
         lbake->grid_sample_len = prb->grid_resolution_x * prb->grid_resolution_y *
                                  prb->grid_resolution_z;
         for (lbake->grid_sample = 0; lbake->grid_sample < lbake->grid_sample_len;
-             ++lbake->grid_sample) {
-          lightbake_do_sample(lbake, eevee_lightbake_render_grid_sample);
+             lbake->grid_sample += lbake->grid_sample_batch_len) {
+          lbake->grid_sample_batch_len = min_ii(LIGHTBAKE_GRID_SAMPLE_BATCH_LEN,
+                                                lbake->grid_sample_len - lbake->grid_sample);
+          lightbake_do_sample(
+              lbake, eevee_lightbake_render_grid_samples, lbake->grid_sample_batch_len);
         }
       }
     }
@@ -1441,7 +1470,7 @@ void EEVEE_lightbake_job(void *custom_data, short *stop, short *do_update, float
     lbake->cube = lcache->cube_data + 1;
     for (lbake->cube_offset = 1; lbake->cube_offset < lbake->cube_len;
          lbake->cube_offset++, lbake->probe++, lbake->cube++) {
-      lightbake_do_sample(lbake, eevee_lightbake_render_probe_sample);
+      lightbake_do_sample(lbake, eevee_lightbake_render_probe_sample, 1);
     }
   }
 
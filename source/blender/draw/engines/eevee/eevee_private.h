@@ -549,6 +549,12 @@ typedef struct EEVEE_LightsInfo {
   uchar shadow_cascade_light_indices[MAX_SHADOW_CASCADE];
   /* Update bitmap. */
   BLI_bitmap sh_cube_update[BLI_BITMAP_SIZE(MAX_SHADOW_CUBE)];
+  /* Cascades which still contain the shadow map rendered with `shadow_cascade_render_cache`.
+   * Used to skip cascades which don't change between redraws (e.g. between samples without soft
+   * shadows). */
+  BLI_bitmap sh_cascade_cached[BLI_BITMAP_SIZE(MAX_SHADOW_CASCADE)];
+  struct EEVEE_ShadowCascadeRender shadow_cascade_render_cache[MAX_SHADOW_CASCADE];
+  int shadow_cascade_tex_id_cache[MAX_SHADOW_CASCADE];
   /* Lights tracking */
   struct BoundSphere shadow_bounds[MAX_LIGHT]; /* Tightly packed light bounds. */
   /* List of bbox and update bitmap. Double buffered. */
@@ -218,7 +218,11 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
                                                            NULL);
   }
 
+  /* Cascades cover the whole view, so they are rendered again when any shadow caster changed. */
+  bool do_cascade_update = false;
+
   if (!sldata->shadow_cascade_pool) {
+    do_cascade_update = true;
     sldata->shadow_cascade_pool = DRW_texture_create_2d_array(linfo->shadow_cascade_size,
                                                               linfo->shadow_cascade_size,
                                                               max_ii(1, linfo->num_cascade_layer),
@@ -247,6 +251,7 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
   for (int i = 0; i < backbuffer->count; i++) {
     /* If the shadow-caster has been deleted or updated. */
     if (BLI_BITMAP_TEST(backbuffer->update, i)) {
+      do_cascade_update = true;
       for (int j = 0; j < linfo->cube_len; j++) {
         if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
           if (sphere_bbox_intersect(&bsphere[j], &bbox[i])) {
@@ -261,6 +266,7 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
   for (int i = 0; i < frontbuffer->count; i++) {
     /* If the shadow-caster has been updated. */
     if (BLI_BITMAP_TEST(frontbuffer->update, i)) {
+      do_cascade_update = true;
       for (int j = 0; j < linfo->cube_len; j++) {
         if (!BLI_BITMAP_TEST(&linfo->sh_cube_update[0], j)) {
           if (sphere_bbox_intersect(&bsphere[j], &bbox[i])) {
@@ -271,6 +277,10 @@ void EEVEE_shadows_update(EEVEE_ViewLayerData *sldata, EEVEE_Data *vedata)
     }
   }
 
+  if (do_cascade_update) {
+    BLI_bitmap_set_all(&linfo->sh_cascade_cached[0], false, MAX_SHADOW_CASCADE);
+  }
+
   /* Resize shcasters buffers if too big. */
   if (frontbuffer->alloc_count - frontbuffer->count > SH_CASTER_ALLOC_CHUNK) {
     frontbuffer->alloc_count = divide_ceil_u(max_ii(1, frontbuffer->count),
@@ -402,6 +402,24 @@ void EEVEE_shadows_draw_cascades(EEVEE_ViewLayerData *sldata,
 
   eevee_shadow_cascade_setup(linfo, evli, view, near, far, effects->taa_current_sample - 1);
 
+  /* Skip rendering if the cascade layers still contain the same shadow maps. */
+  EEVEE_ShadowCascadeRender *csm_render_cache = &linfo->shadow_cascade_render_cache[cascade_index];
+  const bool is_cached = BLI_BITMAP_TEST(linfo->sh_cascade_cached, cascade_index) &&
+                         linfo->shadow_cascade_tex_id_cache[cascade_index] == csm_data->tex_id &&
+                         csm_render_cache->cascade_count == csm_render->cascade_count &&
+                         memcmp(csm_render_cache->viewmat,
+                                csm_render->viewmat,
+                                sizeof(csm_render->viewmat)) == 0 &&
+                         memcmp(csm_render_cache->projmat,
+                                csm_render->projmat,
+                                sizeof(float[4][4]) * csm_render->cascade_count) == 0;
+  if (is_cached) {
+    return;
+  }
+  *csm_render_cache = *csm_render;
+  linfo->shadow_cascade_tex_id_cache[cascade_index] = csm_data->tex_id;
+  BLI_BITMAP_ENABLE(linfo->sh_cascade_cached, cascade_index);
+
   /* Meh, Reusing the cube views. */
   BLI_assert(MAX_CASCADE_NUM <= 6);
   eevee_ensure_cascade_views(csm_render, g_data->cube_views);
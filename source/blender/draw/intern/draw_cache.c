@@ -3338,6 +3338,9 @@ void drw_batch_cache_generate_requested(Object *ob)
                            DRW_object_use_hide_faces(ob)) ||
                           ((mode == CTX_MODE_EDIT_MESH) && DRW_object_is_in_edit_mode(ob))));
 
+  /* NOTE: Extraction tasks of the task graph run on other threads and are not accounted to the
+   * draw category. */
+  const eMEMCategory mem_category = MEM_category_push(MEM_CATEGORY_DRAW);
   switch (ob->type) {
     case OB_MESH:
       DRW_mesh_batch_cache_create_requested(
@@ -3355,6 +3358,7 @@ void drw_batch_cache_generate_requested(Object *ob)
     default:
       break;
   }
+  MEM_category_pop(mem_category);
 }
 
 void drw_batch_cache_generate_requested_evaluated_mesh(Object *ob)
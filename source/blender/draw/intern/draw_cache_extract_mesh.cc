@@ -17,6 +17,7 @@
 
 #include "BLI_array.hh"
 #include "BLI_math_bits.h"
+#include "BLI_profile.hh"
 #include "BLI_task.h"
 #include "BLI_vector.hh"
 
@@ -421,6 +422,7 @@ BLI_INLINE void extract_task_range_run_iter(const MeshRenderData *mr,
 
 static void extract_task_range_run(void *__restrict taskdata)
 {
+  BLI_PROFILE_SCOPE_NAMED("Draw", "Mesh Extract");
   ExtractTaskData *data = (ExtractTaskData *)taskdata;
   const eMRIterType iter_type = data->iter_type;
   const bool is_mesh = data->mr->extract_type != MR_EXTRACT_BMESH;
@@ -516,6 +518,7 @@ static void mesh_render_data_update_task_data_free(void *data)
 
 static void mesh_extract_render_data_node_exec(void *__restrict task_data)
 {
+  BLI_PROFILE_SCOPE_NAMED("Draw", "Mesh Render Data Update");
   MeshRenderDataUpdateTaskData *update_task_data = static_cast<MeshRenderDataUpdateTaskData *>(
       task_data);
   MeshRenderData *mr = update_task_data->mr;
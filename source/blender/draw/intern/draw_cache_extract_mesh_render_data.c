@@ -10,13 +10,13 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
-#include "BLI_bitmap.h"
 #include "BLI_math.h"
 #include "BLI_task.h"
 
 #include "BKE_editmesh.h"
 #include "BKE_editmesh_cache.h"
 #include "BKE_mesh.h"
+#include "BKE_mesh_runtime.h"
 
 #include "GPU_batch.h"
 
@@ -76,35 +76,23 @@ static void mesh_render_data_loose_geom_build(const MeshRenderData *mr, MeshBuff
 
 static void mesh_render_data_loose_geom_mesh(const MeshRenderData *mr, MeshBufferCache *cache)
 {
-  BLI_bitmap *lvert_map = BLI_BITMAP_NEW(mr->vert_len, __func__);
-
-  cache->loose_geom.edges = MEM_mallocN(mr->edge_len * sizeof(*cache->loose_geom.edges), __func__);
-  const MEdge *med = mr->medge;
-  for (int med_index = 0; med_index < mr->edge_len; med_index++, med++) {
-    if (med->flag & ME_LOOSEEDGE) {
-      cache->loose_geom.edges[cache->loose_geom.edge_len++] = med_index;
-    }
-    /* Tag verts as not loose. */
-    BLI_BITMAP_ENABLE(lvert_map, med->v1);
-    BLI_BITMAP_ENABLE(lvert_map, med->v2);
-  }
-  if (cache->loose_geom.edge_len < mr->edge_len) {
-    cache->loose_geom.edges = MEM_reallocN(
-        cache->loose_geom.edges, cache->loose_geom.edge_len * sizeof(*cache->loose_geom.edges));
-  }
-
-  cache->loose_geom.verts = MEM_mallocN(mr->vert_len * sizeof(*cache->loose_geom.verts), __func__);
-  for (int v = 0; v < mr->vert_len; v++) {
-    if (!BLI_BITMAP_TEST(lvert_map, v)) {
-      cache->loose_geom.verts[cache->loose_geom.vert_len++] = v;
-    }
-  }
-  if (cache->loose_geom.vert_len < mr->vert_len) {
-    cache->loose_geom.verts = MEM_reallocN(
-        cache->loose_geom.verts, cache->loose_geom.vert_len * sizeof(*cache->loose_geom.verts));
-  }
-
-  MEM_freeN(lvert_map);
+  /* The loose geometry is cached on the mesh, so it survives deformation and is shared by the
+   * final, cage and UV cage buffer caches. */
+  const MeshLooseGeom *loose_geom = BKE_mesh_runtime_loose_geom_ensure(mr->me);
+
+  cache->loose_geom.edge_len = loose_geom->edges_len;
+  cache->loose_geom.edges = MEM_mallocN(loose_geom->edges_len * sizeof(*cache->loose_geom.edges),
+                                        __func__);
+  memcpy(cache->loose_geom.edges,
+         loose_geom->edges,
+         loose_geom->edges_len * sizeof(*cache->loose_geom.edges));
+
+  cache->loose_geom.vert_len = loose_geom->verts_len;
+  cache->loose_geom.verts = MEM_mallocN(loose_geom->verts_len * sizeof(*cache->loose_geom.verts),
+                                        __func__);
+  memcpy(cache->loose_geom.verts,
+         loose_geom->verts,
+         loose_geom->verts_len * sizeof(*cache->loose_geom.verts));
 }
 
 static void mesh_render_data_lverts_bm(const MeshRenderData *mr, MeshBufferCache *cache, BMesh *bm)
@@ -29,6 +29,8 @@
 #include "GPU_material.h"
 #include "GPU_texture.h"
 
+#include "DRW_render.h"
+
 #include "draw_cache_impl.h" /* own include */
 #include "draw_cache_inline.h"
 #include "draw_hair_private.h" /* own include */
@@ -45,6 +47,13 @@ struct CurvesBatchCache {
 
   GPUBatch *edit_points;
 
+  /**
+   * Copy of the curve offsets the topology dependent buffers were created for, used to only
+   * re-upload positions when the curves were just deformed.
+   */
+  int *topology_offsets;
+  int topology_curves_num;
+
   /* To determine if cache is invalid. */
   bool is_dirty;
 };
@@ -79,10 +88,57 @@ static void curves_batch_cache_clear(Curves &curves)
 
   particle_batch_cache_clear_hair(&cache->hair);
   GPU_BATCH_DISCARD_SAFE(cache->edit_points);
+  MEM_SAFE_FREE(cache->topology_offsets);
+}
+
+static bool curves_batch_cache_topology_matches(const CurvesBatchCache &cache,
+                                                const Curves &curves)
+{
+  if (cache.topology_offsets == nullptr) {
+    return false;
+  }
+  const int curves_num = curves.geometry.curve_size;
+  if (cache.topology_curves_num != curves_num || curves.geometry.curve_offsets == nullptr) {
+    return false;
+  }
+  return memcmp(cache.topology_offsets,
+                curves.geometry.curve_offsets,
+                sizeof(int) * (curves_num + 1)) == 0;
+}
+
+static void curves_batch_cache_topology_store(CurvesBatchCache &cache, const Curves &curves)
+{
+  MEM_SAFE_FREE(cache.topology_offsets);
+  if (curves.geometry.curve_offsets == nullptr) {
+    return;
+  }
+  cache.topology_offsets = static_cast<int *>(MEM_dupallocN(curves.geometry.curve_offsets));
+  cache.topology_curves_num = curves.geometry.curve_size;
+}
+
+/**
+ * When only positions changed, free the position dependent buffers and keep the strand data,
+ * final refinement buffers and index buffers, which only depend on the topology. The refinement
+ * is redone on the GPU because the point buffer is recreated.
+ */
+static void curves_batch_cache_clear_positions(CurvesBatchCache &cache)
+{
+  ParticleHairCache &hair_cache = cache.hair;
+  GPU_VERTBUF_DISCARD_SAFE(hair_cache.proc_point_buf);
+  GPU_VERTBUF_DISCARD_SAFE(hair_cache.proc_length_buf);
+  DRW_TEXTURE_FREE_SAFE(hair_cache.point_tex);
+  DRW_TEXTURE_FREE_SAFE(hair_cache.length_tex);
+  GPU_BATCH_DISCARD_SAFE(cache.edit_points);
 }
 
 void DRW_curves_batch_cache_validate(Curves *curves)
 {
+  CurvesBatchCache *cache = static_cast<CurvesBatchCache *>(curves->batch_cache);
+  if (cache && cache->is_dirty && curves_batch_cache_topology_matches(*cache, *curves)) {
+    curves_batch_cache_clear_positions(*cache);
+    cache->is_dirty = false;
+    return;
+  }
   if (!curves_batch_cache_valid(*curves)) {
     curves_batch_cache_clear(*curves);
     curves_batch_cache_init(*curves);
@@ -354,6 +410,7 @@ bool curves_ensure_procedural_data(Object *object,
   /* Refreshed if active layer or custom data changes. */
   if ((*r_hair_cache)->strand_tex == nullptr) {
     curves_batch_cache_ensure_procedural_strand_data(curves, cache.hair);
+    curves_batch_cache_topology_store(cache, curves);
   }
 
   /* Refreshed only on subdiv count change. */
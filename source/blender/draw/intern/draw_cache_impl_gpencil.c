@@ -24,6 +24,7 @@
 
 #include "BLI_hash.h"
 #include "BLI_polyfill_2d.h"
+#include "BLI_task.h"
 
 #include "draw_cache.h"
 #include "draw_cache_impl.h"
@@ -259,6 +260,10 @@ typedef struct gpIterData {
   int vert_len;
   int tri_len;
   int curve_len;
+  /** Visible strokes in the order of their offsets in the buffers, to fill them in parallel. */
+  bGPDstroke **strokes;
+  int strokes_len;
+  int strokes_alloc_len;
 } gpIterData;
 
 static GPUVertBuf *gpencil_dummy_buffer_get(void)
@@ -367,24 +372,33 @@ static void gpencil_buffer_add_fill(GPUIndexBufBuilder *ibo, const bGPDstroke *g
 {
   int tri_len = gps->tot_triangles;
   int v = gps->runtime.stroke_start;
+  int tri_start = gps->runtime.fill_start;
   for (int i = 0; i < tri_len; i++) {
     uint *tri = gps->triangles[i].verts;
-    GPU_indexbuf_add_tri_verts(ibo, v + tri[0], v + tri[1], v + tri[2]);
+    GPU_indexbuf_set_tri_verts(ibo, tri_start + i, v + tri[0], v + tri[1], v + tri[2]);
   }
 }
 
-static void gpencil_stroke_iter_cb(bGPDlayer *UNUSED(gpl),
-                                   bGPDframe *UNUSED(gpf),
-                                   bGPDstroke *gps,
-                                   void *thunk)
+static void gpencil_stroke_fill_task(void *__restrict userdata,
+                                     const int stroke_index,
+                                     const TaskParallelTLS *__restrict tls)
 {
-  gpIterData *iter = (gpIterData *)thunk;
+  gpIterData *iter = (gpIterData *)userdata;
+  GPUIndexBufBuilder *ibo = (GPUIndexBufBuilder *)tls->userdata_chunk;
+  const bGPDstroke *gps = iter->strokes[stroke_index];
   gpencil_buffer_add_stroke(iter->verts, iter->cols, gps);
   if (gps->tot_triangles > 0) {
-    gpencil_buffer_add_fill(&iter->ibo, gps);
+    gpencil_buffer_add_fill(ibo, gps);
   }
 }
 
+static void gpencil_stroke_fill_reduce(const void *__restrict UNUSED(userdata),
+                                       void *__restrict chunk_join,
+                                       void *__restrict chunk)
+{
+  GPU_indexbuf_join((GPUIndexBufBuilder *)chunk_join, (const GPUIndexBufBuilder *)chunk);
+}
+
 static void gpencil_object_verts_count_cb(bGPDlayer *UNUSED(gpl),
                                           bGPDframe *UNUSED(gpf),
                                           bGPDstroke *gps,
@@ -397,6 +411,12 @@ static void gpencil_object_verts_count_cb(bGPDlayer *UNUSED(gpl),
   gps->runtime.fill_start = iter->tri_len;
   iter->vert_len += gps->totpoints + 2 + gpencil_stroke_is_cyclic(gps);
   iter->tri_len += gps->tot_triangles;
+
+  if (iter->strokes_len == iter->strokes_alloc_len) {
+    iter->strokes_alloc_len = max_ii(iter->strokes_alloc_len * 2, 64);
+    iter->strokes = MEM_reallocN(iter->strokes, sizeof(*iter->strokes) * iter->strokes_alloc_len);
+  }
+  iter->strokes[iter->strokes_len++] = gps;
 }
 
 static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfra)
@@ -422,6 +442,9 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
         .vert_len = 1, /* Start at 1 for the gl_InstanceID trick to work (see vert shader). */
         .tri_len = 0,
         .curve_len = 0,
+        .strokes = NULL,
+        .strokes_len = 0,
+        .strokes_alloc_len = 0,
     };
     BKE_gpencil_visible_stroke_advanced_iter(
         NULL, ob, NULL, gpencil_object_verts_count_cb, &iter, do_onion, cfra);
@@ -439,9 +462,16 @@ static void gpencil_batches_ensure(Object *ob, GpencilBatchCache *cache, int cfr
     /* Create IBO. */
     GPU_indexbuf_init(&iter.ibo, GPU_PRIM_TRIS, iter.tri_len, iter.vert_len);
 
-    /* Fill buffers with data. */
-    BKE_gpencil_visible_stroke_advanced_iter(
-        NULL, ob, NULL, gpencil_stroke_iter_cb, &iter, do_onion, cfra);
+    /* Fill buffers with data. Every stroke writes to its own range of the buffers, so this can be
+     * done in parallel. */
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.min_iter_per_thread = 64;
+    settings.userdata_chunk = &iter.ibo;
+    settings.userdata_chunk_size = sizeof(iter.ibo);
+    settings.func_reduce = gpencil_stroke_fill_reduce;
+    BLI_task_parallel_range(0, iter.strokes_len, &iter, gpencil_stroke_fill_task, &settings);
+    MEM_SAFE_FREE(iter.strokes);
 
     /* Mark last 2 verts as invalid. */
     for (int i = 0; i < 2; i++) {
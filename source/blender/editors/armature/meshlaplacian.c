@@ -17,6 +17,7 @@
 #include "BLI_math.h"
 #include "BLI_memarena.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 
 #include "BLT_translation.h"
 
@@ -1435,10 +1436,33 @@ static void meshdeform_matrix_add_exterior_phi(
   }
 }
 
+typedef struct MeshDeformStaticWeightsData {
+  MeshDeformBind *mdb;
+  int cagevert;
+} MeshDeformStaticWeightsData;
+
+static void meshdeform_static_weights_task(void *__restrict userdata,
+                                           const int b,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  MeshDeformStaticWeightsData *data = userdata;
+  MeshDeformBind *mdb = data->mdb;
+  float vec[3], gridvec[3];
+
+  if (mdb->inside[b]) {
+    copy_v3_v3(vec, mdb->vertexcos[b]);
+    gridvec[0] = (vec[0] - mdb->min[0] - mdb->halfwidth[0]) / mdb->width[0];
+    gridvec[1] = (vec[1] - mdb->min[1] - mdb->halfwidth[1]) / mdb->width[1];
+    gridvec[2] = (vec[2] - mdb->min[2] - mdb->halfwidth[2]) / mdb->width[2];
+
+    mdb->weights[b * mdb->cage_verts_num + data->cagevert] = meshdeform_interp_w(
+        mdb, gridvec, vec, data->cagevert);
+  }
+}
+
 static void meshdeform_matrix_solve(MeshDeformModifierData *mmd, MeshDeformBind *mdb)
 {
   LinearSolver *context;
-  float vec[3], gridvec[3];
   int a, b, x, y, z, totvar;
   char message[256];
 
@@ -1504,16 +1528,15 @@ static void meshdeform_matrix_solve(MeshDeformModifierData *mmd, MeshDeformBind
 
       if (mdb->weights) {
         /* static bind : compute weights for each vertex */
-        for (b = 0; b < mdb->verts_num; b++) {
-          if (mdb->inside[b]) {
-            copy_v3_v3(vec, mdb->vertexcos[b]);
-            gridvec[0] = (vec[0] - mdb->min[0] - mdb->halfwidth[0]) / mdb->width[0];
-            gridvec[1] = (vec[1] - mdb->min[1] - mdb->halfwidth[1]) / mdb->width[1];
-            gridvec[2] = (vec[2] - mdb->min[2] - mdb->halfwidth[2]) / mdb->width[2];
-
-            mdb->weights[b * mdb->cage_verts_num + a] = meshdeform_interp_w(mdb, gridvec, vec, a);
-          }
-        }
+        MeshDeformStaticWeightsData data = {
+            .mdb = mdb,
+            .cagevert = a,
+        };
+        TaskParallelSettings settings;
+        BLI_parallel_range_settings_defaults(&settings);
+        settings.min_iter_per_thread = 1024;
+        BLI_task_parallel_range(
+            0, mdb->verts_num, &data, meshdeform_static_weights_task, &settings);
       }
       else {
         MDefBindInfluence *inf;
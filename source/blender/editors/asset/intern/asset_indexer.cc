@@ -6,6 +6,7 @@
 
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <optional>
 
 #include "ED_asset_indexer.h"
@@ -423,6 +424,8 @@ struct AssetLibraryIndex {
    * Contains absolute paths to the indices.
    */
   Set<std::string> unused_file_indices;
+  /** Indices are read from multiple threads, see #filelist_readjob_recursive_dir_add_items. */
+  std::mutex unused_file_indices_mutex;
 
   /**
    * \brief Absolute path where the indices of `library` are stored.
@@ -506,6 +509,7 @@ struct AssetLibraryIndex {
 
   void mark_as_used(const std::string &filename)
   {
+    std::lock_guard lock{unused_file_indices_mutex};
     unused_file_indices.remove(filename);
   }
 
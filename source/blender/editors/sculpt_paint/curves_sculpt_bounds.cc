@@ -0,0 +1,131 @@
+/* SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "curves_sculpt_intern.hh"
+
+#include "BLI_task.hh"
+
+#include "DNA_screen_types.h"
+
+/**
+ * The code below uses a prefix naming convention to indicate the coordinate space:
+ * cu: Local space of the curves object that is being edited.
+ * re: 2D coordinates within the region.
+ */
+
+namespace blender::ed::sculpt_paint {
+
+static void curve_bounds_calc(const Span<float3> positions_cu, float3 &r_min, float3 &r_max)
+{
+  r_min = float3(FLT_MAX);
+  r_max = float3(-FLT_MAX);
+  for (const float3 &position_cu : positions_cu) {
+    math::min_max(position_cu, r_min, r_max);
+  }
+}
+
+void CurvesBoundsCache::build(const CurvesGeometry &curves)
+{
+  const Span<float3> positions_cu = curves.positions();
+  min_cu_.reinitialize(curves.curves_num());
+  max_cu_.reinitialize(curves.curves_num());
+  threading::parallel_for(curves.curves_range(), 512, [&](const IndexRange range) {
+    for (const int curve_i : range) {
+      const IndexRange points = curves.points_for_curve(curve_i);
+      curve_bounds_calc(positions_cu.slice(points), min_cu_[curve_i], max_cu_[curve_i]);
+    }
+  });
+}
+
+void CurvesBoundsCache::update(const CurvesGeometry &curves, const Span<int> curve_indices)
+{
+  const Span<float3> positions_cu = curves.positions();
+  threading::parallel_for(curve_indices.index_range(), 512, [&](const IndexRange range) {
+    for (const int curve_i : curve_indices.slice(range)) {
+      const IndexRange points = curves.points_for_curve(curve_i);
+      curve_bounds_calc(positions_cu.slice(points), min_cu_[curve_i], max_cu_[curve_i]);
+    }
+  });
+}
+
+void CurvesBoundsCache::remove_curves(const IndexMask curves_to_remove)
+{
+  if (curves_to_remove.is_empty()) {
+    return;
+  }
+  Array<float3> new_min_cu(min_cu_.size() - curves_to_remove.size());
+  Array<float3> new_max_cu(new_min_cu.size());
+  int new_i = 0;
+  int remove_i = 0;
+  for (const int curve_i : min_cu_.index_range()) {
+    if (remove_i < curves_to_remove.size() && curves_to_remove[remove_i] == curve_i) {
+      remove_i++;
+      continue;
+    }
+    new_min_cu[new_i] = min_cu_[curve_i];
+    new_max_cu[new_i] = max_cu_[curve_i];
+    new_i++;
+  }
+  min_cu_ = std::move(new_min_cu);
+  max_cu_ = std::move(new_max_cu);
+}
+
+bool CurvesBoundsCache::curve_may_be_near_segment_cu(const int curve_i,
+                                                     const float3 &start_cu,
+                                                     const float3 &end_cu,
+                                                     const float radius_cu) const
+{
+  /* Compare with the bounds of the capsule around the segment. */
+  const float3 brush_min_cu = math::min(start_cu, end_cu) - float3(radius_cu);
+  const float3 brush_max_cu = math::max(start_cu, end_cu) + float3(radius_cu);
+  const float3 &min_cu = min_cu_[curve_i];
+  const float3 &max_cu = max_cu_[curve_i];
+  for (const int axis : IndexRange(3)) {
+    if (min_cu[axis] > brush_max_cu[axis] || max_cu[axis] < brush_min_cu[axis]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool CurvesBoundsCache::curve_may_be_near_segment_re(const int curve_i,
+                                                     const ARegion &region,
+                                                     const float4x4 &projection,
+                                                     const float2 &start_re,
+                                                     const float2 &end_re,
+                                                     const float radius_re) const
+{
+  const float3 &min_cu = min_cu_[curve_i];
+  const float3 &max_cu = max_cu_[curve_i];
+
+  /* Project the corners of the bounding box, in the same way as
+   * #ED_view3d_project_float_v2_m4. */
+  float2 min_re(FLT_MAX);
+  float2 max_re(-FLT_MAX);
+  for (const int corner : IndexRange(8)) {
+    const float4 corner_cu((corner & 1) ? max_cu.x : min_cu.x,
+                           (corner & 2) ? max_cu.y : min_cu.y,
+                           (corner & 4) ? max_cu.z : min_cu.z,
+                           1.0f);
+    float4 corner_clip;
+    mul_v4_m4v4(corner_clip, projection.values, corner_cu);
+    if (corner_clip.w <= FLT_EPSILON) {
+      /* The box is partially behind the view, don't try to cull it. */
+      return true;
+    }
+    const float2 corner_re(
+        (region.winx / 2.0f) + (region.winx / 2.0f) * corner_clip.x / corner_clip.w,
+        (region.winy / 2.0f) + (region.winy / 2.0f) * corner_clip.y / corner_clip.w);
+    math::min_max(corner_re, min_re, max_re);
+  }
+
+  const float2 brush_min_re = math::min(start_re, end_re) - float2(radius_re);
+  const float2 brush_max_re = math::max(start_re, end_re) + float2(radius_re);
+  for (const int axis : IndexRange(2)) {
+    if (min_re[axis] > brush_max_re[axis] || max_re[axis] < brush_min_re[axis]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace blender::ed::sculpt_paint
@@ -64,6 +64,9 @@ class CombOperation : public CurvesSculptStrokeOperation {
   /** Length of each segment indexed by the index of the first point in the segment. */
   Array<float> segment_lengths_cu_;
 
+  /** Used to skip curves that are far away from the brush. */
+  CurvesBoundsCache curves_bounds_;
+
   friend struct CombOperationExecutor;
 
  public:
@@ -163,10 +166,15 @@ struct CombOperationExecutor {
         this->initialize_spherical_brush_reference_point();
       }
       this->initialize_segment_lengths();
+      self_->curves_bounds_.build(*curves_);
       /* Combing does nothing when there is no mouse movement, so return directly. */
       return;
     }
 
+    if (!self_->curves_bounds_.is_valid_for(*curves_)) {
+      self_->curves_bounds_.build(*curves_);
+    }
+
     EnumerableThreadSpecific<Vector<int>> changed_curves;
 
     if (falloff_shape_ == PAINT_FALLOFF_SHAPE_TUBE) {
@@ -180,6 +188,9 @@ struct CombOperationExecutor {
     }
 
     this->restore_segment_lengths(changed_curves);
+    for (const Vector<int> &local_changed_curves : changed_curves) {
+      self_->curves_bounds_.update(*curves_, local_changed_curves);
+    }
 
     curves_->tag_positions_changed();
     DEG_id_tag_update(&curves_id_->id, ID_RECALC_GEOMETRY);
@@ -201,6 +212,14 @@ struct CombOperationExecutor {
     threading::parallel_for(curves_->curves_range(), 256, [&](const IndexRange curves_range) {
       Vector<int> &local_changed_curves = r_changed_curves.local();
       for (const int curve_i : curves_range) {
+        if (!self_->curves_bounds_.curve_may_be_near_segment_re(curve_i,
+                                                                *region_,
+                                                                projection,
+                                                                brush_pos_prev_re_,
+                                                                brush_pos_re_,
+                                                                brush_radius_re_)) {
+          continue;
+        }
         bool curve_changed = false;
         const IndexRange points = curves_->points_for_curve(curve_i);
         for (const int point_i : points.drop_front(1)) {
@@ -273,6 +292,10 @@ struct CombOperationExecutor {
     threading::parallel_for(curves_->curves_range(), 256, [&](const IndexRange curves_range) {
       Vector<int> &local_changed_curves = r_changed_curves.local();
       for (const int curve_i : curves_range) {
+        if (!self_->curves_bounds_.curve_may_be_near_segment_cu(
+                curve_i, brush_start_cu, brush_end_cu, brush_radius_cu)) {
+          continue;
+        }
         bool curve_changed = false;
         const IndexRange points = curves_->points_for_curve(curve_i);
         for (const int point_i : points.drop_front(1)) {
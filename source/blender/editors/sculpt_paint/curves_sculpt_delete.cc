@@ -43,6 +43,9 @@ class DeleteOperation : public CurvesSculptStrokeOperation {
  private:
   float2 last_mouse_position_;
 
+  /** Used to skip curves that are far away from the brush. */
+  CurvesBoundsCache curves_bounds_;
+
  public:
   void on_stroke_extended(bContext *C, const StrokeExtension &stroke_extension) override
   {
@@ -66,27 +69,37 @@ class DeleteOperation : public CurvesSculptStrokeOperation {
                                                            last_mouse_position_;
     const float2 mouse_end = stroke_extension.mouse_position;
 
+    if (stroke_extension.is_first || !curves_bounds_.is_valid_for(curves)) {
+      curves_bounds_.build(curves);
+    }
+
     /* Find indices of curves that have to be removed. */
     Vector<int64_t> indices;
     const IndexMask curves_to_remove = index_mask_ops::find_indices_based_on_predicate(
         curves.curves_range(), 512, indices, [&](const int curve_i) {
+          if (!curves_bounds_.curve_may_be_near_segment_re(
+                  curve_i, *region, projection, mouse_start, mouse_end, brush_radius)) {
+            return false;
+          }
           const IndexRange point_range = curves.points_for_curve(curve_i);
-          for (const int segment_i : IndexRange(point_range.size() - 1)) {
-            const float3 pos1 = positions[point_range[segment_i]];
-            const float3 pos2 = positions[point_range[segment_i + 1]];
-
-            float2 pos1_proj, pos2_proj;
-            ED_view3d_project_float_v2_m4(region, pos1, pos1_proj, projection.values);
-            ED_view3d_project_float_v2_m4(region, pos2, pos2_proj, projection.values);
+          float2 pos1_proj;
+          ED_view3d_project_float_v2_m4(
+              region, positions[point_range.first()], pos1_proj, projection.values);
+          for (const int point_i : point_range.drop_front(1)) {
+            float2 pos2_proj;
+            ED_view3d_project_float_v2_m4(
+                region, positions[point_i], pos2_proj, projection.values);
 
             const float dist = dist_seg_seg_v2(pos1_proj, pos2_proj, mouse_start, mouse_end);
             if (dist <= brush_radius) {
               return true;
             }
+            pos1_proj = pos2_proj;
           }
           return false;
         });
 
+    curves_bounds_.remove_curves(curves_to_remove);
     curves.remove_curves(curves_to_remove);
 
     curves.tag_positions_changed();
@@ -7,6 +7,9 @@
 #include "curves_sculpt_intern.h"
 #include "paint_intern.h"
 
+#include "BLI_array.hh"
+#include "BLI_float4x4.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_math_vector.hh"
 
 #include "BKE_curves.hh"
@@ -45,6 +48,47 @@ struct CurvesBrush3D {
   float radius_cu;
 };
 
+/**
+ * Bounding boxes of all curves in the local space of the curves object, kept during a stroke.
+ * Brushes use them to skip curves that are far away from the brush without looking at each of
+ * their points. Only the bounds of curves that were changed by a brush step have to be updated.
+ */
+class CurvesBoundsCache {
+ private:
+  Array<float3> min_cu_;
+  Array<float3> max_cu_;
+
+ public:
+  void build(const CurvesGeometry &curves);
+  /** Recompute the bounds of the given curves after their points moved. */
+  void update(const CurvesGeometry &curves, Span<int> curve_indices);
+  /** Keep the bounds in sync after #CurvesGeometry::remove_curves. */
+  void remove_curves(IndexMask curves_to_remove);
+
+  bool is_valid_for(const CurvesGeometry &curves) const
+  {
+    return min_cu_.size() == curves.curves_num();
+  }
+
+  /**
+   * \return False if no point of the curve is closer than `radius_cu` to the line segment.
+   */
+  bool curve_may_be_near_segment_cu(int curve_i,
+                                    const float3 &start_cu,
+                                    const float3 &end_cu,
+                                    float radius_cu) const;
+  /**
+   * \return False if no point of the curve is closer than `radius_re` to the line segment in
+   * region space, after being projected with `projection`.
+   */
+  bool curve_may_be_near_segment_re(int curve_i,
+                                    const ARegion &region,
+                                    const float4x4 &projection,
+                                    const float2 &start_re,
+                                    const float2 &end_re,
+                                    float radius_re) const;
+};
+
 /**
  * Find 3d brush position based on cursor position for curves sculpting.
  */
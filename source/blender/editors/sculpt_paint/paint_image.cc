@@ -81,11 +81,6 @@ ImagePaintPartialRedraw *get_imapaintpartial(void)
   return &imapaintpartial;
 }
 
-void set_imapaintpartial(struct ImagePaintPartialRedraw *ippr)
-{
-  imapaintpartial = *ippr;
-}
-
 /* Image paint Partial Redraw & Dirty Region. */
 
 void ED_imapaint_clear_partial_redraw(void)
@@ -4656,7 +4656,13 @@ static bool partial_redraw_array_merge(ImagePaintPartialRedraw *pr,
   return touch;
 }
 
-/* Loop over all images on this mesh and update any we have touched */
+/**
+ * Loop over all images on this mesh and update any we have touched.
+ *
+ * Each touched cell is tagged for a partial update of the display buffer and GPU texture.
+ * The image buffer is held for the whole stroke, so unlike #imapaint_image_update
+ * this doesn't acquire it again for every cell.
+ */
 static bool project_image_refresh_tagged(ProjPaintState *ps)
 {
   ImagePaintPartialRedraw *pr;
@@ -4666,12 +4672,27 @@ static bool project_image_refresh_tagged(ProjPaintState *ps)
 
   for (a = 0, projIma = ps->projImages; a < ps->image_tot; a++, projIma++) {
     if (projIma->touch) {
+      ImBuf *ibuf = projIma->ibuf;
+      ImageTile *image_tile = BKE_image_get_tile_from_iuser(projIma->ima, &projIma->iuser);
+
+      if (ibuf->mipmap[0]) {
+        ibuf->userflags |= IB_MIPMAP_INVALID;
+      }
+
       /* look over each bound cell */
       for (i = 0; i < PROJ_BOUNDBOX_SQUARED; i++) {
         pr = &(projIma->partRedrawRect[i]);
         if (BLI_rcti_is_valid(&pr->dirty_region)) {
-          set_imapaintpartial(pr);
-          imapaint_image_update(NULL, projIma->ima, projIma->ibuf, &projIma->iuser, true);
+          const rcti *rect = &pr->dirty_region;
+          IMB_partial_display_buffer_update_delayed(
+              ibuf, rect->xmin, rect->ymin, rect->xmax, rect->ymax);
+          BKE_image_update_gputexture_delayed(projIma->ima,
+                                              image_tile,
+                                              ibuf,
+                                              rect->xmin,
+                                              rect->ymin,
+                                              BLI_rcti_size_x(rect),
+                                              BLI_rcti_size_y(rect));
           redraw = 1;
         }
 
@@ -220,7 +220,6 @@ void imapaint_image_update(struct SpaceImage *sima,
                            struct ImageUser *iuser,
                            short texpaint);
 struct ImagePaintPartialRedraw *get_imapaintpartial(void);
-void set_imapaintpartial(struct ImagePaintPartialRedraw *ippr);
 void imapaint_region_tiles(
     struct ImBuf *ibuf, int x, int y, int w, int h, int *tx, int *ty, int *tw, int *th);
 bool get_imapaint_zoom(struct bContext *C, float *zoomx, float *zoomy);
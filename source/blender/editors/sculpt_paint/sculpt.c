@@ -2353,6 +2353,37 @@ float SCULPT_brush_strength_factor(SculptSession *ss,
   float rgba[4];
   float point[3];
 
+  /* Hardness. */
+  float final_len = len;
+  const float hardness = cache->paint_brush.hardness;
+  float p = len / cache->radius;
+  if (p < hardness) {
+    final_len = 0.0f;
+  }
+  else if (hardness == 1.0f) {
+    final_len = cache->radius;
+  }
+  else {
+    p = (p - hardness) / (1.0f - hardness);
+    final_len = p * cache->radius;
+  }
+
+  /* Falloff curve. */
+  const float falloff = BKE_brush_curve_strength(br, final_len, cache->radius);
+  const float front = frontface(br, cache->view_normal, vno, fno);
+
+  /* Paint mask. */
+  const float unmasked = 1.0f - mask;
+
+  /* Auto-masking. */
+  const float automask = SCULPT_automasking_factor_get(cache->automasking, ss, vertex_index);
+
+  /* Sampling the brush texture is by far the most expensive part, skip it for vertices that are
+   * fully masked or outside of the falloff. */
+  if (falloff == 0.0f || front == 0.0f || unmasked == 0.0f || automask == 0.0f) {
+    return 0.0f;
+  }
+
   sub_v3_v3v3(point, brush_point, cache->plane_offset);
 
   if (!mtex->tex) {
@@ -2405,30 +2436,10 @@ float SCULPT_brush_strength_factor(SculptSession *ss,
     }
   }
 
-  /* Hardness. */
-  float final_len = len;
-  const float hardness = cache->paint_brush.hardness;
-  float p = len / cache->radius;
-  if (p < hardness) {
-    final_len = 0.0f;
-  }
-  else if (hardness == 1.0f) {
-    final_len = cache->radius;
-  }
-  else {
-    p = (p - hardness) / (1.0f - hardness);
-    final_len = p * cache->radius;
-  }
-
-  /* Falloff curve. */
-  avg *= BKE_brush_curve_strength(br, final_len, cache->radius);
-  avg *= frontface(br, cache->view_normal, vno, fno);
-
-  /* Paint mask. */
-  avg *= 1.0f - mask;
-
-  /* Auto-masking. */
-  avg *= SCULPT_automasking_factor_get(cache->automasking, ss, vertex_index);
+  avg *= falloff;
+  avg *= front;
+  avg *= unmasked;
+  avg *= automask;
 
   return avg;
 }
@@ -5426,6 +5437,12 @@ static void sculpt_stroke_done(const bContext *C, struct PaintStroke *UNUSED(str
     SCULPT_flush_update_done(C, ob, SCULPT_UPDATE_COORDS);
   }
 
+  /* The BVH gets less optimal with dynamic topology over many strokes, rebuild it once it is
+   * degraded so stroke performance does not decay over a session. */
+  if (BKE_pbvh_type(ss->pbvh) == PBVH_BMESH && BKE_pbvh_bmesh_needs_rebuild(ss->pbvh)) {
+    SCULPT_pbvh_clear(ob);
+  }
+
   WM_event_add_notifier(C, NC_OBJECT | ND_DRAW, ob);
   sculpt_brush_exit_tex(sd);
 }
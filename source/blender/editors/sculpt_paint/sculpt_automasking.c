@@ -222,6 +222,29 @@ static float *SCULPT_topology_automasking_init(Sculpt *sd, Object *ob, float *au
   return automask_factor;
 }
 
+/* Initializing the factors loops over the whole mesh, which is noticeable when starting strokes
+ * on large meshes. Only the propagation of boundary distances depends on the order. */
+#define AUTOMASK_INIT_MIN_ITER_PER_THREAD 4096
+
+typedef struct AutomaskInitData {
+  SculptSession *ss;
+  float *automask_factor;
+  int *edge_distance;
+  eBoundaryAutomaskMode mode;
+  int propagation_steps;
+  int active_face_set;
+} AutomaskInitData;
+
+static void face_sets_automasking_init_task_cb(void *__restrict userdata,
+                                               const int i,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  AutomaskInitData *data = userdata;
+  if (!SCULPT_vertex_has_face_set(data->ss, i, data->active_face_set)) {
+    data->automask_factor[i] *= 0.0f;
+  }
+}
+
 static float *sculpt_face_sets_automasking_init(Sculpt *sd, Object *ob, float *automask_factor)
 {
   SculptSession *ss = ob->sculpt;
@@ -237,18 +260,60 @@ static float *sculpt_face_sets_automasking_init(Sculpt *sd, Object *ob, float *a
   }
 
   int tot_vert = SCULPT_vertex_count_get(ss);
-  int active_face_set = SCULPT_active_face_set_get(ss);
-  for (int i = 0; i < tot_vert; i++) {
-    if (!SCULPT_vertex_has_face_set(ss, i, active_face_set)) {
-      automask_factor[i] *= 0.0f;
-    }
-  }
+  AutomaskInitData data = {
+      .ss = ss,
+      .automask_factor = automask_factor,
+      .active_face_set = SCULPT_active_face_set_get(ss),
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = AUTOMASK_INIT_MIN_ITER_PER_THREAD;
+  BLI_task_parallel_range(0, tot_vert, &data, face_sets_automasking_init_task_cb, &settings);
 
   return automask_factor;
 }
 
 #define EDGE_DISTANCE_INF -1
 
+static void boundary_automasking_init_task_cb(void *__restrict userdata,
+                                              const int i,
+                                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  AutomaskInitData *data = userdata;
+  SculptSession *ss = data->ss;
+  int *edge_distance = data->edge_distance;
+
+  edge_distance[i] = EDGE_DISTANCE_INF;
+  switch (data->mode) {
+    case AUTOMASK_INIT_BOUNDARY_EDGES:
+      if (SCULPT_vertex_is_boundary(ss, i)) {
+        edge_distance[i] = 0;
+      }
+      break;
+    case AUTOMASK_INIT_BOUNDARY_FACE_SETS:
+      if (!SCULPT_vertex_has_unique_face_set(ss, i)) {
+        edge_distance[i] = 0;
+      }
+      break;
+  }
+}
+
+static void boundary_automasking_apply_task_cb(void *__restrict userdata,
+                                               const int i,
+                                               const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  AutomaskInitData *data = userdata;
+  const int *edge_distance = data->edge_distance;
+
+  if (edge_distance[i] == EDGE_DISTANCE_INF) {
+    return;
+  }
+  const float p = 1.0f - ((float)edge_distance[i] / (float)data->propagation_steps);
+  const float edge_boundary_automask = pow2f(p);
+  data->automask_factor[i] *= (1.0f - edge_boundary_automask);
+}
+
 float *SCULPT_boundary_automasking_init(Object *ob,
                                         eBoundaryAutomaskMode mode,
                                         int propagation_steps,
@@ -264,21 +329,18 @@ float *SCULPT_boundary_automasking_init(Object *ob,
   const int totvert = SCULPT_vertex_count_get(ss);
   int *edge_distance = MEM_callocN(sizeof(int) * totvert, "automask_factor");
 
-  for (int i = 0; i < totvert; i++) {
-    edge_distance[i] = EDGE_DISTANCE_INF;
-    switch (mode) {
-      case AUTOMASK_INIT_BOUNDARY_EDGES:
-        if (SCULPT_vertex_is_boundary(ss, i)) {
-          edge_distance[i] = 0;
-        }
-        break;
-      case AUTOMASK_INIT_BOUNDARY_FACE_SETS:
-        if (!SCULPT_vertex_has_unique_face_set(ss, i)) {
-          edge_distance[i] = 0;
-        }
-        break;
-    }
-  }
+  AutomaskInitData data = {
+      .ss = ss,
+      .automask_factor = automask_factor,
+      .edge_distance = edge_distance,
+      .mode = mode,
+      .propagation_steps = propagation_steps,
+  };
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = AUTOMASK_INIT_MIN_ITER_PER_THREAD;
+  BLI_task_parallel_range(0, totvert, &data, boundary_automasking_init_task_cb, &settings);
 
   for (int propagation_it = 0; propagation_it < propagation_steps; propagation_it++) {
     for (int i = 0; i < totvert; i++) {
@@ -295,14 +357,7 @@ float *SCULPT_boundary_automasking_init(Object *ob,
     }
   }
 
-  for (int i = 0; i < totvert; i++) {
-    if (edge_distance[i] == EDGE_DISTANCE_INF) {
-      continue;
-    }
-    const float p = 1.0f - ((float)edge_distance[i] / (float)propagation_steps);
-    const float edge_boundary_automask = pow2f(p);
-    automask_factor[i] *= (1.0f - edge_boundary_automask);
-  }
+  BLI_task_parallel_range(0, totvert, &data, boundary_automasking_apply_task_cb, &settings);
 
   MEM_SAFE_FREE(edge_distance);
   return automask_factor;
@@ -1514,18 +1514,53 @@ void SCULPT_undo_push_end(Object *ob)
   SCULPT_undo_push_end_ex(ob, false);
 }
 
+static void *sculpt_undo_array_shrink(UndoSculpt *usculpt, void *array, const size_t size)
+{
+  if (array == NULL || size == 0) {
+    return array;
+  }
+  const size_t old_size = MEM_allocN_len(array);
+  if (size >= old_size) {
+    return array;
+  }
+  usculpt->undo_size -= old_size - size;
+  return MEM_reallocN(array, size);
+}
+
+/**
+ * Mesh nodes store their unique vertices first, followed by the vertices shared with other
+ * nodes. The shared ones are only needed for original data lookups during the stroke, restoring
+ * the undo step only uses the unique vertices.
+ */
+static void sculpt_undo_node_shrink_to_unique_verts(UndoSculpt *usculpt, SculptUndoNode *unode)
+{
+  if (unode->maxvert == 0) {
+    return;
+  }
+
+  const size_t totvert = (size_t)unode->totvert;
+  unode->index = sculpt_undo_array_shrink(usculpt, unode->index, sizeof(*unode->index) * totvert);
+  unode->co = sculpt_undo_array_shrink(usculpt, unode->co, sizeof(*unode->co) * totvert);
+  unode->orig_co = sculpt_undo_array_shrink(
+      usculpt, unode->orig_co, sizeof(*unode->orig_co) * totvert);
+  unode->col = sculpt_undo_array_shrink(usculpt, unode->col, sizeof(*unode->col) * totvert);
+  unode->mask = sculpt_undo_array_shrink(usculpt, unode->mask, sizeof(*unode->mask) * totvert);
+}
+
 void SCULPT_undo_push_end_ex(struct Object *ob, const bool use_nested_undo)
 {
   UndoSculpt *usculpt = sculpt_undo_get_nodes();
   SculptUndoNode *unode;
 
-  /* We don't need normals in the undo stack. */
   for (unode = usculpt->nodes.first; unode; unode = unode->next) {
+    /* We don't need normals in the undo stack. */
     if (unode->no) {
       usculpt->undo_size -= MEM_allocN_len(unode->no);
       MEM_freeN(unode->no);
       unode->no = NULL;
     }
+
+    sculpt_undo_node_shrink_to_unique_verts(usculpt, unode);
   }
 
   /* We could remove this and enforce all callers run in an operator using 'OPTYPE_UNDO'. */
@@ -43,6 +43,7 @@
 #include "ED_clip.h"
 #include "ED_mask.h"
 #include "ED_screen.h"
+#include "ED_screen_types.h"
 #include "ED_select_utils.h"
 
 #include "WM_api.h"
@@ -643,6 +644,9 @@ typedef struct PrefetchJob {
 
   int start_frame, current_frame, end_frame;
   short render_size, render_flag;
+
+  /* Frames in the playback direction are pre-fetched first. */
+  bool forward;
 } PrefetchJob;
 
 typedef struct PrefetchQueue {
@@ -653,6 +657,9 @@ typedef struct PrefetchQueue {
    * otherwise it goes backwards in time (starting from current frame).
    */
   bool forward;
+  /* True once the frames in the initial direction are all read and pre-fetching continues in the
+   * other direction. */
+  bool is_direction_switched;
 
   SpinLock spin;
 
@@ -745,6 +752,25 @@ static int prefetch_find_uncached_frame(MovieClip *clip,
   return current_frame;
 }
 
+/* find next uncached frame after the current one in the queue's direction */
+static int prefetch_queue_find_uncached_frame(const PrefetchQueue *queue, MovieClip *clip)
+{
+  if (queue->forward) {
+    return prefetch_find_uncached_frame(clip,
+                                        queue->current_frame + 1,
+                                        queue->end_frame,
+                                        queue->render_size,
+                                        queue->render_flag,
+                                        1);
+  }
+  return prefetch_find_uncached_frame(clip,
+                                      queue->current_frame - 1,
+                                      queue->start_frame,
+                                      queue->render_size,
+                                      queue->render_flag,
+                                      -1);
+}
+
 /* get memory buffer for first uncached frame within prefetch frame range */
 static uchar *prefetch_thread_next_frame(PrefetchQueue *queue,
                                          MovieClip *clip,
@@ -756,29 +782,15 @@ static uchar *prefetch_thread_next_frame(PrefetchQueue *queue,
   BLI_spin_lock(&queue->spin);
   if (!*queue->stop && !check_prefetch_break() &&
       IN_RANGE_INCL(queue->current_frame, queue->start_frame, queue->end_frame)) {
-    int current_frame;
-
-    if (queue->forward) {
-      current_frame = prefetch_find_uncached_frame(clip,
-                                                   queue->current_frame + 1,
-                                                   queue->end_frame,
-                                                   queue->render_size,
-                                                   queue->render_flag,
-                                                   1);
-      /* switch direction if read frames from current up to scene end frames */
-      if (current_frame > queue->end_frame) {
-        queue->current_frame = queue->initial_frame;
-        queue->forward = false;
-      }
-    }
-
-    if (!queue->forward) {
-      current_frame = prefetch_find_uncached_frame(clip,
-                                                   queue->current_frame - 1,
-                                                   queue->start_frame,
-                                                   queue->render_size,
-                                                   queue->render_flag,
-                                                   -1);
+    int current_frame = prefetch_queue_find_uncached_frame(queue, clip);
+
+    /* switch direction if read frames from current up to scene start or end frame */
+    if (!IN_RANGE_INCL(current_frame, queue->start_frame, queue->end_frame) &&
+        !queue->is_direction_switched) {
+      queue->current_frame = queue->initial_frame;
+      queue->forward = !queue->forward;
+      queue->is_direction_switched = true;
+      current_frame = prefetch_queue_find_uncached_frame(queue, clip);
     }
 
     if (IN_RANGE_INCL(current_frame, queue->start_frame, queue->end_frame)) {
@@ -791,12 +803,11 @@ static uchar *prefetch_thread_next_frame(PrefetchQueue *queue,
 
       queue->current_frame = current_frame;
 
-      if (queue->forward) {
-        frames_processed = queue->current_frame - queue->initial_frame;
-      }
-      else {
-        frames_processed = (queue->end_frame - queue->initial_frame) +
-                           (queue->initial_frame - queue->current_frame);
+      frames_processed = abs(queue->current_frame - queue->initial_frame);
+      if (queue->is_direction_switched) {
+        /* All frames in the initial direction are processed already. */
+        frames_processed += queue->forward ? (queue->initial_frame - queue->start_frame) :
+                                             (queue->end_frame - queue->initial_frame);
       }
 
       *queue->do_update = 1;
@@ -860,6 +871,7 @@ static void start_prefetch_threads(MovieClip *clip,
                                    int end_frame,
                                    short render_size,
                                    short render_flag,
+                                   bool forward,
                                    short *stop,
                                    short *do_update,
                                    float *progress)
@@ -876,7 +888,8 @@ static void start_prefetch_threads(MovieClip *clip,
   queue.end_frame = end_frame;
   queue.render_size = render_size;
   queue.render_flag = render_flag;
-  queue.forward = 1;
+  queue.forward = forward;
+  queue.is_direction_switched = false;
 
   queue.stop = stop;
   queue.do_update = do_update;
@@ -941,35 +954,29 @@ static void do_prefetch_movie(MovieClip *clip,
                               int end_frame,
                               short render_size,
                               short render_flag,
+                              bool forward,
                               short *stop,
                               short *do_update,
                               float *progress)
 {
-  int frame;
   int frames_processed = 0;
 
-  /* read frames starting from current frame up to scene end frame */
-  for (frame = current_frame; frame <= end_frame; frame++) {
-    if (!prefetch_movie_frame(clip, clip_local, frame, render_size, render_flag, stop)) {
-      return;
-    }
+  /* read frames starting from current frame up to scene end (or start) frame in the playback
+   * direction first, and then the frames in the other direction */
+  for (int pass = 0; pass < 2; pass++) {
+    const int step = (forward == (pass == 0)) ? 1 : -1;
+    const int last_frame = (step > 0) ? end_frame : start_frame;
 
-    frames_processed++;
+    for (int frame = current_frame; frame != last_frame + step; frame += step) {
+      if (!prefetch_movie_frame(clip, clip_local, frame, render_size, render_flag, stop)) {
+        return;
+      }
 
-    *do_update = 1;
-    *progress = (float)frames_processed / (end_frame - start_frame);
-  }
+      frames_processed++;
 
-  /* read frames starting from current frame up to scene start frame */
-  for (frame = current_frame; frame >= start_frame; frame--) {
-    if (!prefetch_movie_frame(clip, clip_local, frame, render_size, render_flag, stop)) {
-      return;
+      *do_update = 1;
+      *progress = (float)frames_processed / (end_frame - start_frame);
     }
-
-    frames_processed++;
-
-    *do_update = 1;
-    *progress = (float)frames_processed / (end_frame - start_frame);
   }
 }
 
@@ -985,6 +992,7 @@ static void prefetch_startjob(void *pjv, short *stop, short *do_update, float *p
                            pj->end_frame,
                            pj->render_size,
                            pj->render_flag,
+                           pj->forward,
                            stop,
                            do_update,
                            progress);
@@ -998,6 +1006,7 @@ static void prefetch_startjob(void *pjv, short *stop, short *do_update, float *p
                       pj->end_frame,
                       pj->render_size,
                       pj->render_flag,
+                      pj->forward,
                       stop,
                       do_update,
                       progress);
@@ -1046,6 +1055,19 @@ static int prefetch_get_final_frame(const bContext *C)
   return end_frame;
 }
 
+/* pre-fetch backwards in time when the animation is played in reverse */
+static bool prefetch_get_forward(const bContext *C)
+{
+  bScreen *screen = ED_screen_animation_playing(CTX_wm_manager(C));
+
+  if (screen != NULL && screen->animtimer != NULL) {
+    const ScreenAnimData *sad = screen->animtimer->customdata;
+    return (sad->flag & ANIMPLAY_FLAG_REVERSE) == 0;
+  }
+
+  return true;
+}
+
 /* returns true if early out is possible */
 static bool prefetch_check_early_out(const bContext *C)
 {
@@ -1105,6 +1127,7 @@ void clip_start_prefetch_job(const bContext *C)
   pj->end_frame = prefetch_get_final_frame(C);
   pj->render_size = sc->user.render_size;
   pj->render_flag = sc->user.render_flag;
+  pj->forward = prefetch_get_forward(C);
 
   /* Create a local copy of the clip, so that video file (clip->anim) access can happen without
    * acquiring the lock which will interfere with the main thread. */
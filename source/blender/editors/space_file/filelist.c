@@ -3592,6 +3592,72 @@ static bool filelist_readjob_should_recurse_into_entry(const int max_recursion,
   return true;
 }
 
+/** A directory listed by #filelist_readjob_recursive_dir_add_items. */
+typedef struct FileListReadDir {
+  char *dir;
+  int level;
+  ListBase entries;
+  int entries_num;
+  bool is_lib;
+} FileListReadDir;
+
+typedef struct FileListReadDirsData {
+  FileListReadDir *read_dirs;
+  FileList *filelist;
+  FileIndexer *indexer_runtime;
+  const char *filter_glob;
+  const char *main_name;
+  bool do_lib;
+  const short *stop;
+} FileListReadDirsData;
+
+static void filelist_readjob_list_dir_task(void *__restrict userdata,
+                                           const int index,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const FileListReadDirsData *data = userdata;
+  FileListReadDir *read_dir = &data->read_dirs[index];
+  const FileList *filelist = data->filelist;
+
+  if (*data->stop) {
+    return;
+  }
+
+  const bool skip_currpar = (read_dir->level > 1);
+
+  if (data->do_lib) {
+    ListLibOptions list_lib_options = 0;
+    if (!skip_currpar) {
+      list_lib_options |= LIST_LIB_ADD_PARENT;
+    }
+
+    /* Libraries are loaded recursively when max_recursion is set. It doesn't check if there is
+     * still a recursion level over. */
+    if (filelist->max_recursion > 0) {
+      list_lib_options |= LIST_LIB_RECURSIVE;
+    }
+    /* Only load assets when browsing an asset library. For normal file browsing we return all
+     * entries. `FLF_ASSETS_ONLY` filter can be enabled/disabled by the user. */
+    if (filelist->asset_library_ref) {
+      list_lib_options |= LIST_LIB_ASSETS_ONLY;
+    }
+    read_dir->entries_num = filelist_readjob_list_lib(
+        read_dir->dir, &read_dir->entries, list_lib_options, data->indexer_runtime);
+    if (read_dir->entries_num > 0) {
+      read_dir->is_lib = true;
+    }
+  }
+
+  if (!read_dir->is_lib) {
+    read_dir->entries_num = filelist_readjob_list_dir(read_dir->dir,
+                                                      &read_dir->entries,
+                                                      data->filter_glob,
+                                                      data->do_lib,
+                                                      data->main_name,
+                                                      skip_currpar);
+  }
+}
+
 static void filelist_readjob_recursive_dir_add_items(const bool do_lib,
                                                      FileListReadJob *job_params,
                                                      const short *stop,
@@ -3599,7 +3665,6 @@ static void filelist_readjob_recursive_dir_add_items(const bool do_lib,
                                                      float *progress)
 {
   FileList *filelist = job_params->tmp_filelist; /* Use the thread-safe filelist queue. */
-  ListBase entries = {0};
   BLI_Stack *todo_dirs;
   TodoDir *td_dir;
   char dir[FILE_MAX_LIBEXTRA];
@@ -3625,88 +3690,83 @@ static void filelist_readjob_recursive_dir_add_items(const bool do_lib,
   }
 
   while (!BLI_stack_is_empty(todo_dirs) && !(*stop)) {
-    FileListInternEntry *entry;
-    int entries_num = 0;
-
-    char *subdir;
-    char rel_subdir[FILE_MAX_LIBEXTRA];
-    int recursion_level;
-    bool skip_currpar;
-
-    td_dir = BLI_stack_peek(todo_dirs);
-    subdir = td_dir->dir;
-    recursion_level = td_dir->level;
-    skip_currpar = (recursion_level > 1);
-
-    BLI_stack_discard(todo_dirs);
-
-    /* ARRRG! We have to be very careful *not to use* common BLI_path_util helpers over
-     * entry->relpath itself (nor any path containing it), since it may actually be a datablock
-     * name inside .blend file, which can have slashes and backslashes! See T46827.
-     * Note that in the end, this means we 'cache' valid relative subdir once here,
-     * this is actually better. */
-    BLI_strncpy(rel_subdir, subdir, sizeof(rel_subdir));
-    BLI_path_normalize_dir(root, rel_subdir);
-    BLI_path_rel(rel_subdir, root);
-
-    bool is_lib = false;
-    if (do_lib) {
-      ListLibOptions list_lib_options = 0;
-      if (!skip_currpar) {
-        list_lib_options |= LIST_LIB_ADD_PARENT;
-      }
+    /* List all pending directories at once. With many library files, most time is spent waiting
+     * on file IO (or on reading indices), so they are listed in parallel. The resulting entries
+     * are then processed in order on this thread. */
+    const int read_dirs_num = (int)BLI_stack_count(todo_dirs);
+    FileListReadDir *read_dirs = MEM_calloc_arrayN(read_dirs_num, sizeof(*read_dirs), __func__);
+    for (int i = 0; i < read_dirs_num; i++) {
+      td_dir = BLI_stack_peek(todo_dirs);
+      read_dirs[i].dir = td_dir->dir;
+      read_dirs[i].level = td_dir->level;
+      BLI_stack_discard(todo_dirs);
+    }
 
-      /* Libraries are loaded recursively when max_recursion is set. It doesn't check if there is
-       * still a recursion level over. */
-      if (max_recursion > 0) {
-        list_lib_options |= LIST_LIB_RECURSIVE;
-      }
-      /* Only load assets when browsing an asset library. For normal file browsing we return all
-       * entries. `FLF_ASSETS_ONLY` filter can be enabled/disabled by the user. */
-      if (filelist->asset_library_ref) {
-        list_lib_options |= LIST_LIB_ASSETS_ONLY;
-      }
-      entries_num = filelist_readjob_list_lib(
-          subdir, &entries, list_lib_options, &indexer_runtime);
-      if (entries_num > 0) {
-        is_lib = true;
+    FileListReadDirsData read_dirs_data = {
+        .read_dirs = read_dirs,
+        .filelist = filelist,
+        .indexer_runtime = &indexer_runtime,
+        .filter_glob = filter_glob,
+        .main_name = job_params->main_name,
+        .do_lib = do_lib,
+        .stop = stop,
+    };
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = read_dirs_num > 1;
+    settings.min_iter_per_thread = 1;
+    BLI_task_parallel_range(
+        0, read_dirs_num, &read_dirs_data, filelist_readjob_list_dir_task, &settings);
+
+    for (int i = 0; i < read_dirs_num; i++) {
+      FileListReadDir *read_dir = &read_dirs[i];
+      FileListInternEntry *entry;
+      char *subdir = read_dir->dir;
+      char rel_subdir[FILE_MAX_LIBEXTRA];
+      const int recursion_level = read_dir->level;
+
+      /* ARRRG! We have to be very careful *not to use* common BLI_path_util helpers over
+       * entry->relpath itself (nor any path containing it), since it may actually be a datablock
+       * name inside .blend file, which can have slashes and backslashes! See T46827.
+       * Note that in the end, this means we 'cache' valid relative subdir once here,
+       * this is actually better. */
+      BLI_strncpy(rel_subdir, subdir, sizeof(rel_subdir));
+      BLI_path_normalize_dir(root, rel_subdir);
+      BLI_path_rel(rel_subdir, root);
+
+      for (entry = read_dir->entries.first; entry; entry = entry->next) {
+        entry->uid = filelist_uid_generate(filelist);
+
+        /* When loading entries recursive, the rel_path should be relative from the root dir.
+         * we combine the relative path to the subdir with the relative path of the entry. */
+        BLI_join_dirfile(dir, sizeof(dir), rel_subdir, entry->relpath);
+        MEM_freeN(entry->relpath);
+        entry->relpath = BLI_strdup(dir + 2); /* + 2 to remove '//'
+                                               * added by BLI_path_rel to rel_subdir. */
+        entry->name = fileentry_uiname(root, entry->relpath, entry->typeflag, dir);
+        entry->free_name = true;
+
+        if (filelist_readjob_should_recurse_into_entry(
+                max_recursion, read_dir->is_lib, recursion_level, entry)) {
+          /* We have a directory we want to list, add it to todo list! */
+          BLI_join_dirfile(dir, sizeof(dir), root, entry->relpath);
+          BLI_path_normalize_dir(job_params->main_name, dir);
+          td_dir = BLI_stack_push_r(todo_dirs);
+          td_dir->level = recursion_level + 1;
+          td_dir->dir = BLI_strdup(dir);
+          dirs_todo_count++;
+        }
       }
-    }
 
-    if (!is_lib) {
-      entries_num = filelist_readjob_list_dir(
-          subdir, &entries, filter_glob, do_lib, job_params->main_name, skip_currpar);
-    }
+      filelist_readjob_append_entries(
+          job_params, &read_dir->entries, read_dir->entries_num, do_update);
 
-    for (entry = entries.first; entry; entry = entry->next) {
-      entry->uid = filelist_uid_generate(filelist);
-
-      /* When loading entries recursive, the rel_path should be relative from the root dir.
-       * we combine the relative path to the subdir with the relative path of the entry. */
-      BLI_join_dirfile(dir, sizeof(dir), rel_subdir, entry->relpath);
-      MEM_freeN(entry->relpath);
-      entry->relpath = BLI_strdup(dir + 2); /* + 2 to remove '//'
-                                             * added by BLI_path_rel to rel_subdir. */
-      entry->name = fileentry_uiname(root, entry->relpath, entry->typeflag, dir);
-      entry->free_name = true;
-
-      if (filelist_readjob_should_recurse_into_entry(
-              max_recursion, is_lib, recursion_level, entry)) {
-        /* We have a directory we want to list, add it to todo list! */
-        BLI_join_dirfile(dir, sizeof(dir), root, entry->relpath);
-        BLI_path_normalize_dir(job_params->main_name, dir);
-        td_dir = BLI_stack_push_r(todo_dirs);
-        td_dir->level = recursion_level + 1;
-        td_dir->dir = BLI_strdup(dir);
-        dirs_todo_count++;
-      }
+      dirs_done_count++;
+      MEM_freeN(subdir);
     }
+    MEM_freeN(read_dirs);
 
-    filelist_readjob_append_entries(job_params, &entries, entries_num, do_update);
-
-    dirs_done_count++;
     *progress = (float)dirs_done_count / (float)dirs_todo_count;
-    MEM_freeN(subdir);
   }
 
   /* Finalize and free indexer. */
@@ -644,6 +644,26 @@ static const char *info_statusbar_string(Main *bmain,
     uintptr_t mem_in_use = MEM_get_memory_in_use();
     BLI_str_format_byte_unit(formatted_mem, mem_in_use, false);
     ofs += BLI_snprintf_rlen(info + ofs, len, TIP_("Memory: %s"), formatted_mem);
+
+    /* The largest tagged category, to tell which part of Blender uses the memory. */
+    eMEMCategory largest_category = MEM_CATEGORY_GENERAL;
+    size_t largest_category_mem = 0;
+    for (int i = MEM_CATEGORY_GENERAL + 1; i < MEM_CATEGORY_NUM; i++) {
+      const eMEMCategory category = eMEMCategory(i);
+      const size_t category_mem = MEM_get_category_memory_in_use(category);
+      if (category_mem > largest_category_mem) {
+        largest_category = category;
+        largest_category_mem = category_mem;
+      }
+    }
+    if (largest_category != MEM_CATEGORY_GENERAL) {
+      BLI_str_format_byte_unit(formatted_mem, largest_category_mem, false);
+      ofs += BLI_snprintf_rlen(info + ofs,
+                               len - ofs,
+                               " (%s: %s)",
+                               MEM_category_name(largest_category),
+                               formatted_mem);
+    }
   }
 
   /* GPU VRAM status. */
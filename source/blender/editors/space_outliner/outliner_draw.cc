@@ -3441,6 +3441,7 @@ static void outliner_draw_hierarchy_line(
 }
 
 static void outliner_draw_hierarchy_lines_recursive(uint pos,
+                                                    const ARegion *region,
                                                     SpaceOutliner *space_outliner,
                                                     ListBase *lb,
                                                     int startx,
@@ -3455,6 +3456,12 @@ static void outliner_draw_hierarchy_lines_recursive(uint pos,
   bool draw_hierarchy_line;
   bool is_object_line;
   LISTBASE_FOREACH (TreeElement *, te, lb) {
+    /* Everything below is outside of the view. Lines of the parents still end below the view,
+     * so they are drawn as if their whole subtree was walked. */
+    if (*starty < region->v2d.cur.ymin) {
+      break;
+    }
+
     TreeStoreElem *tselem = TREESTORE(te);
     draw_hierarchy_line = false;
     is_object_line = false;
@@ -3479,8 +3486,19 @@ static void outliner_draw_hierarchy_lines_recursive(uint pos,
         }
       }
 
-      outliner_draw_hierarchy_lines_recursive(
-          pos, space_outliner, &te->subtree, startx + UI_UNIT_X, col, draw_grayed_out, starty);
+      outliner_draw_hierarchy_lines_recursive(pos,
+                                              region,
+                                              space_outliner,
+                                              &te->subtree,
+                                              startx + UI_UNIT_X,
+                                              col,
+                                              draw_grayed_out,
+                                              starty);
+    }
+
+    /* Skip lines which end above the view. */
+    if (draw_hierarchy_line && (*starty > region->v2d.cur.ymax)) {
+      draw_hierarchy_line = false;
     }
 
     if (draw_hierarchy_line) {
@@ -3496,7 +3514,8 @@ static void outliner_draw_hierarchy_lines_recursive(uint pos,
   }
 }
 
-static void outliner_draw_hierarchy_lines(SpaceOutliner *space_outliner,
+static void outliner_draw_hierarchy_lines(const ARegion *region,
+                                          SpaceOutliner *space_outliner,
                                           ListBase *lb,
                                           int startx,
                                           int *starty)
@@ -3517,7 +3536,8 @@ static void outliner_draw_hierarchy_lines(SpaceOutliner *space_outliner,
 
   GPU_line_width(1.0f);
   GPU_blend(GPU_BLEND_ALPHA);
-  outliner_draw_hierarchy_lines_recursive(pos, space_outliner, lb, startx, col, false, starty);
+  outliner_draw_hierarchy_lines_recursive(
+      pos, region, space_outliner, lb, startx, col, false, starty);
   GPU_blend(GPU_BLEND_NONE);
 
   immUnbindProgram();
@@ -3582,8 +3602,18 @@ static void outliner_draw_highlights_recursive(uint pos,
     const TreeStoreElem *tselem = TREESTORE(te);
     const int start_y = *io_start_y;
 
+    /* Rows are drawn top to bottom, everything after this one is outside of the view too. */
+    if (start_y + 2 * UI_UNIT_Y < region->v2d.cur.ymin) {
+      break;
+    }
+    /* Skip drawing rows above the view, but still walk over their children. */
+    const bool in_view = (start_y <= region->v2d.cur.ymax);
+
     /* Selection status. */
-    if ((tselem->flag & TSE_ACTIVE) && (tselem->flag & TSE_SELECTED)) {
+    if (!in_view) {
+      /* Pass. */
+    }
+    else if ((tselem->flag & TSE_ACTIVE) && (tselem->flag & TSE_SELECTED)) {
       immUniformColor4fv(col_active);
       immRecti(pos, 0, start_y, (int)region->v2d.cur.xmax, start_y + UI_UNIT_Y);
     }
@@ -3593,7 +3623,7 @@ static void outliner_draw_highlights_recursive(uint pos,
     }
 
     /* Highlights. */
-    if (tselem->flag & (TSE_DRAG_ANY | TSE_HIGHLIGHTED | TSE_SEARCHMATCH)) {
+    if (in_view && (tselem->flag & (TSE_DRAG_ANY | TSE_HIGHLIGHTED | TSE_SEARCHMATCH))) {
       const int end_x = (int)region->v2d.cur.xmax;
 
       if (tselem->flag & TSE_DRAG_ANY) {
@@ -3733,7 +3763,7 @@ static void outliner_draw_tree(bContext *C,
   /* Draw hierarchy lines for collections and object children. */
   starty = (int)region->v2d.tot.ymax - OL_Y_OFFSET;
   startx = columns_offset + UI_UNIT_X / 2 - (U.pixelsize + 1) / 2;
-  outliner_draw_hierarchy_lines(space_outliner, &space_outliner->tree, startx, &starty);
+  outliner_draw_hierarchy_lines(region, space_outliner, &space_outliner->tree, startx, &starty);
 
   /* Items themselves. */
   starty = (int)region->v2d.tot.ymax - UI_UNIT_Y - OL_Y_OFFSET;
@@ -2,6 +2,7 @@
 
 #include <cstring>
 
+#include "BLI_index_mask_ops.hh"
 #include "BLI_listbase.h"
 
 #include "DNA_screen_types.h"
@@ -29,10 +30,12 @@ static void apply_filter_operation(const VArray<T> &data,
                                    const IndexMask mask,
                                    Vector<int64_t> &new_indices)
 {
-  for (const int64_t i : mask) {
-    if (check_fn(data[i])) {
-      new_indices.append(i);
-    }
+  const IndexMask result = index_mask_ops::find_indices_based_on_predicate(
+      mask, 4096, new_indices, [&](const int64_t i) { return check_fn(data[i]); });
+  if (result.indices().data() != new_indices.data()) {
+    /* All or no rows passed the filter, in which case the indices are not written. */
+    new_indices.clear();
+    new_indices.extend(result.indices());
   }
 }
 
@@ -275,7 +278,6 @@ IndexMask spreadsheet_filter_rows(const SpaceSpreadsheet &sspreadsheet,
           continue;
         }
         Vector<int64_t> new_indices;
-        new_indices.reserve(mask_indices.size());
         apply_row_filter(*row_filter, columns, mask, new_indices);
         std::swap(new_indices, mask_indices);
         mask = IndexMask(mask_indices);
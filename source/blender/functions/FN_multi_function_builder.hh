@@ -230,9 +230,55 @@ class CustomMF_SI_SI_SI_SO : public MultiFunction {
                const VArray<In2> &in2,
                const VArray<In3> &in3,
                MutableSpan<Out1> out1) {
-      /* Virtual arrays are not devirtualized yet, to avoid generating lots of code without further
-       * consideration. */
-      execute_SI_SI_SI_SO(element_fn, mask, in1, in2, in3, out1.data());
+      if (in1.is_span() && in2.is_span() && in3.is_span()) {
+        const Span<In1> in1_span = in1.get_internal_span();
+        const Span<In2> in2_span = in2.get_internal_span();
+        const Span<In3> in3_span = in3.get_internal_span();
+        mask.to_best_mask_type([&](const auto &mask) {
+          execute_SI_SI_SI_SO(element_fn, mask, in1_span, in2_span, in3_span, out1.data());
+        });
+        return;
+      }
+
+      /* Not every combination of virtual array types is devirtualized, to avoid generating lots
+       * of code. Instead, the inputs are loaded into buffers in chunks, which avoids the virtual
+       * function call overhead for every element. */
+      static constexpr int64_t MaxChunkSize = 32;
+      TypedBuffer<In1, MaxChunkSize> in1_buffer_owner;
+      TypedBuffer<In2, MaxChunkSize> in2_buffer_owner;
+      TypedBuffer<In3, MaxChunkSize> in3_buffer_owner;
+      MutableSpan<In1> in1_buffer{in1_buffer_owner.ptr(), MaxChunkSize};
+      MutableSpan<In2> in2_buffer{in2_buffer_owner.ptr(), MaxChunkSize};
+      MutableSpan<In3> in3_buffer{in3_buffer_owner.ptr(), MaxChunkSize};
+
+      const int64_t mask_size = mask.size();
+      for (int64_t chunk_start = 0; chunk_start < mask_size; chunk_start += MaxChunkSize) {
+        const int64_t chunk_size = std::min(mask_size - chunk_start, MaxChunkSize);
+        const IndexMask sliced_mask = mask.slice(chunk_start, chunk_size);
+
+        MutableSpan<In1> in1_chunk = in1_buffer.take_front(chunk_size);
+        MutableSpan<In2> in2_chunk = in2_buffer.take_front(chunk_size);
+        MutableSpan<In3> in3_chunk = in3_buffer.take_front(chunk_size);
+        in1.materialize_compressed_to_uninitialized(sliced_mask, in1_chunk);
+        in2.materialize_compressed_to_uninitialized(sliced_mask, in2_chunk);
+        in3.materialize_compressed_to_uninitialized(sliced_mask, in3_chunk);
+
+        if (sliced_mask.is_range()) {
+          execute_SI_SI_SI_SO(element_fn,
+                              IndexRange(chunk_size),
+                              in1_chunk,
+                              in2_chunk,
+                              in3_chunk,
+                              out1.data() + sliced_mask[0]);
+        }
+        else {
+          execute_SI_SI_SI_SO_compressed(
+              element_fn, sliced_mask, in1_chunk, in2_chunk, in3_chunk, out1.data());
+        }
+        destruct_n(in1_chunk.data(), chunk_size);
+        destruct_n(in2_chunk.data(), chunk_size);
+        destruct_n(in3_chunk.data(), chunk_size);
+      }
     };
   }
 
@@ -253,6 +299,24 @@ class CustomMF_SI_SI_SI_SO : public MultiFunction {
     }
   }
 
+  /** Expects the input arrays to be "compressed", i.e. there are no gaps between the elements. */
+  template<typename ElementFuncT,
+           typename MaskT,
+           typename In1Array,
+           typename In2Array,
+           typename In3Array>
+  BLI_NOINLINE static void execute_SI_SI_SI_SO_compressed(const ElementFuncT &element_fn,
+                                                          MaskT mask,
+                                                          const In1Array &in1,
+                                                          const In2Array &in2,
+                                                          const In3Array &in3,
+                                                          Out1 *__restrict r_out)
+  {
+    for (const int64_t i : IndexRange(mask.size())) {
+      new (r_out + mask[i]) Out1(element_fn(in1[i], in2[i], in3[i]));
+    }
+  }
+
   void call(IndexMask mask, MFParams params, MFContext UNUSED(context)) const override
   {
     const VArray<In1> &in1 = params.readonly_single_input<In1>(0);
@@ -310,9 +374,61 @@ class CustomMF_SI_SI_SI_SI_SO : public MultiFunction {
                const VArray<In3> &in3,
                const VArray<In4> &in4,
                MutableSpan<Out1> out1) {
-      /* Virtual arrays are not devirtualized yet, to avoid generating lots of code without further
-       * consideration. */
-      execute_SI_SI_SI_SI_SO(element_fn, mask, in1, in2, in3, in4, out1.data());
+      if (in1.is_span() && in2.is_span() && in3.is_span() && in4.is_span()) {
+        const Span<In1> in1_span = in1.get_internal_span();
+        const Span<In2> in2_span = in2.get_internal_span();
+        const Span<In3> in3_span = in3.get_internal_span();
+        const Span<In4> in4_span = in4.get_internal_span();
+        mask.to_best_mask_type([&](const auto &mask) {
+          execute_SI_SI_SI_SI_SO(
+              element_fn, mask, in1_span, in2_span, in3_span, in4_span, out1.data());
+        });
+        return;
+      }
+
+      /* See #CustomMF_SI_SI_SI_SO::create_function. */
+      static constexpr int64_t MaxChunkSize = 32;
+      TypedBuffer<In1, MaxChunkSize> in1_buffer_owner;
+      TypedBuffer<In2, MaxChunkSize> in2_buffer_owner;
+      TypedBuffer<In3, MaxChunkSize> in3_buffer_owner;
+      TypedBuffer<In4, MaxChunkSize> in4_buffer_owner;
+      MutableSpan<In1> in1_buffer{in1_buffer_owner.ptr(), MaxChunkSize};
+      MutableSpan<In2> in2_buffer{in2_buffer_owner.ptr(), MaxChunkSize};
+      MutableSpan<In3> in3_buffer{in3_buffer_owner.ptr(), MaxChunkSize};
+      MutableSpan<In4> in4_buffer{in4_buffer_owner.ptr(), MaxChunkSize};
+
+      const int64_t mask_size = mask.size();
+      for (int64_t chunk_start = 0; chunk_start < mask_size; chunk_start += MaxChunkSize) {
+        const int64_t chunk_size = std::min(mask_size - chunk_start, MaxChunkSize);
+        const IndexMask sliced_mask = mask.slice(chunk_start, chunk_size);
+
+        MutableSpan<In1> in1_chunk = in1_buffer.take_front(chunk_size);
+        MutableSpan<In2> in2_chunk = in2_buffer.take_front(chunk_size);
+        MutableSpan<In3> in3_chunk = in3_buffer.take_front(chunk_size);
+        MutableSpan<In4> in4_chunk = in4_buffer.take_front(chunk_size);
+        in1.materialize_compressed_to_uninitialized(sliced_mask, in1_chunk);
+        in2.materialize_compressed_to_uninitialized(sliced_mask, in2_chunk);
+        in3.materialize_compressed_to_uninitialized(sliced_mask, in3_chunk);
+        in4.materialize_compressed_to_uninitialized(sliced_mask, in4_chunk);
+
+        if (sliced_mask.is_range()) {
+          execute_SI_SI_SI_SI_SO(element_fn,
+                                 IndexRange(chunk_size),
+                                 in1_chunk,
+                                 in2_chunk,
+                                 in3_chunk,
+                                 in4_chunk,
+                                 out1.data() + sliced_mask[0]);
+        }
+        else {
+          execute_SI_SI_SI_SI_SO_compressed(
+              element_fn, sliced_mask, in1_chunk, in2_chunk, in3_chunk, in4_chunk, out1.data());
+        }
+        destruct_n(in1_chunk.data(), chunk_size);
+        destruct_n(in2_chunk.data(), chunk_size);
+        destruct_n(in3_chunk.data(), chunk_size);
+        destruct_n(in4_chunk.data(), chunk_size);
+      }
     };
   }
 
@@ -335,6 +451,26 @@ class CustomMF_SI_SI_SI_SI_SO : public MultiFunction {
     }
   }
 
+  /** Expects the input arrays to be "compressed", i.e. there are no gaps between the elements. */
+  template<typename ElementFuncT,
+           typename MaskT,
+           typename In1Array,
+           typename In2Array,
+           typename In3Array,
+           typename In4Array>
+  BLI_NOINLINE static void execute_SI_SI_SI_SI_SO_compressed(const ElementFuncT &element_fn,
+                                                             MaskT mask,
+                                                             const In1Array &in1,
+                                                             const In2Array &in2,
+                                                             const In3Array &in3,
+                                                             const In4Array &in4,
+                                                             Out1 *__restrict r_out)
+  {
+    for (const int64_t i : IndexRange(mask.size())) {
+      new (r_out + mask[i]) Out1(element_fn(in1[i], in2[i], in3[i], in4[i]));
+    }
+  }
+
   void call(IndexMask mask, MFParams params, MFContext UNUSED(context)) const override
   {
     const VArray<In1> &in1 = params.readonly_single_input<In1>(0);
@@ -43,6 +43,20 @@ class IndexFieldInput final : public FieldInput {
   }
 };
 
+class SingleValueFieldInput final : public FieldInput {
+ public:
+  SingleValueFieldInput() : FieldInput(CPPType::get<int>(), "Single Value")
+  {
+  }
+
+  GVArray get_varray_for_context(const FieldContext &UNUSED(context),
+                                 IndexMask mask,
+                                 ResourceScope &UNUSED(scope)) const final
+  {
+    return VArray<int>::ForSingle(3, mask.min_array_size());
+  }
+};
+
 TEST(field, VArrayInput)
 {
   GField index_field{std::make_shared<IndexFieldInput>()};
@@ -125,6 +139,67 @@ TEST(field, InputAndFunction)
   EXPECT_EQ(result[8], 16);
 }
 
+TEST(field, SingleValueInputAndFunction)
+{
+  GField single_field{std::make_shared<SingleValueFieldInput>()};
+
+  int calls_num = 0;
+  std::unique_ptr<MultiFunction> square_fn = std::make_unique<CustomMF_SI_SO<int, int>>(
+      "square", [&](int a) {
+        calls_num++;
+        return a * a;
+      });
+  GField output_field{
+      std::make_shared<FieldOperation>(FieldOperation(std::move(square_fn), {single_field})), 0};
+
+  FieldContext context;
+  ResourceScope scope;
+  Vector<GVArray> results = evaluate_fields(scope, {output_field}, IndexRange(1000), context);
+
+  /* The function only has a single value input, so it is only called once and the result is
+   * not expanded to an array. */
+  EXPECT_EQ(calls_num, 1);
+  EXPECT_TRUE(results[0].is_single());
+  VArray<int> varray = results[0].typed<int>();
+  EXPECT_EQ(varray.get(0), 9);
+  EXPECT_EQ(varray.get(999), 9);
+}
+
+TEST(field, SingleValueInputInVaryingField)
+{
+  GField index_field{std::make_shared<IndexFieldInput>()};
+  GField single_field{std::make_shared<SingleValueFieldInput>()};
+
+  int calls_num = 0;
+  std::unique_ptr<MultiFunction> square_fn = std::make_unique<CustomMF_SI_SO<int, int>>(
+      "square", [&](int a) {
+        calls_num++;
+        return a * a;
+      });
+  GField square_field{
+      std::make_shared<FieldOperation>(FieldOperation(std::move(square_fn), {single_field})), 0};
+
+  std::unique_ptr<MultiFunction> add_fn = std::make_unique<CustomMF_SI_SI_SO<int, int, int>>(
+      "add", [](int a, int b) { return a + b; });
+  GField output_field{std::make_shared<FieldOperation>(
+                          FieldOperation(std::move(add_fn), {index_field, square_field})),
+                      0};
+
+  Array<int> result(1000);
+
+  FieldContext context;
+  FieldEvaluator evaluator{context, 1000};
+  evaluator.add_with_destination(output_field, result.as_mutable_span());
+  evaluator.evaluate();
+
+  /* The part of the field that only depends on the single value input is evaluated once, even
+   * though the rest of the field is evaluated for every index. */
+  EXPECT_EQ(calls_num, 1);
+  EXPECT_EQ(result[0], 9);
+  EXPECT_EQ(result[10], 19);
+  EXPECT_EQ(result[999], 1008);
+}
+
 TEST(field, TwoFunctions)
 {
   GField index_field{std::make_shared<IndexFieldInput>()};
@@ -221,6 +221,45 @@ TEST(multi_function, CustomMF_SI_SI_SI_SO)
   EXPECT_EQ(outputs[3], 13);
 }
 
+TEST(multi_function, CustomMF_SI_SI_SI_SO_MixedInputs)
+{
+  CustomMF_SI_SI_SI_SO<int, int, int, int> fn{"multiply add",
+                                              [](int a, int b, int c) { return a * b + c; }};
+
+  const int size = 100;
+  Array<int> values_a(size);
+  for (const int i : values_a.index_range()) {
+    values_a[i] = i;
+  }
+  const int value_b = 3;
+  const VArray<int> values_c = VArray<int>::ForFunc(size, [](const int64_t i) { return int(i); });
+  Array<int> outputs(size, -1);
+
+  MFParamsBuilder params(fn, size);
+  params.add_readonly_single_input(values_a.as_span());
+  params.add_readonly_single_input(&value_b);
+  params.add_readonly_single_input(values_c);
+  params.add_uninitialized_single_output(outputs.as_mutable_span());
+
+  MFContextBuilder context;
+
+  Vector<int64_t> indices;
+  for (int64_t i = 0; i < size; i += 2) {
+    indices.append(i);
+  }
+  fn.call(indices.as_span(), params, context);
+
+  for (const int i : outputs.index_range()) {
+    EXPECT_EQ(outputs[i], (i % 2 == 0) ? i * 4 : -1);
+  }
+
+  fn.call(IndexRange(size), params, context);
+
+  for (const int i : outputs.index_range()) {
+    EXPECT_EQ(outputs[i], i * 4);
+  }
+}
+
 TEST(multi_function, CustomMF_SM)
 {
   CustomMF_SM<std::string> fn("AddSuffix", [](std::string &value) { value += " test"; });
@@ -387,20 +387,30 @@ static Vector<std::pair<int, GSpan>> prepare_attribute_fallbacks(
 }
 
 /**
- * Calls #fn for every geometry in the given #InstanceReference. Also passes on the transformation
- * that is applied to every instance.
+ * A geometry referenced by an #InstanceReference, with the information necessary to place it
+ * relative to every instance using that reference.
  */
-static void foreach_geometry_in_reference(
-    const InstanceReference &reference,
-    const float4x4 &base_transform,
-    const uint32_t id,
-    FunctionRef<void(const GeometrySet &geometry_set, const float4x4 &transform, uint32_t id)> fn)
+struct ReferencedGeometry {
+  GeometrySet geometry_set;
+  /** Transform relative to the instance. Only set for objects in collections. */
+  std::optional<float4x4> transform;
+  /** Index of the object in the collection, used for its id. -1 if it's not in a collection. */
+  int collection_index = -1;
+};
+
+/**
+ * Retrieve all geometries in the given #InstanceReference. This is done once per reference,
+ * because retrieving the evaluated geometry of objects and collections is relatively expensive
+ * and many instances typically share the same reference.
+ */
+static Vector<ReferencedGeometry> gather_geometries_in_reference(
+    const InstanceReference &reference)
 {
+  Vector<ReferencedGeometry> geometries;
   switch (reference.type()) {
     case InstanceReference::Type::Object: {
       const Object &object = reference.object();
-      const GeometrySet object_geometry_set = object_get_evaluated_geometry_set(object);
-      fn(object_geometry_set, base_transform, id);
+      geometries.append({object_get_evaluated_geometry_set(object)});
       break;
     }
     case InstanceReference::Type::Collection: {
@@ -409,24 +419,22 @@ static void foreach_geometry_in_reference(
       sub_v3_v3(offset_matrix.values[3], collection.instance_offset);
       int index = 0;
       FOREACH_COLLECTION_OBJECT_RECURSIVE_BEGIN (&collection, object) {
-        const GeometrySet object_geometry_set = object_get_evaluated_geometry_set(*object);
-        const float4x4 matrix = base_transform * offset_matrix * object->obmat;
-        const int sub_id = noise::hash(id, index);
-        fn(object_geometry_set, matrix, sub_id);
+        geometries.append(
+            {object_get_evaluated_geometry_set(*object), offset_matrix * object->obmat, index});
         index++;
       }
       FOREACH_COLLECTION_OBJECT_RECURSIVE_END;
       break;
     }
     case InstanceReference::Type::GeometrySet: {
-      const GeometrySet &instance_geometry_set = reference.geometry_set();
-      fn(instance_geometry_set, base_transform, id);
+      geometries.append({reference.geometry_set()});
       break;
     }
     case InstanceReference::Type::None: {
       break;
     }
   }
+  return geometries;
 }
 
 static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
@@ -438,6 +446,11 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
   const Span<int> handles = instances_component.instance_reference_handles();
   const Span<float4x4> transforms = instances_component.instance_transforms();
 
+  Array<Vector<ReferencedGeometry>> referenced_geometries(references.size());
+  for (const int i : references.index_range()) {
+    referenced_geometries[i] = gather_geometries_in_reference(references[i]);
+  }
+
   Span<int> stored_instance_ids;
   if (gather_info.create_id_attribute_on_any_component) {
     std::optional<GSpan> ids = instances_component.attributes().get_for_read("id");
@@ -458,7 +471,6 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
   for (const int i : transforms.index_range()) {
     const int handle = handles[i];
     const float4x4 &transform = transforms[i];
-    const InstanceReference &reference = references[handle];
     const float4x4 new_base_transform = base_transform * transform;
 
     /* Update attribute fallbacks for the current instance. */
@@ -484,18 +496,20 @@ static void gather_realize_tasks_for_instances(GatherTasksInfo &gather_info,
     const uint32_t instance_id = noise::hash(base_instance_context.id, local_instance_id);
 
     /* Add realize tasks for all referenced geometry sets recursively. */
-    foreach_geometry_in_reference(reference,
-                                  new_base_transform,
-                                  instance_id,
-                                  [&](const GeometrySet &instance_geometry_set,
-                                      const float4x4 &transform,
-                                      const uint32_t id) {
-                                    instance_context.id = id;
-                                    gather_realize_tasks_recursive(gather_info,
-                                                                   instance_geometry_set,
-                                                                   transform,
-                                                                   instance_context);
-                                  });
+    for (const ReferencedGeometry &referenced : referenced_geometries[handle]) {
+      if (referenced.collection_index == -1) {
+        instance_context.id = instance_id;
+        gather_realize_tasks_recursive(
+            gather_info, referenced.geometry_set, new_base_transform, instance_context);
+      }
+      else {
+        instance_context.id = noise::hash(instance_id, referenced.collection_index);
+        gather_realize_tasks_recursive(gather_info,
+                                       referenced.geometry_set,
+                                       new_base_transform * *referenced.transform,
+                                       instance_context);
+      }
+    }
   }
 }
 
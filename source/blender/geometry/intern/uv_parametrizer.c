@@ -14,6 +14,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rand.h"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 
 #include "GEO_uv_parametrizer.h"
@@ -4581,60 +4582,113 @@ void GEO_uv_parametrizer_construct_end(ParamHandle *handle,
   phandle->state = PHANDLE_STATE_CONSTRUCTED;
 }
 
+typedef struct PLscmBeginData {
+  PHandle *handle;
+  PBool live;
+  PBool abf;
+} PLscmBeginData;
+
+static void p_chart_lscm_begin_task(void *__restrict userdata,
+                                    const int i,
+                                    const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  PLscmBeginData *data = userdata;
+  PChart *chart = data->handle->charts[i];
+
+  for (PFace *f = chart->faces; f; f = f->nextlink) {
+    p_face_backup_uvs(f);
+  }
+  p_chart_lscm_begin(chart, data->live, data->abf);
+}
+
 void GEO_uv_parametrizer_lscm_begin(ParamHandle *handle, ParamBool live, ParamBool abf)
 {
   PHandle *phandle = (PHandle *)handle;
-  PFace *f;
-  int i;
 
   param_assert(phandle->state == PHANDLE_STATE_CONSTRUCTED);
   phandle->state = PHANDLE_STATE_LSCM;
 
-  for (i = 0; i < phandle->ncharts; i++) {
-    for (f = phandle->charts[i]->faces; f; f = f->nextlink) {
-      p_face_backup_uvs(f);
-    }
-    p_chart_lscm_begin(phandle->charts[i], (PBool)live, (PBool)abf);
+  /* Charts don't share any data, so they can be prepared and solved independently. */
+  PLscmBeginData data = {
+      .handle = phandle,
+      .live = (PBool)live,
+      .abf = (PBool)abf,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  BLI_task_parallel_range(0, phandle->ncharts, &data, p_chart_lscm_begin_task, &settings);
+}
+
+typedef struct PLscmSolveCounts {
+  int changed;
+  int failed;
+} PLscmSolveCounts;
+
+static void p_chart_lscm_solve_task(void *__restrict userdata,
+                                    const int i,
+                                    const TaskParallelTLS *__restrict tls)
+{
+  PHandle *phandle = userdata;
+  PLscmSolveCounts *counts = tls->userdata_chunk;
+  PChart *chart = phandle->charts[i];
+
+  if (chart->u.lscm.context == NULL) {
+    return;
+  }
+
+  const PBool result = p_chart_lscm_solve(phandle, chart);
+
+  if (result && !(chart->flag & PCHART_HAS_PINS)) {
+    p_chart_rotate_minimum_area(chart);
+  }
+  else if (result && chart->u.lscm.single_pin) {
+    p_chart_rotate_fit_aabb(chart);
+    p_chart_lscm_transform_single_pin(chart);
+  }
+
+  if (!result || !(chart->flag & PCHART_HAS_PINS)) {
+    p_chart_lscm_end(chart);
   }
+
+  if (result) {
+    counts->changed++;
+  }
+  else {
+    counts->failed++;
+  }
+}
+
+static void p_chart_lscm_solve_reduce(const void *__restrict UNUSED(userdata),
+                                      void *__restrict chunk_join,
+                                      void *__restrict chunk)
+{
+  PLscmSolveCounts *join = chunk_join;
+  const PLscmSolveCounts *counts = chunk;
+  join->changed += counts->changed;
+  join->failed += counts->failed;
 }
 
 void GEO_uv_parametrizer_lscm_solve(ParamHandle *handle, int *count_changed, int *count_failed)
 {
   PHandle *phandle = (PHandle *)handle;
-  PChart *chart;
-  int i;
 
   param_assert(phandle->state == PHANDLE_STATE_LSCM);
 
-  for (i = 0; i < phandle->ncharts; i++) {
-    chart = phandle->charts[i];
-
-    if (chart->u.lscm.context) {
-      const PBool result = p_chart_lscm_solve(phandle, chart);
+  PLscmSolveCounts counts = {0, 0};
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 1;
+  settings.userdata_chunk = &counts;
+  settings.userdata_chunk_size = sizeof(counts);
+  settings.func_reduce = p_chart_lscm_solve_reduce;
+  BLI_task_parallel_range(0, phandle->ncharts, phandle, p_chart_lscm_solve_task, &settings);
 
-      if (result && !(chart->flag & PCHART_HAS_PINS)) {
-        p_chart_rotate_minimum_area(chart);
-      }
-      else if (result && chart->u.lscm.single_pin) {
-        p_chart_rotate_fit_aabb(chart);
-        p_chart_lscm_transform_single_pin(chart);
-      }
-
-      if (!result || !(chart->flag & PCHART_HAS_PINS)) {
-        p_chart_lscm_end(chart);
-      }
-
-      if (result) {
-        if (count_changed != NULL) {
-          *count_changed += 1;
-        }
-      }
-      else {
-        if (count_failed != NULL) {
-          *count_failed += 1;
-        }
-      }
-    }
+  if (count_changed != NULL) {
+    *count_changed += counts.changed;
+  }
+  if (count_failed != NULL) {
+    *count_failed += counts.failed;
   }
 }
 
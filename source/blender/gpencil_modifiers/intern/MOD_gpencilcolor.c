@@ -207,7 +207,8 @@ GpencilModifierTypeInfo modifierType_Gpencil_Color = {
     /* structName */ "ColorGpencilModifierData",
     /* structSize */ sizeof(ColorGpencilModifierData),
     /* type */ eGpencilModifierTypeType_Gpencil,
-    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode,
+    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode |
+        eGpencilModifierTypeFlag_SupportsThreadedDeform,
 
     /* copyData */ copyData,
 
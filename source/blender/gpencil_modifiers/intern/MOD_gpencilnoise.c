@@ -331,7 +331,8 @@ GpencilModifierTypeInfo modifierType_Gpencil_Noise = {
     /* structName */ "NoiseGpencilModifierData",
     /* structSize */ sizeof(NoiseGpencilModifierData),
     /* type */ eGpencilModifierTypeType_Gpencil,
-    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode,
+    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode |
+        eGpencilModifierTypeFlag_SupportsThreadedDeform,
 
     /* copyData */ copyData,
 
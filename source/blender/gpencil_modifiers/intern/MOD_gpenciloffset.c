@@ -226,7 +226,8 @@ GpencilModifierTypeInfo modifierType_Gpencil_Offset = {
     /* structName */ "OffsetGpencilModifierData",
     /* structSize */ sizeof(OffsetGpencilModifierData),
     /* type */ eGpencilModifierTypeType_Gpencil,
-    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode,
+    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode |
+        eGpencilModifierTypeFlag_SupportsThreadedDeform,
 
     /* copyData */ copyData,
 
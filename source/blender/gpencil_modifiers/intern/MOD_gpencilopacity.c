@@ -285,7 +285,8 @@ GpencilModifierTypeInfo modifierType_Gpencil_Opacity = {
     /* structName */ "OpacityGpencilModifierData",
     /* structSize */ sizeof(OpacityGpencilModifierData),
     /* type */ eGpencilModifierTypeType_Gpencil,
-    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode,
+    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode |
+        eGpencilModifierTypeFlag_SupportsThreadedDeform,
 
     /* copyData */ copyData,
 
@@ -207,7 +207,8 @@ GpencilModifierTypeInfo modifierType_Gpencil_Smooth = {
     /* structName */ "SmoothGpencilModifierData",
     /* structSize */ sizeof(SmoothGpencilModifierData),
     /* type */ eGpencilModifierTypeType_Gpencil,
-    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode,
+    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode |
+        eGpencilModifierTypeFlag_SupportsThreadedDeform,
 
     /* copyData */ copyData,
 
@@ -208,7 +208,8 @@ GpencilModifierTypeInfo modifierType_Gpencil_Thick = {
     /* structName */ "ThickGpencilModifierData",
     /* structSize */ sizeof(ThickGpencilModifierData),
     /* type */ eGpencilModifierTypeType_Gpencil,
-    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode,
+    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode |
+        eGpencilModifierTypeFlag_SupportsThreadedDeform,
 
     /* copyData */ copyData,
 
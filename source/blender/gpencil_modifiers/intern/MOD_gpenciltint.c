@@ -370,7 +370,8 @@ GpencilModifierTypeInfo modifierType_Gpencil_Tint = {
     /* structName */ "TintGpencilModifierData",
     /* structSize */ sizeof(TintGpencilModifierData),
     /* type */ eGpencilModifierTypeType_Gpencil,
-    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode,
+    /* flags */ eGpencilModifierTypeFlag_SupportsEditmode |
+        eGpencilModifierTypeFlag_SupportsThreadedDeform,
 
     /* copyData */ copyData,
 
@@ -80,6 +80,8 @@ void GLVertBuf::bind()
 {
   BLI_assert(GLContext::get() != nullptr);
 
+  /* An existing buffer already has its previous data store accounted for in the memory usage. */
+  const bool has_data_store = vbo_id_ != 0;
   if (vbo_id_ == 0) {
     glGenBuffers(1, &vbo_id_);
   }
@@ -87,13 +89,15 @@ void GLVertBuf::bind()
   glBindBuffer(GL_ARRAY_BUFFER, vbo_id_);
 
   if (flag & GPU_VERTBUF_DATA_DIRTY) {
-    vbo_size_ = this->size_used_get();
-    /* Orphan the vbo to avoid sync then upload data. */
-    glBufferData(GL_ARRAY_BUFFER, vbo_size_, nullptr, to_gl(usage_));
-    /* Do not transfer data from host to device when buffer is device only. */
-    if (usage_ != GPU_USAGE_DEVICE_ONLY) {
-      glBufferSubData(GL_ARRAY_BUFFER, 0, vbo_size_, data);
+    if (has_data_store) {
+      memory_usage -= vbo_size_;
     }
+    vbo_size_ = this->size_used_get();
+    /* Orphan the vbo and upload the new data in the same call, so the driver does not have to
+     * wait for draw calls still using the previous data store.
+     * Do not transfer data from host to device when buffer is device only. */
+    const void *host_data = (usage_ != GPU_USAGE_DEVICE_ONLY) ? data : nullptr;
+    glBufferData(GL_ARRAY_BUFFER, vbo_size_, host_data, to_gl(usage_));
     memory_usage += vbo_size_;
 
     if (usage_ == GPU_USAGE_STATIC) {
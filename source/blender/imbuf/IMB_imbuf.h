@@ -107,6 +107,17 @@ struct ImBuf *IMB_testiffname(const char *filepath, int flags);
  */
 struct ImBuf *IMB_loadiffname(const char *filepath, int flags, char colorspace[IM_MAX_SPACE]);
 
+/**
+ * Load an image for use as a thumbnail. Formats that support it are decoded at a reduced
+ * resolution, whose largest side is at least `max_thumb_size`. The size of the full image is
+ * stored in the `Thumb::Image::Width` and `Thumb::Image::Height` meta-data fields.
+ *
+ * \attention Defined in readimage.c
+ */
+struct ImBuf *IMB_thumb_load_image(const char *filepath,
+                                   size_t max_thumb_size,
+                                   char colorspace[IM_MAX_SPACE]);
+
 /**
  *
  * \attention Defined in allocimbuf.c
@@ -361,7 +361,10 @@ void *imb_alloc_pixels(
   }
 
   size_t size = (size_t)x * (size_t)y * (size_t)channels * typesize;
-  return MEM_callocN(size, name);
+  const eMEMCategory mem_category = MEM_category_push(MEM_CATEGORY_IMAGE);
+  void *pixels = MEM_callocN(size, name);
+  MEM_category_pop(mem_category);
+  return pixels;
 }
 
 bool imb_addrectfloatImBuf(ImBuf *ibuf)
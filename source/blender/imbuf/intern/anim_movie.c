@@ -827,26 +827,51 @@ static void ffmpeg_postprocess(struct anim *anim)
     }
   }
 
-  sws_scale(anim->img_convert_ctx,
-            (const uint8_t *const *)input->data,
-            input->linesize,
-            0,
-            anim->y,
-            anim->pFrameRGB->data,
-            anim->pFrameRGB->linesize);
-
-  /* Copy the valid bytes from the aligned buffer vertically flipped into ImBuf */
-  int aligned_stride = anim->pFrameRGB->linesize[0];
-  const uint8_t *const src[4] = {
-      anim->pFrameRGB->data[0] + (anim->y - 1) * aligned_stride, 0, 0, 0};
-  /* NOTE: Negative linesize is used to copy and flip image at once with function
-   * `av_image_copy_to_buffer`. This could cause issues in future and image may need to be flipped
-   * explicitly. */
-  const int src_linesize[4] = {-anim->pFrameRGB->linesize[0], 0, 0, 0};
-  int dst_size = av_image_get_buffer_size(
-      anim->pFrameRGB->format, anim->pFrameRGB->width, anim->pFrameRGB->height, 1);
-  av_image_copy_to_buffer(
-      (uint8_t *)ibuf->rect, dst_size, src, src_linesize, AV_PIX_FMT_RGBA, anim->x, anim->y, 1);
+  /* If the layout of the ImBuf matches the one of the decoded RGB frame (including any line
+   * padding done by FFmpeg for SIMD alignment), scale directly into the ImBuf, doing the vertical
+   * flip in the same step. Otherwise scale into the RGB frame and copy it flipped. */
+  const int ibuf_linesize = ibuf->x * 4;
+  const int rgb_linesize = anim->pFrameRGB->linesize[0];
+  bool scale_to_ibuf = (rgb_linesize == ibuf_linesize);
+  /* swscale on arm64 before FFmpeg 6.0 (libswscale major version 7) could not handle negative
+   * line sizes. */
+#  if (defined(__aarch64__) || defined(_M_ARM64)) && (LIBSWSCALE_VERSION_MAJOR < 7)
+  scale_to_ibuf = false;
+#  endif
+
+  if (scale_to_ibuf) {
+    uint8_t *dst[4] = {(uint8_t *)ibuf->rect + (anim->y - 1) * ibuf_linesize, 0, 0, 0};
+    const int dst_linesize[4] = {-ibuf_linesize, 0, 0, 0};
+    sws_scale(anim->img_convert_ctx,
+              (const uint8_t *const *)input->data,
+              input->linesize,
+              0,
+              anim->y,
+              dst,
+              dst_linesize);
+  }
+  else {
+    sws_scale(anim->img_convert_ctx,
+              (const uint8_t *const *)input->data,
+              input->linesize,
+              0,
+              anim->y,
+              anim->pFrameRGB->data,
+              anim->pFrameRGB->linesize);
+
+    /* Copy the valid bytes from the aligned buffer vertically flipped into ImBuf */
+    const uint8_t *const src[4] = {
+        anim->pFrameRGB->data[0] + (anim->y - 1) * rgb_linesize, 0, 0, 0};
+    /* NOTE: Negative linesize is used to copy and flip image at once with function
+     * `av_image_copy_to_buffer`. This could cause issues in future and image may need to be
+     * flipped explicitly. */
+    const int src_linesize[4] = {-rgb_linesize, 0, 0, 0};
+    int dst_size = av_image_get_buffer_size(
+        anim->pFrameRGB->format, anim->pFrameRGB->width, anim->pFrameRGB->height, 1);
+    av_image_copy_to_buffer(
+        (uint8_t *)ibuf->rect, dst_size, src, src_linesize, AV_PIX_FMT_RGBA, anim->x, anim->y, 1);
+  }
+
   if (filter_y) {
     IMB_filtery(ibuf);
   }
@@ -1535,21 +1535,48 @@ static void display_buffer_apply_get_linear_buffer(DisplayBufferThread *handle,
     const size_t i_last = ((size_t)width) * height;
     size_t i;
 
+    /* Byte buffers in sRGB or scene linear space are common, those are converted with a lookup
+     * table or a plain scale instead of going through an OCIO processor for every pixel. */
+    bool use_ocio_transform = !is_data && !is_data_display;
+    bool use_srgb_table = false;
+    if (use_ocio_transform) {
+      ColorSpace *colorspace = colormanage_colorspace_get_named(from_colorspace);
+      if (colorspace && IMB_colormanagement_space_is_srgb(colorspace)) {
+        use_ocio_transform = false;
+        use_srgb_table = true;
+      }
+      else if (colorspace && IMB_colormanagement_space_is_scene_linear(colorspace)) {
+        use_ocio_transform = false;
+      }
+    }
+
     /* first convert byte buffer to float, keep in image space */
     for (i = 0, fp = linear_buffer, cp = byte_buffer; i != i_last;
          i++, fp += channels, cp += channels) {
       if (channels == 3) {
-        rgb_uchar_to_float(fp, cp);
+        if (use_srgb_table) {
+          fp[0] = BLI_color_from_srgb_table[cp[0]];
+          fp[1] = BLI_color_from_srgb_table[cp[1]];
+          fp[2] = BLI_color_from_srgb_table[cp[2]];
+        }
+        else {
+          rgb_uchar_to_float(fp, cp);
+        }
       }
       else if (channels == 4) {
-        rgba_uchar_to_float(fp, cp);
+        if (use_srgb_table) {
+          srgb_to_linearrgb_uchar4(fp, cp);
+        }
+        else {
+          rgba_uchar_to_float(fp, cp);
+        }
       }
       else {
         BLI_assert_msg(0, "Buffers of 3 or 4 channels are only supported here");
       }
     }
 
-    if (!is_data && !is_data_display) {
+    if (use_ocio_transform) {
       /* convert float buffer to scene linear space */
       IMB_colormanagement_transform(
           linear_buffer, width, height, channels, from_colorspace, to_colorspace, false);
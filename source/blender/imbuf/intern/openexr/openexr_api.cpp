@@ -1271,6 +1271,11 @@ void IMB_exr_read_channels(void *handle)
       }
     }
 
+    /* Skip decoding parts that none of the requested channels are stored in. */
+    if (frameBuffer.begin() == frameBuffer.end()) {
+      continue;
+    }
+
     /* Read pixels. */
     try {
       in.setFrameBuffer(frameBuffer);
@@ -22,6 +22,7 @@
 #include "IMB_filetype.h"
 #include "IMB_imbuf.h"
 #include "IMB_imbuf_types.h"
+#include "IMB_metadata.h"
 #include "imbuf.h"
 
 #include "IMB_colormanagement.h"
@@ -234,6 +235,46 @@ ImBuf *IMB_loadiffname(const char *filepath, int flags, char colorspace[IM_MAX_S
   return ibuf;
 }
 
+ImBuf *IMB_thumb_load_image(const char *filepath,
+                            size_t max_thumb_size,
+                            char colorspace[IM_MAX_SPACE])
+{
+  const int flags = IB_rect | IB_metadata;
+  const ImFileType *type = IMB_file_type_from_ftype(IMB_ispic_type(filepath));
+  if (type == NULL || type->load_filepath_thumbnail == NULL) {
+    /* No reduced resolution loader for this format, load the full image. */
+    return IMB_loadiffname(filepath, flags, colorspace);
+  }
+
+  char effective_colorspace[IM_MAX_SPACE] = "";
+  if (colorspace) {
+    BLI_strncpy(effective_colorspace, colorspace, sizeof(effective_colorspace));
+  }
+
+  size_t width = 0;
+  size_t height = 0;
+  ImBuf *ibuf = type->load_filepath_thumbnail(
+      filepath, flags, max_thumb_size, effective_colorspace, &width, &height);
+  if (ibuf == NULL) {
+    return NULL;
+  }
+
+  imb_handle_alpha(ibuf, flags, colorspace, effective_colorspace);
+
+  /* Store the size of the full resolution image, the thumbnail may be smaller. */
+  if (width > 0 && height > 0) {
+    char str[16];
+    IMB_metadata_ensure(&ibuf->metadata);
+    BLI_snprintf(str, sizeof(str), "%zu", width);
+    IMB_metadata_set_field(ibuf->metadata, "Thumb::Image::Width", str);
+    BLI_snprintf(str, sizeof(str), "%zu", height);
+    IMB_metadata_set_field(ibuf->metadata, "Thumb::Image::Height", str);
+  }
+
+  BLI_strncpy(ibuf->name, filepath, sizeof(ibuf->name));
+  return ibuf;
+}
+
 ImBuf *IMB_testiffname(const char *filepath, int flags)
 {
   ImBuf *ibuf;
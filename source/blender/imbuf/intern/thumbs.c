@@ -368,7 +368,7 @@ static ImBuf *thumb_create_ex(const char *file_path,
         if (img == NULL) {
           switch (source) {
             case THB_SOURCE_IMAGE:
-              img = IMB_loadiffname(file_path, IB_rect | IB_metadata, NULL);
+              img = IMB_thumb_load_image(file_path, tsize, NULL);
               break;
             case THB_SOURCE_BLEND:
               img = IMB_thumb_load_blend(file_path, blen_group, blen_id);
@@ -385,8 +385,17 @@ static ImBuf *thumb_create_ex(const char *file_path,
           if (BLI_stat(file_path, &info) != -1) {
             BLI_snprintf(mtime, sizeof(mtime), "%ld", (long int)info.st_mtime);
           }
-          BLI_snprintf(cwidth, sizeof(cwidth), "%d", img->x);
-          BLI_snprintf(cheight, sizeof(cheight), "%d", img->y);
+          /* Images may have been loaded at a reduced resolution, use their original size. */
+          const bool has_size =
+              img->metadata &&
+              IMB_metadata_get_field(
+                  img->metadata, "Thumb::Image::Width", cwidth, sizeof(cwidth)) &&
+              IMB_metadata_get_field(
+                  img->metadata, "Thumb::Image::Height", cheight, sizeof(cheight));
+          if (!has_size) {
+            BLI_snprintf(cwidth, sizeof(cwidth), "%d", img->x);
+            BLI_snprintf(cheight, sizeof(cheight), "%d", img->y);
+          }
         }
       }
       else if (THB_SOURCE_MOVIE == source) {
@@ -23,6 +23,7 @@
 #include "BLI_index_range.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_geom.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.h"
 #include "BKE_main.h"
@@ -123,17 +124,19 @@ static void read_mverts_interp(MVert *mverts,
                                const P3fArraySamplePtr &ceil_positions,
                                const double weight)
 {
-  float tmp[3];
-  for (int i = 0; i < positions->size(); i++) {
-    MVert &mvert = mverts[i];
-    const Imath::V3f &floor_pos = (*positions)[i];
-    const Imath::V3f &ceil_pos = (*ceil_positions)[i];
+  threading::parallel_for(IndexRange(positions->size()), 4096, [&](const IndexRange range) {
+    float tmp[3];
+    for (const int64_t i : range) {
+      MVert &mvert = mverts[i];
+      const Imath::V3f &floor_pos = (*positions)[i];
+      const Imath::V3f &ceil_pos = (*ceil_positions)[i];
 
-    interp_v3_v3v3(tmp, floor_pos.getValue(), ceil_pos.getValue(), static_cast<float>(weight));
-    copy_zup_from_yup(mvert.co, tmp);
+      interp_v3_v3v3(tmp, floor_pos.getValue(), ceil_pos.getValue(), static_cast<float>(weight));
+      copy_zup_from_yup(mvert.co, tmp);
 
-    mvert.bweight = 0;
-  }
+      mvert.bweight = 0;
+    }
+  });
 }
 
 static void read_mverts(CDStreamConfig &config, const AbcMeshData &mesh_data)
@@ -153,20 +156,26 @@ static void read_mverts(CDStreamConfig &config, const AbcMeshData &mesh_data)
 
 void read_mverts(Mesh &mesh, const P3fArraySamplePtr positions, const N3fArraySamplePtr normals)
 {
-  for (int i = 0; i < positions->size(); i++) {
-    MVert &mvert = mesh.mvert[i];
-    Imath::V3f pos_in = (*positions)[i];
+  /* Converting positions is independent per vertex, which matters for the topology-stable case
+   * where only positions are read every frame. */
+  threading::parallel_for(IndexRange(positions->size()), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      MVert &mvert = mesh.mvert[i];
+      Imath::V3f pos_in = (*positions)[i];
 
-    copy_zup_from_yup(mvert.co, pos_in.getValue());
+      copy_zup_from_yup(mvert.co, pos_in.getValue());
 
-    mvert.bweight = 0;
-  }
+      mvert.bweight = 0;
+    }
+  });
   if (normals) {
     float(*vert_normals)[3] = BKE_mesh_vertex_normals_for_write(&mesh);
-    for (const int64_t i : IndexRange(normals->size())) {
-      Imath::V3f nor_in = (*normals)[i];
-      copy_zup_from_yup(vert_normals[i], nor_in.getValue());
-    }
+    threading::parallel_for(IndexRange(normals->size()), 4096, [&](const IndexRange range) {
+      for (const int64_t i : range) {
+        Imath::V3f nor_in = (*normals)[i];
+        copy_zup_from_yup(vert_normals[i], nor_in.getValue());
+      }
+    });
     BKE_mesh_vertex_normals_clear_dirty(&mesh);
   }
 }
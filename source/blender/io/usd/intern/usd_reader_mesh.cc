@@ -17,6 +17,7 @@
 #include "BLI_math_vec_types.hh"
 #include "BLI_span.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 
 #include "DNA_customdata_types.h"
 #include "DNA_material_types.h"
@@ -649,19 +650,29 @@ void USDMeshReader::read_mesh_sample(ImportSettings *settings,
    * regardless of the value of the read_flag, to avoid a crash downstream
    * in code that expect this data to be there. */
 
-  if (new_mesh || (settings->read_flag & MOD_MESHSEQ_READ_VERT) != 0) {
-    for (int i = 0; i < positions_.size(); i++) {
-      MVert &mvert = mesh->mvert[i];
-      mvert.co[0] = positions_[i][0];
-      mvert.co[1] = positions_[i][1];
-      mvert.co[2] = positions_[i][2];
-    }
+  const bool read_verts = new_mesh || (settings->read_flag & MOD_MESHSEQ_READ_VERT) != 0;
+  const bool read_polys = new_mesh || (settings->read_flag & MOD_MESHSEQ_READ_POLY) != 0;
+
+  if (read_verts) {
+    threading::parallel_for(IndexRange(positions_.size()), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        MVert &mvert = mesh->mvert[i];
+        mvert.co[0] = positions_[i][0];
+        mvert.co[1] = positions_[i][1];
+        mvert.co[2] = positions_[i][2];
+      }
+    });
 
     read_vertex_creases(mesh, motionSampleTime);
   }
 
-  if (new_mesh || (settings->read_flag & MOD_MESHSEQ_READ_POLY) != 0) {
+  if (read_polys) {
     read_mpolys(mesh);
+  }
+
+  /* Normals can be animated even when the topology is not, so they are read whenever the
+   * positions are. */
+  if (read_polys || read_verts) {
     if (normal_interpolation_ == pxr::UsdGeomTokens->faceVarying) {
       process_normals_face_varying(mesh);
     }
@@ -833,9 +844,6 @@ Mesh *USDMeshReader::read_mesh(Mesh *existing_mesh,
   Mesh *active_mesh = existing_mesh;
   bool new_mesh = false;
 
-  /* TODO(makowalski): implement the optimization of only updating the mesh points when
-   * the topology is consistent, as in the Alembic importer. */
-
   ImportSettings settings;
   settings.read_flag |= read_flag;
 
@@ -849,6 +857,14 @@ Mesh *USDMeshReader::read_mesh(Mesh *existing_mesh,
       active_mesh->mloopuv = static_cast<MLoopUV *>(cd_ptr);
     }
   }
+  else if (!is_initial_load_ &&
+           !mesh_prim_.GetFaceVertexIndicesAttr().ValueMightBeTimeVarying() &&
+           !mesh_prim_.GetFaceVertexCountsAttr().ValueMightBeTimeVarying()) {
+    /* The polygons and loops of the existing mesh are still valid when the face topology is not
+     * animated, so only update the positions and the time-varying attributes, as in the Alembic
+     * importer. */
+    settings.read_flag &= ~MOD_MESHSEQ_READ_POLY;
+  }
 
   read_mesh_sample(&settings, active_mesh, motionSampleTime, new_mesh || is_initial_load_);
 
@@ -7,8 +7,10 @@
 #include <pxr/usd/usdShade/material.h>
 #include <pxr/usd/usdShade/materialBindingAPI.h>
 
+#include "BLI_array.hh"
 #include "BLI_assert.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.h"
 #include "BKE_customdata.h"
@@ -121,11 +123,14 @@ void USDGenericMeshWriter::write_uv_maps(const Mesh *mesh, pxr::UsdGeomMesh usd_
     pxr::UsdGeomPrimvar uv_coords_primvar = usd_mesh.CreatePrimvar(
         primvar_name, pxr::SdfValueTypeNames->TexCoord2fArray, pxr::UsdGeomTokens->faceVarying);
 
-    MLoopUV *mloopuv = static_cast<MLoopUV *>(layer->data);
-    pxr::VtArray<pxr::GfVec2f> uv_coords;
-    for (int loop_idx = 0; loop_idx < mesh->totloop; loop_idx++) {
-      uv_coords.push_back(pxr::GfVec2f(mloopuv[loop_idx].uv));
-    }
+    const MLoopUV *mloopuv = static_cast<const MLoopUV *>(layer->data);
+    pxr::VtArray<pxr::GfVec2f> uv_coords(mesh->totloop);
+    pxr::GfVec2f *uv_coords_data = uv_coords.data();
+    threading::parallel_for(IndexRange(mesh->totloop), 4096, [&](const IndexRange range) {
+      for (const int loop_idx : range) {
+        uv_coords_data[loop_idx] = pxr::GfVec2f(mloopuv[loop_idx].uv);
+      }
+    });
 
     if (!uv_coords_primvar.HasValue()) {
       uv_coords_primvar.Set(uv_coords, pxr::UsdTimeCode::Default());
@@ -243,12 +248,17 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
 
 static void get_vertices(const Mesh *mesh, USDMeshData &usd_mesh_data)
 {
-  usd_mesh_data.points.reserve(mesh->totvert);
+  usd_mesh_data.points.resize(mesh->totvert);
 
+  /* Only the extraction of the data is done in parallel, authoring the USD stage is not
+   * thread-safe. Get the pointer once, as the non-const accessor may detach a shared array. */
   const MVert *verts = mesh->mvert;
-  for (int i = 0; i < mesh->totvert; ++i) {
-    usd_mesh_data.points.push_back(pxr::GfVec3f(verts[i].co));
-  }
+  pxr::GfVec3f *points = usd_mesh_data.points.data();
+  threading::parallel_for(IndexRange(mesh->totvert), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      points[i] = pxr::GfVec3f(verts[i].co);
+    }
+  });
 }
 
 static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
@@ -393,37 +403,54 @@ void USDGenericMeshWriter::write_normals(const Mesh *mesh, pxr::UsdGeomMesh usd_
   pxr::UsdTimeCode timecode = get_export_time_code();
   const float(*lnors)[3] = static_cast<float(*)[3]>(CustomData_get_layer(&mesh->ldata, CD_NORMAL));
 
-  pxr::VtVec3fArray loop_normals;
-  loop_normals.reserve(mesh->totloop);
+  pxr::VtVec3fArray loop_normals(mesh->totloop);
+  pxr::GfVec3f *loop_normals_data = loop_normals.data();
 
   if (lnors != nullptr) {
     /* Export custom loop normals. */
-    for (int loop_idx = 0, totloop = mesh->totloop; loop_idx < totloop; ++loop_idx) {
-      loop_normals.push_back(pxr::GfVec3f(lnors[loop_idx]));
-    }
+    threading::parallel_for(IndexRange(mesh->totloop), 4096, [&](const IndexRange range) {
+      for (const int loop_idx : range) {
+        loop_normals_data[loop_idx] = pxr::GfVec3f(lnors[loop_idx]);
+      }
+    });
   }
   else {
     /* Compute the loop normals based on the 'smooth' flag. */
     const float(*vert_normals)[3] = BKE_mesh_vertex_normals_ensure(mesh);
     const float(*face_normals)[3] = BKE_mesh_poly_normals_ensure(mesh);
-    MPoly *mpoly = mesh->mpoly;
-    for (int poly_idx = 0, totpoly = mesh->totpoly; poly_idx < totpoly; ++poly_idx, ++mpoly) {
-      MLoop *mloop = mesh->mloop + mpoly->loopstart;
-
-      if ((mpoly->flag & ME_SMOOTH) == 0) {
-        /* Flat shaded, use common normal for all verts. */
-        pxr::GfVec3f pxr_normal(face_normals[poly_idx]);
-        for (int loop_idx = 0; loop_idx < mpoly->totloop; ++loop_idx) {
-          loop_normals.push_back(pxr_normal);
+    const MPoly *mpolys = mesh->mpoly;
+    const MLoop *mloops = mesh->mloop;
+
+    /* Face-varying values follow the polygon order of the exported face indices, which is not
+     * necessarily the order of the loops in the mesh. */
+    Array<int> face_varying_offsets(mesh->totpoly);
+    int face_varying_offset = 0;
+    for (const int poly_idx : IndexRange(mesh->totpoly)) {
+      face_varying_offsets[poly_idx] = face_varying_offset;
+      face_varying_offset += mpolys[poly_idx].totloop;
+    }
+
+    threading::parallel_for(IndexRange(mesh->totpoly), 1024, [&](const IndexRange range) {
+      for (const int poly_idx : range) {
+        const MPoly &mpoly = mpolys[poly_idx];
+        pxr::GfVec3f *poly_normals = loop_normals_data + face_varying_offsets[poly_idx];
+
+        if ((mpoly.flag & ME_SMOOTH) == 0) {
+          /* Flat shaded, use common normal for all verts. */
+          const pxr::GfVec3f pxr_normal(face_normals[poly_idx]);
+          for (const int i : IndexRange(mpoly.totloop)) {
+            poly_normals[i] = pxr_normal;
+          }
         }
-      }
-      else {
-        /* Smooth shaded, use individual vert normals. */
-        for (int loop_idx = 0; loop_idx < mpoly->totloop; ++loop_idx, ++mloop) {
-          loop_normals.push_back(pxr::GfVec3f(vert_normals[mloop->v]));
+        else {
+          /* Smooth shaded, use individual vert normals. */
+          const MLoop *poly_mloops = &mloops[mpoly.loopstart];
+          for (const int i : IndexRange(mpoly.totloop)) {
+            poly_normals[i] = pxr::GfVec3f(vert_normals[poly_mloops[i].v]);
+          }
         }
       }
-    }
+    });
   }
 
   pxr::UsdAttribute attr_normals = usd_mesh.CreateNormalsAttr(pxr::VtValue(), true);
@@ -448,12 +475,13 @@ void USDGenericMeshWriter::write_surface_velocity(const Mesh *mesh, pxr::UsdGeom
   const float(*velocities)[3] = reinterpret_cast<float(*)[3]>(velocity_layer->data);
 
   /* Export per-vertex velocity vectors. */
-  pxr::VtVec3fArray usd_velocities;
-  usd_velocities.reserve(mesh->totvert);
-
-  for (int vertex_idx = 0, totvert = mesh->totvert; vertex_idx < totvert; ++vertex_idx) {
-    usd_velocities.push_back(pxr::GfVec3f(velocities[vertex_idx]));
-  }
+  pxr::VtVec3fArray usd_velocities(mesh->totvert);
+  pxr::GfVec3f *usd_velocities_data = usd_velocities.data();
+  threading::parallel_for(IndexRange(mesh->totvert), 4096, [&](const IndexRange range) {
+    for (const int vertex_idx : range) {
+      usd_velocities_data[vertex_idx] = pxr::GfVec3f(velocities[vertex_idx]);
+    }
+  });
 
   pxr::UsdTimeCode timecode = get_export_time_code();
   usd_mesh.CreateVelocitiesAttr().Set(usd_velocities, timecode);
@@ -1,5 +1,8 @@
 /* SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <cerrno>
+#include <climits>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <sstream>
@@ -100,20 +103,55 @@ void split_by_char(StringRef in_string, const char delimiter, Vector<StringRef>
   }
 }
 
+/**
+ * Numbers in OBJ files are short, so they are copied into a null-terminated stack buffer for
+ * the C conversion functions. This avoids allocating a `std::string` (and handling exceptions)
+ * for every number, which dominates the parsing time of large files. Longer strings use a
+ * heap allocated copy.
+ */
+class NullTerminatedString {
+ private:
+  static constexpr int64_t inline_buffer_size = 64;
+  char inline_buffer_[inline_buffer_size];
+  std::string heap_buffer_;
+  const char *c_str_;
+
+ public:
+  NullTerminatedString(StringRef src)
+  {
+    if (src.size() < inline_buffer_size) {
+      src.unsafe_copy(inline_buffer_);
+      c_str_ = inline_buffer_;
+    }
+    else {
+      heap_buffer_ = src;
+      c_str_ = heap_buffer_.c_str();
+    }
+  }
+
+  const char *c_str() const
+  {
+    return c_str_;
+  }
+};
+
 void copy_string_to_float(StringRef src, const float fallback_value, float &r_dst)
 {
-  try {
-    r_dst = std::stof(string(src));
-  }
-  catch (const std::invalid_argument &inv_arg) {
-    std::cerr << "Bad conversion to float:'" << inv_arg.what() << "':'" << src << "'" << std::endl;
+  const NullTerminatedString src_str{src};
+  char *end;
+  errno = 0;
+  const float value = std::strtof(src_str.c_str(), &end);
+  if (end == src_str.c_str()) {
+    std::cerr << "Bad conversion to float:'" << src << "'" << std::endl;
     r_dst = fallback_value;
   }
-  catch (const std::out_of_range &out_of_range) {
-    std::cerr << "Out of range for float:'" << out_of_range.what() << ":'" << src << "'"
-              << std::endl;
+  else if (errno == ERANGE) {
+    std::cerr << "Out of range for float:'" << src << "'" << std::endl;
     r_dst = fallback_value;
   }
+  else {
+    r_dst = value;
+  }
 }
 
 void copy_string_to_float(Span<StringRef> src,
@@ -132,18 +170,21 @@ void copy_string_to_float(Span<StringRef> src,
 
 void copy_string_to_int(StringRef src, const int fallback_value, int &r_dst)
 {
-  try {
-    r_dst = std::stoi(string(src));
-  }
-  catch (const std::invalid_argument &inv_arg) {
-    std::cerr << "Bad conversion to int:'" << inv_arg.what() << "':'" << src << "'" << std::endl;
+  const NullTerminatedString src_str{src};
+  char *end;
+  errno = 0;
+  const long value = std::strtol(src_str.c_str(), &end, 10);
+  if (end == src_str.c_str()) {
+    std::cerr << "Bad conversion to int:'" << src << "'" << std::endl;
     r_dst = fallback_value;
   }
-  catch (const std::out_of_range &out_of_range) {
-    std::cerr << "Out of range for int:'" << out_of_range.what() << ":'" << src << "'"
-              << std::endl;
+  else if (errno == ERANGE || value < INT_MIN || value > INT_MAX) {
+    std::cerr << "Out of range for int:'" << src << "'" << std::endl;
     r_dst = fallback_value;
   }
+  else {
+    r_dst = int(value);
+  }
 }
 
 void copy_string_to_int(Span<StringRef> src, const int fallback_value, MutableSpan<int> r_dst)
@@ -16,6 +16,7 @@ extern "C" {
 #endif
 
 struct AnonymousAttributeID;
+struct CustomDataLayerSharing;
 
 /** Descriptor and storage for a custom data layer. */
 typedef struct CustomDataLayer {
@@ -46,6 +47,12 @@ typedef struct CustomDataLayer {
    * automatically.
    */
   const struct AnonymousAttributeID *anonymous_id;
+  /**
+   * Run-time user count of #data when it is implicitly shared with layers of other custom data,
+   * see #CD_SHARE. Shared layers also have #CD_FLAG_NOFREE set, and have to be duplicated with
+   * #CustomData_duplicate_referenced_layer before they are modified.
+   */
+  const struct CustomDataLayerSharing *sharing_info;
 } CustomDataLayer;
 
 #define MAX_CUSTOMDATA_LAYER_NAME 64
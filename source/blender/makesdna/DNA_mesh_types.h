@@ -135,10 +135,26 @@ typedef struct Mesh_Runtime {
    */
   char vert_normals_dirty;
   char poly_normals_dirty;
+  /**
+   * The positions changed since #looptris was calculated. The triangulation of quads and n-gons
+   * has to be recalculated, but triangles only depend on topology and stay valid.
+   */
+  char looptris_positions_dirty;
+  char _pad[7];
   float (*vert_normals)[3];
   float (*poly_normals)[3];
 
-  void *_pad2;
+  /**
+   * Lazily computed maps between topology elements, freed together with other geometry caches.
+   * Defined in `mesh_runtime.cc`, see #BKE_mesh_runtime_vert_poly_map_ensure.
+   */
+  struct MeshTopologyMaps *topology_maps;
+
+  /**
+   * Shares #looptris with copies of the mesh, null when the array is owned by this mesh alone.
+   * Defined in `mesh_runtime.cc`.
+   */
+  const struct MeshLoopTrisSharing *looptris_sharing_info;
 } Mesh_Runtime;
 
 typedef struct Mesh {
@@ -122,6 +122,14 @@ typedef struct Strip {
 
 typedef struct SequenceRuntime {
   SessionUUID session_uuid;
+
+  /**
+   * Sound entry (#Sequence.scene_sound) that the static volume, pitch and pan below were last
+   * sent to. Only used to skip sending unchanged values, never dereferenced.
+   */
+  void *sound_entry;
+  float sound_volume, sound_pitch, sound_pan;
+  char _pad[4];
 } SequenceRuntime;
 
 /**
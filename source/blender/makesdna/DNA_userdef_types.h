@@ -651,7 +651,7 @@ typedef struct UserDef_Experimental {
   char use_named_attribute_nodes;
   char enable_eevee_next;
   char use_sculpt_texture_paint;
-  char _pad0[1];
+  char use_undo_skip_unchanged_ids;
   /** `makesdna` does not allow empty structs. */
 } UserDef_Experimental;
 
@@ -711,6 +711,10 @@ typedef struct UserDef {
 
   short versions;
   short dbl_click_time;
+  /** Number of threads compressing saved files, zero for the default. */
+  short file_compress_threads;
+  /** Size in MiB of every compressed frame of saved files, zero for the default. */
+  short file_compress_frame_size;
 
   char _pad0[3];
   char mini_axis_type;
@@ -719,7 +723,7 @@ typedef struct UserDef {
   /** #eUserpref_UI_Flag2. */
   char uiflag2;
   char gpu_flag;
-  char _pad8[6];
+  char _pad8[2];
   /* Experimental flag for app-templates to make changes to behavior
    * which are outside the scope of typical preferences. */
   char app_flag;
@@ -4302,6 +4302,27 @@ static int rna_property_array_length_all_dimensions(PointerRNA *ptr, PropertyRNA
   return size;
 }
 
+/**
+ * Whether every value of raw type \a from is exactly representable in raw type \a to,
+ * so it can be converted without clamping or rounding.
+ */
+static bool rna_raw_type_is_lossless_conversion(RawPropertyType from, RawPropertyType to)
+{
+  switch (from) {
+    case PROP_RAW_BOOLEAN:
+      return to != PROP_RAW_UNSET;
+    case PROP_RAW_CHAR:
+      return ELEM(to, PROP_RAW_SHORT, PROP_RAW_INT, PROP_RAW_FLOAT, PROP_RAW_DOUBLE);
+    case PROP_RAW_SHORT:
+      return ELEM(to, PROP_RAW_INT, PROP_RAW_FLOAT, PROP_RAW_DOUBLE);
+    case PROP_RAW_INT:
+    case PROP_RAW_FLOAT:
+      return to == PROP_RAW_DOUBLE;
+    default:
+      return false;
+  }
+}
+
 static int rna_raw_access(ReportList *reports,
                           PointerRNA *ptr,
                           PropertyRNA *prop,
@@ -4369,6 +4390,17 @@ static int rna_raw_access(ReportList *reports,
 
         size = RNA_raw_type_sizeof(out.type) * arraylen;
 
+        /* Tightly packed items (e.g. attribute values) can be copied all at once. */
+        if (out.stride == size) {
+          if (set) {
+            memcpy(outp, inp, (size_t)size * out.len);
+          }
+          else {
+            memcpy(inp, outp, (size_t)size * out.len);
+          }
+          return 1;
+        }
+
         for (a = 0; a < out.len; a++) {
           if (set) {
             memcpy(outp, inp, size);
@@ -4384,8 +4416,32 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Non-matching raw types, convert every value but still avoid the per item RNA access.
+       * Only widening conversions are done here: narrowing ones would have to be clamped to the
+       * hard range of the property, and enum values have to be validated. Those use the per item
+       * access below. */
+      if (itemtype != PROP_ENUM && rna_raw_type_is_lossless_conversion(set ? in.type : out.type,
+                                                                        set ? out.type : in.type)) {
+        RawArray out_item = out;
+        int a, j, in_index = 0;
+
+        for (a = 0; a < out.len; a++) {
+          out_item.array = (char *)out.array + (size_t)a * out.stride;
+          for (j = 0; j < arraylen; j++, in_index++) {
+            double value;
+            if (set) {
+              RAW_GET(double, value, in, in_index);
+              RAW_SET(double, out_item, j, value);
+            }
+            else {
+              RAW_GET(double, value, out_item, j);
+              RAW_SET(double, in, in_index, value);
+            }
+          }
+        }
+
+        return 1;
+      }
     }
   }
 
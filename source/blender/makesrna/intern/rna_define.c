@@ -781,6 +781,11 @@ void RNA_struct_free(BlenderRNA *brna, StructRNA *srna)
   PropertyRNA *prop, *nextprop;
   PropertyRNA *parm, *nextparm;
 
+  if (srna->cont.prophash) {
+    BLI_ghash_free(srna->cont.prophash, NULL, NULL);
+    srna->cont.prophash = NULL;
+  }
+
 #  if 0
   if (srna->flag & STRUCT_RUNTIME) {
     if (RNA_struct_py_type_get(srna)) {
@@ -1022,6 +1027,18 @@ StructRNA *RNA_def_struct_ptr(BlenderRNA *brna, const char *identifier, StructRN
     }
   }
 
+#ifdef RNA_RUNTIME
+  /* Structs defined at runtime (e.g. property groups and operators from Python) can have many
+   * properties which are looked up by name on every attribute access, hash them like the
+   * builtin structs in #RNA_init. Properties added later are inserted as they are defined. */
+  srna->cont.prophash = BLI_ghash_str_new("RNA_def_struct_ptr gh");
+  LISTBASE_FOREACH (PropertyRNA *, prop_iter, &srna->cont.properties) {
+    if (!(prop_iter->flag_internal & PROP_INTERN_BUILTIN)) {
+      BLI_ghash_insert(srna->cont.prophash, (void *)prop_iter->identifier, prop_iter);
+    }
+  }
+#endif
+
   return srna;
 }
 
@@ -1463,7 +1480,9 @@ PropertyRNA *RNA_def_property(StructOrFunctionRNA *cont_,
     prop->flag_internal |= PROP_INTERN_RUNTIME;
 #ifdef RNA_RUNTIME
     if (cont->prophash) {
-      BLI_ghash_insert(cont->prophash, (void *)prop->identifier, prop);
+      /* Replace a property with the same identifier, which is freed after the new one has been
+       * defined, see #RNA_def_property_free_identifier_deferred_finish. */
+      BLI_ghash_reinsert(cont->prophash, (void *)prop->identifier, prop, NULL, NULL);
     }
 #endif
   }
@@ -4693,7 +4712,8 @@ static void rna_def_property_free(StructOrFunctionRNA *cont_, PropertyRNA *prop)
   ContainerRNA *cont = cont_;
 
   if (prop->flag_internal & PROP_INTERN_RUNTIME) {
-    if (cont->prophash) {
+    /* Don't remove a property which replaced this one by using the same identifier. */
+    if (cont->prophash && (BLI_ghash_lookup(cont->prophash, prop->identifier) == prop)) {
       BLI_ghash_remove(cont->prophash, prop->identifier, NULL, NULL);
     }
 
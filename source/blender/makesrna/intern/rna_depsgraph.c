@@ -257,6 +257,21 @@ static void rna_Depsgraph_debug_stats(Depsgraph *depsgraph, char *result)
                outer);
 }
 
+static void rna_Depsgraph_debug_profile(Depsgraph *depsgraph, int max_ids, char *result)
+{
+  DEG_debug_profile_report(depsgraph, result, STATS_MAX_SIZE, max_ids);
+}
+
+static float rna_Depsgraph_debug_profile_id_time(Depsgraph *depsgraph, ID *id)
+{
+  return (float)DEG_debug_profile_id_time(depsgraph, id);
+}
+
+static void rna_Depsgraph_debug_profile_reset(Depsgraph *depsgraph)
+{
+  DEG_debug_profile_reset(depsgraph);
+}
+
 static void rna_Depsgraph_update(Depsgraph *depsgraph, Main *bmain, ReportList *reports)
 {
   if (DEG_is_evaluating(depsgraph)) {
@@ -662,6 +677,33 @@ static void rna_def_depsgraph(BlenderRNA *brna)
   RNA_def_parameter_flags(parm, PROP_THICK_WRAP, 0); /* needed for string return value */
   RNA_def_function_output(func, parm);
 
+  func = RNA_def_function(srna, "debug_profile", "rna_Depsgraph_debug_profile");
+  RNA_def_function_ui_description(
+      func, "Report timing of evaluations gathered since the profile was last reset");
+  RNA_def_int(func,
+              "max_ids",
+              10,
+              0,
+              INT_MAX,
+              "Max IDs",
+              "Maximum number of data-blocks to list, most expensive first",
+              0,
+              100);
+  parm = RNA_def_string(func, "result", NULL, STATS_MAX_SIZE, "result", "");
+  RNA_def_parameter_flags(parm, PROP_THICK_WRAP, 0); /* needed for string return value */
+  RNA_def_function_output(func, parm);
+
+  func = RNA_def_function(srna, "debug_profile_id_time", "rna_Depsgraph_debug_profile_id_time");
+  RNA_def_function_ui_description(
+      func, "Total time in seconds spent on evaluating the data-block since the profile reset");
+  parm = RNA_def_pointer(func, "id", "ID", "", "Original data-block");
+  RNA_def_parameter_flags(parm, PROP_NEVER_NULL, PARM_REQUIRED);
+  parm = RNA_def_float(func, "time", 0.0f, 0.0f, FLT_MAX, "Time", "", 0.0f, FLT_MAX);
+  RNA_def_function_return(func, parm);
+
+  func = RNA_def_function(srna, "debug_profile_reset", "rna_Depsgraph_debug_profile_reset");
+  RNA_def_function_ui_description(func, "Clear timing gathered by the evaluation profile");
+
   /* Updates. */
 
   func = RNA_def_function(srna, "update", "rna_Depsgraph_update");
@@ -46,6 +46,9 @@
 
 #include "MOD_nodes.h"
 
+/* Size of the string returned by the nodes modifier profile report. */
+#define NODES_PROFILE_MAX_SIZE 16384
+
 const EnumPropertyItem rna_enum_object_modifier_type_items[] = {
     {0, "", 0, N_("Modify"), ""},
     {eModifierType_DataTransfer,
@@ -1673,6 +1676,11 @@ static IDProperty **rna_NodesModifier_properties(PointerRNA *ptr)
   NodesModifierSettings *settings = &nmd->settings;
   return &settings->properties;
 }
+
+static void rna_NodesModifier_debug_profile(NodesModifierData *nmd, int max_nodes, char *result)
+{
+  MOD_nodes_profile_report(nmd, result, NODES_PROFILE_MAX_SIZE, max_nodes);
+}
 #else
 
 static void rna_def_property_subdivision_common(StructRNA *srna)
@@ -6982,6 +6990,8 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
 {
   StructRNA *srna;
   PropertyRNA *prop;
+  FunctionRNA *func;
+  PropertyRNA *parm;
 
   srna = RNA_def_struct(brna, "NodesModifier", "Modifier");
   RNA_def_struct_ui_text(srna, "Nodes Modifier", "");
@@ -6998,6 +7008,23 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
   RNA_def_property_update(prop, 0, "rna_NodesModifier_node_group_update");
 
   RNA_define_lib_overridable(false);
+
+  func = RNA_def_function(srna, "debug_profile", "rna_NodesModifier_debug_profile");
+  RNA_def_function_ui_description(
+      func, "Report execution time and output size of the nodes in the last evaluation");
+  RNA_def_int(func,
+              "max_nodes",
+              10,
+              0,
+              INT_MAX,
+              "Max Nodes",
+              "Maximum number of nodes to list, slowest first",
+              0,
+              100);
+  /* No way to return dynamic string type. */
+  parm = RNA_def_string(func, "result", NULL, NODES_PROFILE_MAX_SIZE, "result", "");
+  RNA_def_parameter_flags(parm, PROP_THICK_WRAP, 0); /* needed for string return value */
+  RNA_def_function_output(func, parm);
 }
 
 static void rna_def_modifier_mesh_to_volume(BlenderRNA *brna)
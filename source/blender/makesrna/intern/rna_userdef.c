@@ -16,6 +16,7 @@
 
 #include "BLI_math_base.h"
 #include "BLI_math_rotation.h"
+#include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -6196,6 +6197,22 @@ static void rna_def_userdef_filepaths(BlenderRNA *brna)
   RNA_def_property_ui_text(
       prop, "Compress File", "Enable file compression when saving .blend files");
 
+  prop = RNA_def_property(srna, "file_compression_threads", PROP_INT, PROP_NONE);
+  RNA_def_property_int_sdna(prop, NULL, "file_compress_threads");
+  RNA_def_property_range(prop, 0, BLENDER_MAX_THREADS);
+  RNA_def_property_ui_text(prop,
+                           "Compression Threads",
+                           "Number of threads compressing .blend files when saving "
+                           "(0 uses all but one of the system's threads)");
+
+  prop = RNA_def_property(srna, "file_compression_frame_size", PROP_INT, PROP_NONE);
+  RNA_def_property_int_sdna(prop, NULL, "file_compress_frame_size");
+  RNA_def_property_range(prop, 0, 256);
+  RNA_def_property_ui_text(prop,
+                           "Compression Frame Size",
+                           "Size in MiB of the independently compressed parts of .blend files, "
+                           "larger parts compress slightly better (0 uses the default of 2 MiB)");
+
   prop = RNA_def_property(srna, "use_load_ui", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_negative_sdna(prop, NULL, "flag", USER_FILENOUI);
   RNA_def_property_ui_text(prop, "Load UI", "Load user interface setup when loading .blend files");
@@ -6443,6 +6460,14 @@ static void rna_def_userdef_experimental(BlenderRNA *brna)
   prop = RNA_def_property(srna, "enable_eevee_next", PROP_BOOLEAN, PROP_NONE);
   RNA_def_property_boolean_sdna(prop, NULL, "enable_eevee_next", 1);
   RNA_def_property_ui_text(prop, "EEVEE Next", "Enable the new EEVEE codebase, requires restart");
+
+  prop = RNA_def_property(srna, "use_undo_skip_unchanged_ids", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, NULL, "use_undo_skip_unchanged_ids", 1);
+  RNA_def_property_ui_text(prop,
+                           "Undo Skip Unchanged Data",
+                           "Re-use the previous undo step for data-blocks that were not tagged "
+                           "for an update, instead of storing them again (faster undo pushes, "
+                           "but changes that do not tag data-blocks may not be undone)");
 }
 
 static void rna_def_userdef_addon_collection(BlenderRNA *brna, PropertyRNA *cprop)
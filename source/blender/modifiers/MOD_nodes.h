@@ -2,6 +2,8 @@
 
 #pragma once
 
+#include <stddef.h>
+
 struct Main;
 struct NodesModifierData;
 struct Object;
@@ -17,6 +19,16 @@ extern "C" {
  */
 void MOD_nodes_update_interface(struct Object *object, struct NodesModifierData *nmd);
 
+/**
+ * Write the execution time and output size of the nodes logged during the last evaluation of the
+ * modifier into \a str, listing at most \a max_nodes nodes, slowest first. Logs are only kept
+ * for evaluations in the active dependency graph.
+ */
+void MOD_nodes_profile_report(const struct NodesModifierData *nmd,
+                              char *str,
+                              size_t str_maxncpy,
+                              int max_nodes);
+
 #ifdef __cplusplus
 }
 #endif
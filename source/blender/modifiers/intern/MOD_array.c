@@ -12,6 +12,7 @@
 #include "BLI_utildefines.h"
 
 #include "BLI_math.h"
+#include "BLI_task.h"
 
 #include "BLT_translation.h"
 
@@ -350,6 +351,94 @@ static void mesh_merge_transform(Mesh *result,
   }
 }
 
+typedef struct ArrayCopyData {
+  const Mesh *mesh;
+  Mesh *result;
+  /** Cumulative offset of every copy. */
+  const float (*offsets)[4][4];
+  const float (*src_vert_normals)[3];
+  float (*dst_vert_normals)[3];
+  const float *uv_offset;
+} ArrayCopyData;
+
+/**
+ * Fill in copy \a c of the mesh. Every copy writes to its own range of the result,
+ * so all copies can be built in parallel.
+ */
+static void array_copy_chunk(void *__restrict userdata,
+                             const int c,
+                             const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const ArrayCopyData *data = userdata;
+  const Mesh *mesh = data->mesh;
+  Mesh *result = data->result;
+  const int chunk_nverts = mesh->totvert;
+  const int chunk_nedges = mesh->totedge;
+  const int chunk_nloops = mesh->totloop;
+  const int chunk_npolys = mesh->totpoly;
+  const float(*current_offset)[4] = data->offsets[c];
+  int i;
+
+  /* copy customdata to new geometry */
+  CustomData_copy_data(&mesh->vdata, &result->vdata, 0, c * chunk_nverts, chunk_nverts);
+  CustomData_copy_data(&mesh->edata, &result->edata, 0, c * chunk_nedges, chunk_nedges);
+  CustomData_copy_data(&mesh->ldata, &result->ldata, 0, c * chunk_nloops, chunk_nloops);
+  CustomData_copy_data(&mesh->pdata, &result->pdata, 0, c * chunk_npolys, chunk_npolys);
+
+  const int vert_offset = c * chunk_nverts;
+
+  /* apply offset to all new verts */
+  MVert *result_dm_verts = result->mvert;
+  for (i = 0; i < chunk_nverts; i++) {
+    const int i_dst = vert_offset + i;
+    mul_m4_v3(current_offset, result_dm_verts[i_dst].co);
+
+    /* We have to correct normals too, if we do not tag them as dirty! */
+    if (data->dst_vert_normals) {
+      copy_v3_v3(data->dst_vert_normals[i_dst], data->src_vert_normals[i]);
+      mul_mat3_m4_v3(current_offset, data->dst_vert_normals[i_dst]);
+      normalize_v3(data->dst_vert_normals[i_dst]);
+    }
+  }
+
+  /* adjust edge vertex indices */
+  MEdge *me = result->medge + c * chunk_nedges;
+  for (i = 0; i < chunk_nedges; i++, me++) {
+    me->v1 += c * chunk_nverts;
+    me->v2 += c * chunk_nverts;
+  }
+
+  MPoly *mp = result->mpoly + c * chunk_npolys;
+  for (i = 0; i < chunk_npolys; i++, mp++) {
+    mp->loopstart += c * chunk_nloops;
+  }
+
+  /* adjust loop vertex and edge indices */
+  MLoop *ml = result->mloop + c * chunk_nloops;
+  for (i = 0; i < chunk_nloops; i++, ml++) {
+    ml->v += c * chunk_nverts;
+    ml->e += c * chunk_nedges;
+  }
+
+  /* handle UVs */
+  if (data->uv_offset) {
+    const float uv_offset[2] = {
+        data->uv_offset[0] * (float)c,
+        data->uv_offset[1] * (float)c,
+    };
+    const int totuv = CustomData_number_of_layers(&result->ldata, CD_MLOOPUV);
+    for (i = 0; i < totuv; i++) {
+      MLoopUV *dmloopuv = CustomData_get_layer_n(&result->ldata, CD_MLOOPUV, i);
+      dmloopuv += c * chunk_nloops;
+      int l_index = chunk_nloops;
+      for (; l_index-- != 0; dmloopuv++) {
+        dmloopuv->uv[0] += uv_offset[0];
+        dmloopuv->uv[1] += uv_offset[1];
+      }
+    }
+  }
+}
+
 static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
                                    const ModifierEvalContext *ctx,
                                    Mesh *mesh)
@@ -357,9 +446,6 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
   const MVert *src_mvert;
   MVert *result_dm_verts;
 
-  MEdge *me;
-  MLoop *ml;
-  MPoly *mp;
   int i, j, c, count;
   float length = amd->length;
   /* offset matrix */
@@ -579,52 +665,34 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
     BKE_mesh_vertex_normals_clear_dirty(result);
   }
 
+  /* Cumulative offsets are computed up-front, so the copies can be built independently. */
+  float(*offsets)[4][4] = MEM_malloc_arrayN((size_t)count, sizeof(*offsets), __func__);
+  copy_m4_m4(offsets[0], current_offset);
   for (c = 1; c < count; c++) {
-    /* copy customdata to new geometry */
-    CustomData_copy_data(&mesh->vdata, &result->vdata, 0, c * chunk_nverts, chunk_nverts);
-    CustomData_copy_data(&mesh->edata, &result->edata, 0, c * chunk_nedges, chunk_nedges);
-    CustomData_copy_data(&mesh->ldata, &result->ldata, 0, c * chunk_nloops, chunk_nloops);
-    CustomData_copy_data(&mesh->pdata, &result->pdata, 0, c * chunk_npolys, chunk_npolys);
-
-    const int vert_offset = c * chunk_nverts;
-
     /* recalculate cumulative offset here */
     mul_m4_m4m4(current_offset, current_offset, offset);
+    copy_m4_m4(offsets[c], current_offset);
+  }
 
-    /* apply offset to all new verts */
-    for (i = 0; i < chunk_nverts; i++) {
-      const int i_dst = vert_offset + i;
-      mul_m4_v3(current_offset, result_dm_verts[i_dst].co);
-
-      /* We have to correct normals too, if we do not tag them as dirty! */
-      if (!use_recalc_normals) {
-        copy_v3_v3(dst_vert_normals[i_dst], src_vert_normals[i]);
-        mul_mat3_m4_v3(current_offset, dst_vert_normals[i_dst]);
-        normalize_v3(dst_vert_normals[i_dst]);
-      }
-    }
-
-    /* adjust edge vertex indices */
-    me = result->medge + c * chunk_nedges;
-    for (i = 0; i < chunk_nedges; i++, me++) {
-      me->v1 += c * chunk_nverts;
-      me->v2 += c * chunk_nverts;
-    }
-
-    mp = result->mpoly + c * chunk_npolys;
-    for (i = 0; i < chunk_npolys; i++, mp++) {
-      mp->loopstart += c * chunk_nloops;
-    }
-
-    /* adjust loop vertex and edge indices */
-    ml = result->mloop + c * chunk_nloops;
-    for (i = 0; i < chunk_nloops; i++, ml++) {
-      ml->v += c * chunk_nverts;
-      ml->e += c * chunk_nedges;
-    }
-
-    /* Handle merge between chunk n and n-1 */
-    if (use_merge && (c >= 1)) {
+  ArrayCopyData copy_data = {
+      .mesh = mesh,
+      .result = result,
+      .offsets = (const float(*)[4][4])offsets,
+      .src_vert_normals = src_vert_normals,
+      .dst_vert_normals = dst_vert_normals,
+      .uv_offset = (chunk_nloops > 0 && is_zero_v2(amd->uv_offset) == false) ? amd->uv_offset :
+                                                                               NULL,
+  };
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.use_threading = ((size_t)(count - 1) * (size_t)chunk_nverts) > 10000;
+  BLI_task_parallel_range(1, count, &copy_data, array_copy_chunk, &settings);
+
+  MEM_freeN(offsets);
+
+  /* Handle merge between chunk n and n-1, this depends on the merge of the previous chunk. */
+  if (use_merge) {
+    for (c = 1; c < count; c++) {
       if (!offset_has_scale && (c >= 2)) {
         /* Mapping chunk 3 to chunk 2 is a translation of mapping 2 to 1
          * ... that is except if scaling makes the distance grow */
@@ -663,26 +731,6 @@ static Mesh *arrayModifier_doArray(ArrayModifierData *amd,
     }
   }
 
-  /* handle UVs */
-  if (chunk_nloops > 0 && is_zero_v2(amd->uv_offset) == false) {
-    const int totuv = CustomData_number_of_layers(&result->ldata, CD_MLOOPUV);
-    for (i = 0; i < totuv; i++) {
-      MLoopUV *dmloopuv = CustomData_get_layer_n(&result->ldata, CD_MLOOPUV, i);
-      dmloopuv += chunk_nloops;
-      for (c = 1; c < count; c++) {
-        const float uv_offset[2] = {
-            amd->uv_offset[0] * (float)c,
-            amd->uv_offset[1] * (float)c,
-        };
-        int l_index = chunk_nloops;
-        for (; l_index-- != 0; dmloopuv++) {
-          dmloopuv->uv[0] += uv_offset[0];
-          dmloopuv->uv[1] += uv_offset[1];
-        }
-      }
-    }
-  }
-
   last_chunk_start = (count - 1) * chunk_nverts;
   last_chunk_nverts = chunk_nverts;
 
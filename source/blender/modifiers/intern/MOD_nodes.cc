@@ -894,6 +894,53 @@ static void clear_runtime_data(NodesModifierData *nmd)
   }
 }
 
+void MOD_nodes_profile_report(const NodesModifierData *nmd,
+                              char *str,
+                              const size_t str_maxncpy,
+                              const int max_nodes)
+{
+  str[0] = '\0';
+  if (nmd->runtime_eval_log == nullptr) {
+    return;
+  }
+  const geo_log::ModifierLog &log = *static_cast<const geo_log::ModifierLog *>(
+      nmd->runtime_eval_log);
+
+  struct NodeProfile {
+    std::string path;
+    std::chrono::microseconds exec_time;
+    int64_t elements_num;
+  };
+  Vector<NodeProfile> profiles;
+  std::chrono::microseconds total_time{0};
+  log.root_tree().foreach_node_log_with_path(
+      [&](const StringRef node_path, const geo_log::NodeLog &node_log) {
+        profiles.append(
+            {node_path, node_log.execution_time(), node_log.output_geometry_elements_num()});
+        total_time += node_log.execution_time();
+      });
+  std::sort(profiles.begin(), profiles.end(), [](const NodeProfile &a, const NodeProfile &b) {
+    return a.exec_time > b.exec_time;
+  });
+
+  size_t len = BLI_snprintf_rlen(str,
+                                 str_maxncpy,
+                                 "%d nodes, total %.3f ms\n",
+                                 int(profiles.size()),
+                                 total_time.count() / 1000.0);
+
+  const int nodes_num = std::min(max_nodes, int(profiles.size()));
+  for (int i = 0; i < nodes_num && len < str_maxncpy; i++) {
+    const NodeProfile &profile = profiles[i];
+    len += BLI_snprintf_rlen(str + len,
+                             str_maxncpy - len,
+                             "%s: %.3f ms, %lld output elements\n",
+                             profile.path.c_str(),
+                             profile.exec_time.count() / 1000.0,
+                             (long long int)profile.elements_num);
+  }
+}
+
 struct OutputAttributeInfo {
   GField field;
   StringRefNull name;
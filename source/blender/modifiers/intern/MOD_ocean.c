@@ -307,6 +307,59 @@ static Mesh *generate_ocean_geometry(OceanModifierData *omd, Mesh *mesh_orig, co
   return result;
 }
 
+/* Vertices displaced per task, small enough for the sample buffers to live on the stack. */
+#  define OCEAN_DISPLACE_CHUNK_SIZE 128
+
+typedef struct DisplaceOceanData {
+  OceanModifierData *omd;
+  MVert *mverts;
+  int verts_num;
+  int cfra_for_cache;
+  float size_co_inv;
+} DisplaceOceanData;
+
+static void displace_ocean_chunk(void *__restrict userdata,
+                                 const int chunk_index,
+                                 const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  DisplaceOceanData *dod = userdata;
+  OceanModifierData *omd = dod->omd;
+  const int start = chunk_index * OCEAN_DISPLACE_CHUNK_SIZE;
+  const int len = min_ii(OCEAN_DISPLACE_CHUNK_SIZE, dod->verts_num - start);
+  MVert *mverts = &dod->mverts[start];
+
+  float uv[OCEAN_DISPLACE_CHUNK_SIZE][2];
+  OceanResult ocr[OCEAN_DISPLACE_CHUNK_SIZE];
+
+  for (int i = 0; i < len; i++) {
+    const float *vco = mverts[i].co;
+    uv[i][0] = (vco[0] * dod->size_co_inv) + 0.5f;
+    uv[i][1] = (vco[1] * dod->size_co_inv) + 0.5f;
+  }
+
+  if (omd->oceancache && omd->cached == true) {
+    memset(ocr, 0, sizeof(*ocr) * (size_t)len);
+    for (int i = 0; i < len; i++) {
+      BKE_ocean_cache_eval_uv(omd->oceancache, &ocr[i], dod->cfra_for_cache, uv[i][0], uv[i][1]);
+    }
+  }
+  else {
+    /* Sample the whole chunk at once, locking the ocean for every vertex
+     * makes the threads contend on the lock. */
+    BKE_ocean_eval_uv_array(omd->ocean, ocr, uv, len);
+  }
+
+  for (int i = 0; i < len; i++) {
+    float *vco = mverts[i].co;
+    vco[2] += ocr[i].disp[1];
+
+    if (omd->chop_amount > 0.0f) {
+      vco[0] += ocr[i].disp[0];
+      vco[1] += ocr[i].disp[2];
+    }
+  }
+}
+
 static Mesh *doOcean(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mesh)
 {
   OceanModifierData *omd = (OceanModifierData *)md;
@@ -445,31 +498,25 @@ static Mesh *doOcean(ModifierData *md, const ModifierEvalContext *ctx, Mesh *mes
   }
 
   /* displace the geometry */
-
-  /* NOTE: tried to parallelized that one and previous foam loop,
-   * but gives 20% slower results... odd. */
   {
     const int verts_num = result->totvert;
 
-    for (i = 0; i < verts_num; i++) {
-      float *vco = mverts[i].co;
-      const float u = OCEAN_CO(size_co_inv, vco[0]);
-      const float v = OCEAN_CO(size_co_inv, vco[1]);
-
-      if (omd->oceancache && omd->cached == true) {
-        BKE_ocean_cache_eval_uv(omd->oceancache, &ocr, cfra_for_cache, u, v);
-      }
-      else {
-        BKE_ocean_eval_uv(omd->ocean, &ocr, u, v);
-      }
-
-      vco[2] += ocr.disp[1];
-
-      if (omd->chop_amount > 0.0f) {
-        vco[0] += ocr.disp[0];
-        vco[1] += ocr.disp[2];
-      }
-    }
+    DisplaceOceanData dod = {
+        .omd = omd,
+        .mverts = mverts,
+        .verts_num = verts_num,
+        .cfra_for_cache = cfra_for_cache,
+        .size_co_inv = size_co_inv,
+    };
+
+    TaskParallelSettings settings;
+    BLI_parallel_range_settings_defaults(&settings);
+    settings.use_threading = (verts_num > OCEAN_DISPLACE_CHUNK_SIZE * 8);
+    BLI_task_parallel_range(0,
+                            divide_ceil_u((uint)verts_num, OCEAN_DISPLACE_CHUNK_SIZE),
+                            &dod,
+                            displace_ocean_chunk,
+                            &settings);
   }
 
   if (allocated_ocean) {
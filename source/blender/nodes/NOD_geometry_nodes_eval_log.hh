@@ -339,6 +339,11 @@ class NodeLog {
   }
 
   Vector<const GeometryAttributeInfo *> lookup_available_attributes() const;
+  /**
+   * Total number of elements (points, faces, splines and instances) in the geometry outputs of
+   * the node, used to judge how much data a node produced when profiling a tree.
+   */
+  int64_t output_geometry_elements_num() const;
 };
 
 /** Contains information that has been logged for one specific tree. */
@@ -354,6 +359,16 @@ class TreeLog {
   const NodeLog *lookup_node_log(const bNode &node) const;
   const TreeLog *lookup_child_log(StringRef node_name) const;
   void foreach_node_log(FunctionRef<void(const NodeLog &)> fn) const;
+  /**
+   * Same as #foreach_node_log, but also passes the path of the node, where nodes in nested
+   * groups are prefixed with the names of the group nodes, separated by a slash.
+   */
+  void foreach_node_log_with_path(
+      FunctionRef<void(StringRef node_path, const NodeLog &)> fn) const;
+
+ private:
+  void foreach_node_log_with_path(
+      StringRef path_prefix, FunctionRef<void(StringRef node_path, const NodeLog &)> fn) const;
 };
 
 /** Contains information about an entire geometry nodes evaluation. */
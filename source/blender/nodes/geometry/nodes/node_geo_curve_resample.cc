@@ -264,13 +264,22 @@ static void fill_curve_counts(const bke::CurvesGeometry &src_curves,
  */
 static void accumulate_counts_to_offsets(MutableSpan<int> counts_to_offsets)
 {
-  int total = 0;
-  for (const int i : counts_to_offsets.index_range().drop_back(1)) {
-    const int count = counts_to_offsets[i];
-    BLI_assert(count > 0);
-    counts_to_offsets[i] = total;
-    total += count;
-  }
+  const int total = threading::parallel_scan(
+      counts_to_offsets.index_range().drop_back(1),
+      4096,
+      0,
+      [&](const IndexRange range, int sum, const bool is_final_scan) {
+        for (const int i : range) {
+          const int count = counts_to_offsets[i];
+          BLI_assert(count > 0);
+          if (is_final_scan) {
+            counts_to_offsets[i] = sum;
+          }
+          sum += count;
+        }
+        return sum;
+      },
+      std::plus<int>());
   counts_to_offsets.last() = total;
 }
 
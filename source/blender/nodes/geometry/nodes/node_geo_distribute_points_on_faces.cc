@@ -108,17 +108,19 @@ static void sample_mesh_surface(const Mesh &mesh,
   const Span<MLoopTri> looptris{BKE_mesh_runtime_looptri_ensure(&mesh),
                                 BKE_mesh_runtime_looptri_len(&mesh)};
 
-  for (const int looptri_index : looptris.index_range()) {
+  /* Every triangle uses its own random number generator, so that the triangles can be sampled in
+   * parallel while the result stays deterministic. The generator is seeded and advanced the same
+   * way in both passes below. */
+  auto init_looptri_sampling = [&](const int looptri_index,
+                                   float3 r_vert_positions[3],
+                                   RandomNumberGenerator &r_rng) -> int {
     const MLoopTri &looptri = looptris[looptri_index];
     const int v0_loop = looptri.tri[0];
     const int v1_loop = looptri.tri[1];
     const int v2_loop = looptri.tri[2];
-    const int v0_index = mesh.mloop[v0_loop].v;
-    const int v1_index = mesh.mloop[v1_loop].v;
-    const int v2_index = mesh.mloop[v2_loop].v;
-    const float3 v0_pos = float3(mesh.mvert[v0_index].co);
-    const float3 v1_pos = float3(mesh.mvert[v1_index].co);
-    const float3 v2_pos = float3(mesh.mvert[v2_index].co);
+    r_vert_positions[0] = float3(mesh.mvert[mesh.mloop[v0_loop].v].co);
+    r_vert_positions[1] = float3(mesh.mvert[mesh.mloop[v1_loop].v].co);
+    r_vert_positions[2] = float3(mesh.mvert[mesh.mloop[v2_loop].v].co);
 
     float looptri_density_factor = 1.0f;
     if (!density_factors.is_empty()) {
@@ -127,23 +129,58 @@ static void sample_mesh_surface(const Mesh &mesh,
       const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
       looptri_density_factor = (v0_density_factor + v1_density_factor + v2_density_factor) / 3.0f;
     }
-    const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
+    const float area = area_tri_v3(r_vert_positions[0], r_vert_positions[1], r_vert_positions[2]);
 
     const int looptri_seed = noise::hash(looptri_index, seed);
-    RandomNumberGenerator looptri_rng(looptri_seed);
-
-    const int point_amount = looptri_rng.round_probabilistic(area * base_density *
-                                                             looptri_density_factor);
-
-    for (int i = 0; i < point_amount; i++) {
-      const float3 bary_coord = looptri_rng.get_barycentric_coordinates();
-      float3 point_pos;
-      interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
-      r_positions.append(point_pos);
-      r_bary_coords.append(bary_coord);
-      r_looptri_indices.append(looptri_index);
+    r_rng.seed(looptri_seed);
+
+    return r_rng.round_probabilistic(area * base_density * looptri_density_factor);
+  };
+
+  /* First compute how many points are created on every triangle, so that the points can be
+   * written into the output arrays directly afterwards. */
+  Array<int> looptri_offsets(looptris.size() + 1);
+  threading::parallel_for(looptris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int looptri_index : range) {
+      float3 vert_positions[3];
+      RandomNumberGenerator looptri_rng;
+      looptri_offsets[looptri_index] = init_looptri_sampling(
+          looptri_index, vert_positions, looptri_rng);
     }
+  });
+  int offset = r_positions.size();
+  for (const int looptri_index : looptris.index_range()) {
+    const int point_amount = looptri_offsets[looptri_index];
+    looptri_offsets[looptri_index] = offset;
+    offset += point_amount;
   }
+  looptri_offsets.last() = offset;
+
+  r_positions.resize(offset);
+  r_bary_coords.resize(offset);
+  r_looptri_indices.resize(offset);
+
+  threading::parallel_for(looptris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int looptri_index : range) {
+      const IndexRange points_range(looptri_offsets[looptri_index],
+                                    looptri_offsets[looptri_index + 1] -
+                                        looptri_offsets[looptri_index]);
+      if (points_range.is_empty()) {
+        continue;
+      }
+      float3 vert_positions[3];
+      RandomNumberGenerator looptri_rng;
+      init_looptri_sampling(looptri_index, vert_positions, looptri_rng);
+
+      for (const int i : points_range) {
+        const float3 bary_coord = looptri_rng.get_barycentric_coordinates();
+        interp_v3_v3v3v3(
+            r_positions[i], vert_positions[0], vert_positions[1], vert_positions[2], bary_coord);
+        r_bary_coords[i] = bary_coord;
+        r_looptri_indices[i] = looptri_index;
+      }
+    }
+  });
 }
 
 BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
@@ -204,30 +241,33 @@ BLI_NOINLINE static void update_elimination_mask_based_on_density_factors(
 {
   const Span<MLoopTri> looptris{BKE_mesh_runtime_looptri_ensure(&mesh),
                                 BKE_mesh_runtime_looptri_len(&mesh)};
-  for (const int i : bary_coords.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
-    }
+  threading::parallel_for(bary_coords.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (elimination_mask[i]) {
+        continue;
+      }
 
-    const MLoopTri &looptri = looptris[looptri_indices[i]];
-    const float3 bary_coord = bary_coords[i];
+      const MLoopTri &looptri = looptris[looptri_indices[i]];
+      const float3 bary_coord = bary_coords[i];
 
-    const int v0_loop = looptri.tri[0];
-    const int v1_loop = looptri.tri[1];
-    const int v2_loop = looptri.tri[2];
+      const int v0_loop = looptri.tri[0];
+      const int v1_loop = looptri.tri[1];
+      const int v2_loop = looptri.tri[2];
 
-    const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
-    const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
-    const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
+      const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
+      const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
+      const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
 
-    const float probablity = v0_density_factor * bary_coord.x + v1_density_factor * bary_coord.y +
-                             v2_density_factor * bary_coord.z;
+      const float probablity = v0_density_factor * bary_coord.x +
+                               v1_density_factor * bary_coord.y +
+                               v2_density_factor * bary_coord.z;
 
-    const float hash = noise::hash_float_to_float(bary_coord);
-    if (hash > probablity) {
-      elimination_mask[i] = true;
+      const float hash = noise::hash_float_to_float(bary_coord);
+      if (hash > probablity) {
+        elimination_mask[i] = true;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static void eliminate_points_based_on_mask(const Span<bool> elimination_mask,
@@ -81,11 +81,20 @@ static Array<int> accumulate_counts_to_offsets(const IndexMask selection,
                                                const VArray<int> &counts)
 {
   Array<int> offsets(selection.size() + 1);
-  int total = 0;
-  for (const int i : selection.index_range()) {
-    offsets[i] = total;
-    total += std::max(counts[selection[i]], 0);
-  }
+  const int total = threading::parallel_scan(
+      selection.index_range(),
+      4096,
+      0,
+      [&](const IndexRange range, int sum, const bool is_final_scan) {
+        for (const int i : range) {
+          if (is_final_scan) {
+            offsets[i] = sum;
+          }
+          sum += std::max(counts[selection[i]], 0);
+        }
+        return sum;
+      },
+      std::plus<int>());
   offsets.last() = total;
   return offsets;
 }
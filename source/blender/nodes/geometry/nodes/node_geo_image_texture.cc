@@ -112,10 +112,17 @@ class ImageFieldsFunction : public fn::MultiFunction {
     return std::clamp(x, 0, width - 1);
   }
 
+  /**
+   * Only clipped lookups can go outside of the image,
+   * the other extension modes wrap or clamp the pixel coordinates first.
+   */
+  template<int Extension>
   static float4 image_pixel_lookup(const ImBuf *ibuf, const int px, const int py)
   {
-    if (px < 0 || py < 0 || px >= ibuf->x || py >= ibuf->y) {
-      return float4(0.0f, 0.0f, 0.0f, 0.0f);
+    if constexpr (Extension == SHD_IMAGE_EXTENSION_CLIP) {
+      if (px < 0 || py < 0 || px >= ibuf->x || py >= ibuf->y) {
+        return float4(0.0f, 0.0f, 0.0f, 0.0f);
+      }
     }
     return ((const float4 *)ibuf->rect_float)[px + py * ibuf->x];
   }
@@ -127,10 +134,8 @@ class ImageFieldsFunction : public fn::MultiFunction {
     return x - (float)i;
   }
 
-  static float4 image_cubic_texture_lookup(const ImBuf *ibuf,
-                                           const float px,
-                                           const float py,
-                                           const int extension)
+  template<int Extension>
+  static float4 image_cubic_texture_lookup(const ImBuf *ibuf, const float px, const float py)
   {
     const int width = ibuf->x;
     const int height = ibuf->y;
@@ -139,40 +144,33 @@ class ImageFieldsFunction : public fn::MultiFunction {
     const float ty = frac(py * (float)height - 0.5f, &piy);
     int ppix, ppiy, nnix, nniy;
 
-    switch (extension) {
-      case SHD_IMAGE_EXTENSION_REPEAT: {
-        pix = wrap_periodic(pix, width);
-        piy = wrap_periodic(piy, height);
-        ppix = wrap_periodic(pix - 1, width);
-        ppiy = wrap_periodic(piy - 1, height);
-        nix = wrap_periodic(pix + 1, width);
-        niy = wrap_periodic(piy + 1, height);
-        nnix = wrap_periodic(pix + 2, width);
-        nniy = wrap_periodic(piy + 2, height);
-        break;
-      }
-      case SHD_IMAGE_EXTENSION_CLIP: {
-        ppix = pix - 1;
-        ppiy = piy - 1;
-        nix = pix + 1;
-        niy = piy + 1;
-        nnix = pix + 2;
-        nniy = piy + 2;
-        break;
-      }
-      case SHD_IMAGE_EXTENSION_EXTEND: {
-        ppix = wrap_clamp(pix - 1, width);
-        ppiy = wrap_clamp(piy - 1, height);
-        nix = wrap_clamp(pix + 1, width);
-        niy = wrap_clamp(piy + 1, height);
-        nnix = wrap_clamp(pix + 2, width);
-        nniy = wrap_clamp(piy + 2, height);
-        pix = wrap_clamp(pix, width);
-        piy = wrap_clamp(piy, height);
-        break;
-      }
-      default:
-        return float4(0.0f, 0.0f, 0.0f, 0.0f);
+    if constexpr (Extension == SHD_IMAGE_EXTENSION_REPEAT) {
+      pix = wrap_periodic(pix, width);
+      piy = wrap_periodic(piy, height);
+      ppix = wrap_periodic(pix - 1, width);
+      ppiy = wrap_periodic(piy - 1, height);
+      nix = wrap_periodic(pix + 1, width);
+      niy = wrap_periodic(piy + 1, height);
+      nnix = wrap_periodic(pix + 2, width);
+      nniy = wrap_periodic(piy + 2, height);
+    }
+    else if constexpr (Extension == SHD_IMAGE_EXTENSION_CLIP) {
+      ppix = pix - 1;
+      ppiy = piy - 1;
+      nix = pix + 1;
+      niy = piy + 1;
+      nnix = pix + 2;
+      nniy = piy + 2;
+    }
+    else if constexpr (Extension == SHD_IMAGE_EXTENSION_EXTEND) {
+      ppix = wrap_clamp(pix - 1, width);
+      ppiy = wrap_clamp(piy - 1, height);
+      nix = wrap_clamp(pix + 1, width);
+      niy = wrap_clamp(piy + 1, height);
+      nnix = wrap_clamp(pix + 2, width);
+      nniy = wrap_clamp(piy + 2, height);
+      pix = wrap_clamp(pix, width);
+      piy = wrap_clamp(piy, height);
     }
 
     const int xc[4] = {ppix, pix, nix, nnix};
@@ -189,28 +187,26 @@ class ImageFieldsFunction : public fn::MultiFunction {
     v[2] = ((-0.5f * ty + 0.5f) * ty + 0.5f) * ty + (1.0f / 6.0f);
     v[3] = (1.0f / 6.0f) * ty * ty * ty;
 
-    return (v[0] * (u[0] * (image_pixel_lookup(ibuf, xc[0], yc[0])) +
-                    u[1] * (image_pixel_lookup(ibuf, xc[1], yc[0])) +
-                    u[2] * (image_pixel_lookup(ibuf, xc[2], yc[0])) +
-                    u[3] * (image_pixel_lookup(ibuf, xc[3], yc[0])))) +
-           (v[1] * (u[0] * (image_pixel_lookup(ibuf, xc[0], yc[1])) +
-                    u[1] * (image_pixel_lookup(ibuf, xc[1], yc[1])) +
-                    u[2] * (image_pixel_lookup(ibuf, xc[2], yc[1])) +
-                    u[3] * (image_pixel_lookup(ibuf, xc[3], yc[1])))) +
-           (v[2] * (u[0] * (image_pixel_lookup(ibuf, xc[0], yc[2])) +
-                    u[1] * (image_pixel_lookup(ibuf, xc[1], yc[2])) +
-                    u[2] * (image_pixel_lookup(ibuf, xc[2], yc[2])) +
-                    u[3] * (image_pixel_lookup(ibuf, xc[3], yc[2])))) +
-           (v[3] * (u[0] * (image_pixel_lookup(ibuf, xc[0], yc[3])) +
-                    u[1] * (image_pixel_lookup(ibuf, xc[1], yc[3])) +
-                    u[2] * (image_pixel_lookup(ibuf, xc[2], yc[3])) +
-                    u[3] * (image_pixel_lookup(ibuf, xc[3], yc[3]))));
+    return (v[0] * (u[0] * (image_pixel_lookup<Extension>(ibuf, xc[0], yc[0])) +
+                    u[1] * (image_pixel_lookup<Extension>(ibuf, xc[1], yc[0])) +
+                    u[2] * (image_pixel_lookup<Extension>(ibuf, xc[2], yc[0])) +
+                    u[3] * (image_pixel_lookup<Extension>(ibuf, xc[3], yc[0])))) +
+           (v[1] * (u[0] * (image_pixel_lookup<Extension>(ibuf, xc[0], yc[1])) +
+                    u[1] * (image_pixel_lookup<Extension>(ibuf, xc[1], yc[1])) +
+                    u[2] * (image_pixel_lookup<Extension>(ibuf, xc[2], yc[1])) +
+                    u[3] * (image_pixel_lookup<Extension>(ibuf, xc[3], yc[1])))) +
+           (v[2] * (u[0] * (image_pixel_lookup<Extension>(ibuf, xc[0], yc[2])) +
+                    u[1] * (image_pixel_lookup<Extension>(ibuf, xc[1], yc[2])) +
+                    u[2] * (image_pixel_lookup<Extension>(ibuf, xc[2], yc[2])) +
+                    u[3] * (image_pixel_lookup<Extension>(ibuf, xc[3], yc[2])))) +
+           (v[3] * (u[0] * (image_pixel_lookup<Extension>(ibuf, xc[0], yc[3])) +
+                    u[1] * (image_pixel_lookup<Extension>(ibuf, xc[1], yc[3])) +
+                    u[2] * (image_pixel_lookup<Extension>(ibuf, xc[2], yc[3])) +
+                    u[3] * (image_pixel_lookup<Extension>(ibuf, xc[3], yc[3]))));
   }
 
-  static float4 image_linear_texture_lookup(const ImBuf *ibuf,
-                                            const float px,
-                                            const float py,
-                                            const int extension)
+  template<int Extension>
+  static float4 image_linear_texture_lookup(const ImBuf *ibuf, const float px, const float py)
   {
     const int width = ibuf->x;
     const int height = ibuf->y;
@@ -218,41 +214,34 @@ class ImageFieldsFunction : public fn::MultiFunction {
     const float nfx = frac(px * (float)width - 0.5f, &pix);
     const float nfy = frac(py * (float)height - 0.5f, &piy);
 
-    switch (extension) {
-      case SHD_IMAGE_EXTENSION_CLIP: {
-        nix = pix + 1;
-        niy = piy + 1;
-        break;
-      }
-      case SHD_IMAGE_EXTENSION_EXTEND: {
-        nix = wrap_clamp(pix + 1, width);
-        niy = wrap_clamp(piy + 1, height);
-        pix = wrap_clamp(pix, width);
-        piy = wrap_clamp(piy, height);
-        break;
-      }
-      default:
-      case SHD_IMAGE_EXTENSION_REPEAT:
-        pix = wrap_periodic(pix, width);
-        piy = wrap_periodic(piy, height);
-        nix = wrap_periodic(pix + 1, width);
-        niy = wrap_periodic(piy + 1, height);
-        break;
+    if constexpr (Extension == SHD_IMAGE_EXTENSION_CLIP) {
+      nix = pix + 1;
+      niy = piy + 1;
+    }
+    else if constexpr (Extension == SHD_IMAGE_EXTENSION_EXTEND) {
+      nix = wrap_clamp(pix + 1, width);
+      niy = wrap_clamp(piy + 1, height);
+      pix = wrap_clamp(pix, width);
+      piy = wrap_clamp(piy, height);
+    }
+    else if constexpr (Extension == SHD_IMAGE_EXTENSION_REPEAT) {
+      pix = wrap_periodic(pix, width);
+      piy = wrap_periodic(piy, height);
+      nix = wrap_periodic(pix + 1, width);
+      niy = wrap_periodic(piy + 1, height);
     }
 
     const float ptx = 1.0f - nfx;
     const float pty = 1.0f - nfy;
 
-    return image_pixel_lookup(ibuf, pix, piy) * ptx * pty +
-           image_pixel_lookup(ibuf, nix, piy) * nfx * pty +
-           image_pixel_lookup(ibuf, pix, niy) * ptx * nfy +
-           image_pixel_lookup(ibuf, nix, niy) * nfx * nfy;
+    return image_pixel_lookup<Extension>(ibuf, pix, piy) * ptx * pty +
+           image_pixel_lookup<Extension>(ibuf, nix, piy) * nfx * pty +
+           image_pixel_lookup<Extension>(ibuf, pix, niy) * ptx * nfy +
+           image_pixel_lookup<Extension>(ibuf, nix, niy) * nfx * nfy;
   }
 
-  static float4 image_closest_texture_lookup(const ImBuf *ibuf,
-                                             const float px,
-                                             const float py,
-                                             const int extension)
+  template<int Extension>
+  static float4 image_closest_texture_lookup(const ImBuf *ibuf, const float px, const float py)
   {
     const int width = ibuf->x;
     const int height = ibuf->y;
@@ -260,31 +249,61 @@ class ImageFieldsFunction : public fn::MultiFunction {
     const float tx = frac(px * (float)width, &ix);
     const float ty = frac(py * (float)height, &iy);
 
-    switch (extension) {
-      case SHD_IMAGE_EXTENSION_REPEAT: {
-        ix = wrap_periodic(ix, width);
-        iy = wrap_periodic(iy, height);
-        return image_pixel_lookup(ibuf, ix, iy);
-      }
-      case SHD_IMAGE_EXTENSION_CLIP: {
+    if constexpr (Extension == SHD_IMAGE_EXTENSION_REPEAT) {
+      ix = wrap_periodic(ix, width);
+      iy = wrap_periodic(iy, height);
+      return image_pixel_lookup<Extension>(ibuf, ix, iy);
+    }
+    else {
+      if constexpr (Extension == SHD_IMAGE_EXTENSION_CLIP) {
         if (tx < 0.0f || ty < 0.0f || tx > 1.0f || ty > 1.0f) {
           return float4(0.0f, 0.0f, 0.0f, 0.0f);
         }
         if (ix < 0 || iy < 0 || ix > width || iy > height) {
           return float4(0.0f, 0.0f, 0.0f, 0.0f);
         }
-        ATTR_FALLTHROUGH;
       }
-      case SHD_IMAGE_EXTENSION_EXTEND: {
-        ix = wrap_clamp(ix, width);
-        iy = wrap_clamp(iy, height);
-        return image_pixel_lookup(ibuf, ix, iy);
-      }
-      default:
-        return float4(0.0f, 0.0f, 0.0f, 0.0f);
+      ix = wrap_clamp(ix, width);
+      iy = wrap_clamp(iy, height);
+      return image_pixel_lookup<Extension>(ibuf, ix, iy);
     }
   }
 
+  /**
+   * Sample the image with the extension mode known at compile time,
+   * so the per-sample lookups don't have to branch on it.
+   */
+  template<int Extension>
+  void sample_image(const IndexMask mask,
+                    const VArray<float3> &vectors,
+                    MutableSpan<float4> color_data) const
+  {
+    const ImBuf *ibuf = image_buffer_;
+    devirtualize_varray(vectors, [&](const auto vectors) {
+      switch (interpolation_) {
+        case SHD_INTERP_LINEAR:
+          mask.foreach_index([&](const int64_t i) {
+            const float3 p = vectors[i];
+            color_data[i] = image_linear_texture_lookup<Extension>(ibuf, p.x, p.y);
+          });
+          break;
+        case SHD_INTERP_CLOSEST:
+          mask.foreach_index([&](const int64_t i) {
+            const float3 p = vectors[i];
+            color_data[i] = image_closest_texture_lookup<Extension>(ibuf, p.x, p.y);
+          });
+          break;
+        case SHD_INTERP_CUBIC:
+        case SHD_INTERP_SMART:
+          mask.foreach_index([&](const int64_t i) {
+            const float3 p = vectors[i];
+            color_data[i] = image_cubic_texture_lookup<Extension>(ibuf, p.x, p.y);
+          });
+          break;
+      }
+    });
+  }
+
   void call(IndexMask mask, fn::MFParams params, fn::MFContext UNUSED(context)) const override
   {
     const VArray<float3> &vectors = params.readonly_single_input<float3>(0, "Vector");
@@ -295,24 +314,23 @@ class ImageFieldsFunction : public fn::MultiFunction {
     MutableSpan<float4> color_data{(float4 *)r_color.data(), r_color.size()};
 
     /* Sample image texture. */
-    switch (interpolation_) {
-      case SHD_INTERP_LINEAR:
-        for (const int64_t i : mask) {
-          const float3 p = vectors[i];
-          color_data[i] = image_linear_texture_lookup(image_buffer_, p.x, p.y, extension_);
-        }
+    switch (extension_) {
+      case SHD_IMAGE_EXTENSION_REPEAT:
+        this->sample_image<SHD_IMAGE_EXTENSION_REPEAT>(mask, vectors, color_data);
         break;
-      case SHD_INTERP_CLOSEST:
-        for (const int64_t i : mask) {
-          const float3 p = vectors[i];
-          color_data[i] = image_closest_texture_lookup(image_buffer_, p.x, p.y, extension_);
-        }
+      case SHD_IMAGE_EXTENSION_EXTEND:
+        this->sample_image<SHD_IMAGE_EXTENSION_EXTEND>(mask, vectors, color_data);
+        break;
+      case SHD_IMAGE_EXTENSION_CLIP:
+        this->sample_image<SHD_IMAGE_EXTENSION_CLIP>(mask, vectors, color_data);
         break;
-      case SHD_INTERP_CUBIC:
-      case SHD_INTERP_SMART:
-        for (const int64_t i : mask) {
-          const float3 p = vectors[i];
-          color_data[i] = image_cubic_texture_lookup(image_buffer_, p.x, p.y, extension_);
+      default:
+        /* Unknown extension modes are treated as repeat by linear interpolation. */
+        if (interpolation_ == SHD_INTERP_LINEAR) {
+          this->sample_image<SHD_IMAGE_EXTENSION_REPEAT>(mask, vectors, color_data);
+        }
+        else {
+          color_data.fill_indices(mask, float4(0.0f, 0.0f, 0.0f, 0.0f));
         }
         break;
     }
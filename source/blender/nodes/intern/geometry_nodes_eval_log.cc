@@ -164,6 +164,24 @@ void TreeLog::foreach_node_log(FunctionRef<void(const NodeLog &)> fn) const
   }
 }
 
+void TreeLog::foreach_node_log_with_path(
+    FunctionRef<void(StringRef node_path, const NodeLog &)> fn) const
+{
+  this->foreach_node_log_with_path("", fn);
+}
+
+void TreeLog::foreach_node_log_with_path(
+    StringRef path_prefix, FunctionRef<void(StringRef node_path, const NodeLog &)> fn) const
+{
+  for (auto node_log : node_logs_.items()) {
+    fn(path_prefix + node_log.key, *node_log.value);
+  }
+
+  for (auto child : child_logs_.items()) {
+    child.value->foreach_node_log_with_path(path_prefix + child.key + "/", fn);
+  }
+}
+
 const SocketLog *NodeLog::lookup_socket_log(eNodeSocketInOut in_out, int index) const
 {
   BLI_assert(index >= 0);
@@ -293,6 +311,31 @@ Vector<const GeometryAttributeInfo *> NodeLog::lookup_available_attributes() con
   return attributes;
 }
 
+int64_t NodeLog::output_geometry_elements_num() const
+{
+  int64_t elements_num = 0;
+  for (const SocketLog &socket_log : output_logs_) {
+    const GeometryValueLog *geo_value_log = dynamic_cast<const GeometryValueLog *>(
+        socket_log.value());
+    if (geo_value_log == nullptr) {
+      continue;
+    }
+    if (geo_value_log->mesh_info) {
+      elements_num += geo_value_log->mesh_info->tot_verts + geo_value_log->mesh_info->tot_faces;
+    }
+    if (geo_value_log->curve_info) {
+      elements_num += geo_value_log->curve_info->tot_splines;
+    }
+    if (geo_value_log->pointcloud_info) {
+      elements_num += geo_value_log->pointcloud_info->tot_points;
+    }
+    if (geo_value_log->instances_info) {
+      elements_num += geo_value_log->instances_info->tot_instances;
+    }
+  }
+  return elements_num;
+}
+
 const ModifierLog *ModifierLog::find_root_by_node_editor_context(const SpaceNode &snode)
 {
   if (snode.id == nullptr) {
@@ -31,6 +31,8 @@
 #include "bpy_app_icons.h"
 #include "bpy_app_timers.h"
 
+#include "MEM_guardedalloc.h"
+
 #include "BLI_utildefines.h"
 
 #include "BKE_appdir.h"
@@ -336,6 +338,24 @@ static PyObject *bpy_app_preview_render_size_get(PyObject *UNUSED(self), void *c
   return PyLong_FromLong((long)UI_icon_preview_to_render_size(POINTER_AS_INT(closure)));
 }
 
+PyDoc_STRVAR(bpy_app_memory_categories_doc,
+             "Dictionary mapping memory categories to a (current, peak) tuple of their memory "
+             "usage in bytes (read-only)");
+static PyObject *bpy_app_memory_categories_get(PyObject *UNUSED(self), void *UNUSED(closure))
+{
+  PyObject *ret = PyDict_New();
+  for (int i = 0; i < MEM_CATEGORY_NUM; i++) {
+    const eMEMCategory category = (eMEMCategory)i;
+    PyObject *item = PyTuple_New(2);
+    PyTuple_SET_ITEMS(item,
+                      PyLong_FromSize_t(MEM_get_category_memory_in_use(category)),
+                      PyLong_FromSize_t(MEM_get_category_peak_memory(category)));
+    PyDict_SetItemString(ret, MEM_category_name(category), item);
+    Py_DECREF(item);
+  }
+  return ret;
+}
+
 static PyObject *bpy_app_autoexec_fail_message_get(PyObject *UNUSED(self), void *UNUSED(closure))
 {
   return PyC_UnicodeFromByte(G.autoexec_fail);
@@ -425,6 +445,11 @@ static PyGetSetDef bpy_app_getsets[] = {
      NULL},
     {"tempdir", bpy_app_tempdir_get, NULL, bpy_app_tempdir_doc, NULL},
     {"driver_namespace", bpy_app_driver_dict_get, NULL, bpy_app_driver_dict_doc, NULL},
+    {"memory_categories",
+     bpy_app_memory_categories_get,
+     NULL,
+     bpy_app_memory_categories_doc,
+     NULL},
 
     {"render_icon_size",
      bpy_app_preview_render_size_get,
@@ -26,6 +26,7 @@ void bpy_app_generic_callback(struct Main *main,
                               struct PointerRNA **pointers,
                               const int pointers_num,
                               void *arg);
+static bool bpy_app_generic_callback_poll(void *arg);
 
 static PyTypeObject BlenderAppCbType;
 
@@ -237,6 +238,7 @@ PyObject *BPY_app_handlers_struct(void)
       funcstore->func = bpy_app_generic_callback;
       funcstore->alloc = 0;
       funcstore->arg = POINTER_FROM_INT(pos);
+      funcstore->poll = bpy_app_generic_callback_poll;
       BKE_callback_add(funcstore, pos);
     }
   }
@@ -302,6 +304,12 @@ static PyObject *choose_arguments(PyObject *func, PyObject *args_all, PyObject *
   return args_all;
 }
 
+/* True when there are Python handlers for the event, read without the GIL like below. */
+static bool bpy_app_generic_callback_poll(void *arg)
+{
+  return PyList_GET_SIZE(py_cb_array[POINTER_AS_INT(arg)]) > 0;
+}
+
 /* the actual callback - not necessarily called from py */
 void bpy_app_generic_callback(struct Main *UNUSED(main),
                               struct PointerRNA **pointers,
@@ -31,6 +31,7 @@
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
 #include "BLI_string.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_timecode.h"
 
@@ -155,12 +156,15 @@ static void render_callback_exec_id(Render *re, Main *bmain, ID *id, eCbEvent ev
 /** \name Allocation & Free
  * \{ */
 
+typedef struct RenderWriteQueue RenderWriteQueue;
+
 static int do_write_image_or_movie(Render *re,
                                    Main *bmain,
                                    Scene *scene,
                                    bMovieHandle *mh,
                                    const int totvideos,
-                                   const char *name_override);
+                                   const char *name_override,
+                                   RenderWriteQueue *write_queue);
 
 /* default callbacks, set in each new render */
 static void result_nothing(void *UNUSED(arg), RenderResult *UNUSED(rr))
@@ -1843,7 +1847,7 @@ void RE_RenderFrame(Render *re,
                                      NULL);
 
         /* reports only used for Movie */
-        do_write_image_or_movie(re, bmain, scene, NULL, 0, name);
+        do_write_image_or_movie(re, bmain, scene, NULL, 0, name, NULL);
       }
     }
 
@@ -2020,12 +2024,125 @@ bool RE_WriteRenderViewsMovie(ReportList *reports,
   return ok;
 }
 
+/* Image files of an animation are written in the background while the next frame renders. The
+ * render result has to be copied for that, so this is only done when no handlers could expect the
+ * file on disk: render_stats, render_post and render_write handlers run after the file was saved.
+ * Otherwise the file is written from the render thread as before. Movies are always written from
+ * the render thread, as frames have to be encoded in order. */
+
+typedef struct RenderWriteJob {
+  /* Copy of the render result of the frame, owned by the job. */
+  RenderResult *rr;
+  /* Settings read from the scene on the render thread. The job doesn't access the scene itself,
+   * handlers may change it while the file is written. Only the views, dither and stamp settings
+   * of the render data are set. */
+  RenderData rd;
+  ImageFormatData image_format;
+  char name[FILE_MAX];
+
+  /* Reports of the writer thread, moved to the render reports once the job is finished. */
+  ReportList reports;
+  bool ok;
+  /* Time it took to write the file, in seconds. */
+  double time;
+} RenderWriteJob;
+
+struct RenderWriteQueue {
+  TaskPool *task_pool;
+  /* The job of the last written frame, only accessed from the render thread. */
+  RenderWriteJob *job;
+};
+
+static void render_write_queue_init(RenderWriteQueue *queue)
+{
+  queue->task_pool = BLI_task_pool_create_background(NULL, TASK_PRIORITY_HIGH);
+  queue->job = NULL;
+}
+
+static void render_write_job_task(TaskPool *__restrict UNUSED(pool), void *taskdata)
+{
+  RenderWriteJob *job = taskdata;
+  const double start_time = PIL_check_seconds_timer();
+  job->ok = BKE_image_render_write_ex(
+      &job->reports, job->rr, &job->rd, &job->image_format, true, job->name);
+  job->time = PIL_check_seconds_timer() - start_time;
+}
+
+/* True when the file of a frame can still be written while the next frame renders. */
+static bool render_write_queue_use_background(void)
+{
+  return !BKE_callback_has_handlers(BKE_CB_EVT_RENDER_STATS) &&
+         !BKE_callback_has_handlers(BKE_CB_EVT_RENDER_POST) &&
+         !BKE_callback_has_handlers(BKE_CB_EVT_RENDER_WRITE);
+}
+
+static void render_write_queue_push(Render *re,
+                                    RenderWriteQueue *queue,
+                                    RenderResult *rr,
+                                    const Scene *scene,
+                                    const char *name)
+{
+  BLI_assert(queue->job == NULL);
+  RenderWriteJob *job = MEM_callocN(sizeof(RenderWriteJob), __func__);
+
+  job->rr = RE_DuplicateRenderResult(rr);
+  BLI_duplicatelist(&job->rd.views, &scene->r.views);
+  job->rd.dither_intensity = scene->r.dither_intensity;
+  job->rd.stamp = scene->r.stamp;
+  BKE_image_format_init_for_write(&job->image_format, scene, NULL);
+  BLI_strncpy(job->name, name, sizeof(job->name));
+  BKE_reports_init(&job->reports, re->reports ? re->reports->flag : RPT_PRINT);
+
+  queue->job = job;
+  BLI_task_pool_push(queue->task_pool, render_write_job_task, job, false, NULL);
+}
+
+/**
+ * Wait for the file of the last frame to be written and hand over its reports.
+ * \return False when writing the file failed.
+ */
+static bool render_write_queue_finish(Render *re, RenderWriteQueue *queue)
+{
+  RenderWriteJob *job = queue->job;
+  if (job == NULL) {
+    return true;
+  }
+
+  BLI_task_pool_work_and_wait(queue->task_pool);
+  queue->job = NULL;
+
+  if (job->ok) {
+    char time_str[32];
+    BLI_timecode_string_from_time_simple(time_str, sizeof(time_str), job->time);
+    printf("Saved in background: '%s' (Saving: %s)\n", job->name, time_str);
+  }
+
+  if (re->reports) {
+    BLI_movelisttolist(&re->reports->list, &job->reports.list);
+  }
+  BKE_reports_clear(&job->reports);
+
+  const bool ok = job->ok;
+  RE_FreeRenderResult(job->rr);
+  BLI_freelistN(&job->rd.views);
+  BKE_image_format_free(&job->image_format);
+  MEM_freeN(job);
+  return ok;
+}
+
+static void render_write_queue_free(Render *re, RenderWriteQueue *queue)
+{
+  render_write_queue_finish(re, queue);
+  BLI_task_pool_free(queue->task_pool);
+}
+
 static int do_write_image_or_movie(Render *re,
                                    Main *bmain,
                                    Scene *scene,
                                    bMovieHandle *mh,
                                    const int totvideos,
-                                   const char *name_override)
+                                   const char *name_override,
+                                   RenderWriteQueue *write_queue)
 {
   char name[FILE_MAX];
   RenderResult rres;
@@ -2037,7 +2154,14 @@ static int do_write_image_or_movie(Render *re,
   const bool do_write_file = !(re_type->flag & RE_USE_NO_IMAGE_SAVE) ||
                              (re_type->flag & RE_USE_POSTPROCESS);
 
-  if (do_write_file) {
+  bool write_in_background = false;
+  if (write_queue) {
+    /* The file of the previous frame was written while this frame rendered. */
+    ok = render_write_queue_finish(re, write_queue);
+    write_in_background = render_write_queue_use_background();
+  }
+
+  if (do_write_file && ok) {
     RE_AcquireResultImageViews(re, &rres);
 
     /* write movie or image */
@@ -2061,7 +2185,12 @@ static int do_write_image_or_movie(Render *re,
       }
 
       /* write images as individual images or stereo */
-      ok = BKE_image_render_write(re->reports, &rres, scene, true, name);
+      if (write_in_background) {
+        render_write_queue_push(re, write_queue, &rres, scene, name);
+      }
+      else {
+        ok = BKE_image_render_write(re->reports, &rres, scene, true, name);
+      }
     }
 
     RE_ReleaseResultImageViews(re, &rres);
@@ -2080,7 +2209,8 @@ static int do_write_image_or_movie(Render *re,
    * Not sure it's actually even used anyway, we could as well pass NULL? */
   render_callback_exec_null(re, G_MAIN, BKE_CB_EVT_RENDER_STATS);
 
-  if (do_write_file) {
+  /* Files written in the background report their own time once they are saved. */
+  if (do_write_file && ok && !write_in_background) {
     BLI_timecode_string_from_time_simple(name, sizeof(name), re->i.lastframetime - render_time);
     printf(" (Saving: %s)\n", name);
   }
@@ -2210,6 +2340,13 @@ void RE_RenderAnim(Render *re,
 
   re->flag |= R_ANIMATION;
 
+  /* Image files may be written in the background while the next frame renders. */
+  const bool use_write_queue = (is_movie == false && do_write_file);
+  RenderWriteQueue write_queue;
+  if (use_write_queue) {
+    render_write_queue_init(&write_queue);
+  }
+
   {
     scene->r.subframe = 0.0f;
     for (nfra = sfra, scene->r.cfra = sfra; scene->r.cfra <= efra; scene->r.cfra++) {
@@ -2330,7 +2467,13 @@ void RE_RenderAnim(Render *re,
 
       if (re->test_break(re->tbh) == 0) {
         if (!G.is_break) {
-          if (!do_write_image_or_movie(re, bmain, scene, mh, totvideos, NULL)) {
+          if (!do_write_image_or_movie(re,
+                                       bmain,
+                                       scene,
+                                       mh,
+                                       totvideos,
+                                       NULL,
+                                       use_write_queue ? &write_queue : NULL)) {
             G.is_break = true;
           }
         }
@@ -2339,7 +2482,15 @@ void RE_RenderAnim(Render *re,
         G.is_break = true;
       }
 
+      if (G.is_break == false) {
+        render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_POST);
+      }
+
       if (G.is_break == true) {
+        if (use_write_queue) {
+          render_write_queue_finish(re, &write_queue);
+        }
+
         /* remove touched file */
         if (is_movie == false && do_write_file) {
           if (rd.mode & R_TOUCH) {
@@ -2372,14 +2523,15 @@ void RE_RenderAnim(Render *re,
         break;
       }
 
-      if (G.is_break == false) {
-        /* keep after file save */
-        render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_POST);
-        render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_WRITE);
-      }
+      /* keep after file save */
+      render_callback_exec_id(re, re->main, &scene->id, BKE_CB_EVT_RENDER_WRITE);
     }
   }
 
+  if (use_write_queue) {
+    render_write_queue_free(re, &write_queue);
+  }
+
   /* end movie */
   if (is_movie && do_write_file) {
     re_movie_free_all(re, mh, totvideos);
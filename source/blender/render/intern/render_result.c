@@ -15,10 +15,13 @@
 #include "BLI_ghash.h"
 #include "BLI_hash_md5.h"
 #include "BLI_listbase.h"
+#include "BLI_math_base.h"
+#include "BLI_math_vector.h"
 #include "BLI_path_util.h"
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_string_utils.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -171,20 +174,19 @@ static void render_layer_allocate_pass(RenderResult *rr, RenderPass *rp)
   }
 
   const size_t rectsize = ((size_t)rr->rectx) * rr->recty * rp->channels;
-  rp->rect = MEM_callocN(sizeof(float) * rectsize, rp->name);
 
+  /* Passes which are filled with a non-zero value don't need to be cleared first. */
   if (STREQ(rp->name, RE_PASSNAME_VECTOR)) {
     /* initialize to max speed */
-    float *rect = rp->rect;
-    for (int x = rectsize - 1; x >= 0; x--) {
-      rect[x] = PASS_VECTOR_MAX;
-    }
+    rp->rect = MEM_malloc_arrayN(rectsize, sizeof(float), rp->name);
+    copy_vn_fl(rp->rect, rectsize, PASS_VECTOR_MAX);
   }
   else if (STREQ(rp->name, RE_PASSNAME_Z)) {
-    float *rect = rp->rect;
-    for (int x = rectsize - 1; x >= 0; x--) {
-      rect[x] = 10e10;
-    }
+    rp->rect = MEM_malloc_arrayN(rectsize, sizeof(float), rp->name);
+    copy_vn_fl(rp->rect, rectsize, 10e10);
+  }
+  else {
+    rp->rect = MEM_callocN(sizeof(float) * rectsize, rp->name);
   }
 }
 
@@ -787,27 +789,46 @@ void render_result_views_new(RenderResult *rr, const RenderData *rd)
 
 /*********************************** Merge ***********************************/
 
+typedef struct MergeTileData {
+  float *target;
+  const float *tile;
+  size_t target_stride, tile_stride;
+  size_t copylen;
+} MergeTileData;
+
+static void do_merge_tile_row(void *__restrict userdata,
+                              const int y,
+                              const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const MergeTileData *data = userdata;
+  memcpy(
+      data->target + data->target_stride * y, data->tile + data->tile_stride * y, data->copylen);
+}
+
 static void do_merge_tile(
     RenderResult *rr, RenderResult *rrpart, float *target, float *tile, int pixsize)
 {
-  int y, tilex, tiley;
-  size_t ofs, copylen;
-
-  copylen = tilex = rrpart->rectx;
-  tiley = rrpart->recty;
+  const int tiley = rrpart->recty;
+  const size_t ofs = (((size_t)rrpart->tilerect.ymin) * rr->rectx + rrpart->tilerect.xmin);
 
-  ofs = (((size_t)rrpart->tilerect.ymin) * rr->rectx + rrpart->tilerect.xmin);
-  target += pixsize * ofs;
+  MergeTileData data;
+  data.target = target + pixsize * ofs;
+  data.tile = tile;
+  data.target_stride = (size_t)pixsize * rr->rectx;
+  data.tile_stride = (size_t)pixsize * rrpart->rectx;
+  data.copylen = sizeof(float) * data.tile_stride;
 
-  copylen *= sizeof(float) * pixsize;
-  tilex *= pixsize;
-  ofs = pixsize * rr->rectx;
-
-  for (y = 0; y < tiley; y++) {
-    memcpy(target, tile, copylen);
-    target += ofs;
-    tile += tilex;
+  if (data.copylen == 0) {
+    return;
   }
+
+  /* Only copy large results with multiple threads, when a thread gets enough rows to amortize
+   * scheduling (e.g. when merging a full frame result of an engine without tiles). */
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = max_ii(1, (int)((256 * 1024) / data.copylen));
+  settings.use_threading = tiley > settings.min_iter_per_thread;
+  BLI_task_parallel_range(0, tiley, &data, do_merge_tile_row, &settings);
 }
 
 void render_result_merge(RenderResult *rr, RenderResult *rrpart)
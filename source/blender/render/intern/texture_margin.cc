@@ -5,10 +5,12 @@
  * \ingroup render
  */
 
+#include "BLI_array.hh"
 #include "BLI_assert.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vec_types.hh"
 #include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "BKE_DerivedMesh.h"
@@ -205,75 +207,107 @@ class TextureMarginMap {
    * Walk over the map and for margin pixels follow the direction stored in the bottom 3
    * bits back to the polygon.
    * Then look up the pixel from the next polygon.
+   *
+   * The lookups only read the map, so they are done for all rows in parallel. The pixels are
+   * written afterwards in the original row order, because the interpolation can read margin
+   * pixels that were written before.
    */
   void lookup_pixels(ImBuf *ibuf, char *mask, int maxPolygonSteps)
   {
-    for (int y = 0; y < h_; y++) {
-      for (int x = 0; x < w_; x++) {
-        uint32_t dp = get_pixel(x, y);
-        if (IsDijkstraPixel(dp) && !DijkstraPixelIsUnset(dp)) {
-          int dist = DijkstraPixelGetDistance(dp);
-          int direction = DijkstraPixelGetDirection(dp);
-
-          int xx = x;
-          int yy = y;
-
-          /* Follow the dijkstra directions to find the polygon this margin pixels belongs to. */
-          while (dist > 0) {
-            xx -= directions[direction][0];
-            yy -= directions[direction][1];
-            dp = get_pixel(xx, yy);
-            dist -= distances[direction];
-            BLI_assert(!dist || (dist == DijkstraPixelGetDistance(dp)));
-            direction = DijkstraPixelGetDirection(dp);
+    struct MarginPixel {
+      int x;
+      float destX, destY;
+    };
+    Array<Vector<MarginPixel>> margin_pixels_by_row(h_);
+
+    threading::parallel_for(IndexRange(h_), 16, [&](const IndexRange range) {
+      for (const int y : range) {
+        Vector<MarginPixel> &margin_pixels = margin_pixels_by_row[y];
+        for (int x = 0; x < w_; x++) {
+          uint32_t dp = get_pixel(x, y);
+          if (IsDijkstraPixel(dp) && !DijkstraPixelIsUnset(dp)) {
+            float destX, destY;
+            if (lookup_margin_pixel(x, y, dp, maxPolygonSteps, &destX, &destY)) {
+              margin_pixels.append({x, destX, destY});
+            }
+          }
+          else if (DijkstraPixelIsUnset(dp) || !IsDijkstraPixel(dp)) {
+            /* These are not margin pixels, make sure the extend filter which is run after this
+             * step leaves them alone.
+             */
+            mask[y * w_ + x] = 1;
           }
+        }
+      }
+    });
 
-          uint32_t poly = get_pixel(xx, yy);
+    for (int y = 0; y < h_; y++) {
+      for (const MarginPixel &pixel : margin_pixels_by_row[y]) {
+        bilinear_interpolation(ibuf, ibuf, pixel.destX, pixel.destY, pixel.x, y);
+        /* Add our new pixels to the assigned pixel map. */
+        mask[y * w_ + pixel.x] = 1;
+      }
+    }
+  }
 
-          BLI_assert(!IsDijkstraPixel(poly));
+ private:
+  /**
+   * Find the location in the image a margin pixel is copied from,
+   * returns false if no pixel in an adjacent polygon was found.
+   */
+  bool lookup_margin_pixel(
+      int x, int y, uint32_t dp, int maxPolygonSteps, float *r_destx, float *r_desty) const
+  {
+    int dist = DijkstraPixelGetDistance(dp);
+    int direction = DijkstraPixelGetDirection(dp);
+
+    int xx = x;
+    int yy = y;
+
+    /* Follow the dijkstra directions to find the polygon this margin pixels belongs to. */
+    while (dist > 0) {
+      xx -= directions[direction][0];
+      yy -= directions[direction][1];
+      dp = get_pixel(xx, yy);
+      dist -= distances[direction];
+      BLI_assert(!dist || (dist == DijkstraPixelGetDistance(dp)));
+      direction = DijkstraPixelGetDirection(dp);
+    }
 
-          float destX, destY;
+    uint32_t poly = get_pixel(xx, yy);
 
-          int other_poly;
-          bool found_pixel_in_polygon = false;
-          if (lookup_pixel_polygon_neighbourhood(x, y, &poly, &destX, &destY, &other_poly)) {
+    BLI_assert(!IsDijkstraPixel(poly));
 
-            for (int i = 0; i < maxPolygonSteps; i++) {
-              /* Force to pixel grid. */
-              int nx = (int)round(destX);
-              int ny = (int)round(destY);
-              uint32_t polygon_from_map = get_pixel(nx, ny);
-              if (other_poly == polygon_from_map) {
-                found_pixel_in_polygon = true;
-                break;
-              }
+    float destX = 0.0f, destY = 0.0f;
 
-              float dist_to_edge;
-              /* Look up again, but starting from the polygon we were expected to land in. */
-              if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge)) {
-                found_pixel_in_polygon = false;
-                break;
-              }
-            }
+    int other_poly;
+    bool found_pixel_in_polygon = false;
+    if (lookup_pixel_polygon_neighbourhood(x, y, &poly, &destX, &destY, &other_poly)) {
 
-            if (found_pixel_in_polygon) {
-              bilinear_interpolation(ibuf, ibuf, destX, destY, x, y);
-              /* Add our new pixels to the assigned pixel map. */
-              mask[y * w_ + x] = 1;
-            }
-          }
+      for (int i = 0; i < maxPolygonSteps; i++) {
+        /* Force to pixel grid. */
+        int nx = (int)round(destX);
+        int ny = (int)round(destY);
+        uint32_t polygon_from_map = get_pixel(nx, ny);
+        if (other_poly == polygon_from_map) {
+          found_pixel_in_polygon = true;
+          break;
         }
-        else if (DijkstraPixelIsUnset(dp) || !IsDijkstraPixel(dp)) {
-          /* These are not margin pixels, make sure the extend filter which is run after this step
-           * leaves them alone.
-           */
-          mask[y * w_ + x] = 1;
+
+        float dist_to_edge;
+        /* Look up again, but starting from the polygon we were expected to land in. */
+        if (!lookup_pixel(nx, ny, other_poly, &destX, &destY, &other_poly, &dist_to_edge)) {
+          found_pixel_in_polygon = false;
+          break;
         }
       }
     }
+
+    *r_destx = destX;
+    *r_desty = destY;
+    return found_pixel_in_polygon;
   }
 
- private:
   float2 uv_to_xy(MLoopUV const &mloopuv) const
   {
     float2 ret;
@@ -317,8 +351,12 @@ class TextureMarginMap {
    * polygon we need can be the one next to the one the Dijkstra map provides. To prevent missing
    * pixels also check the neighboring polygons.
    */
-  bool lookup_pixel_polygon_neighbourhood(
-      float x, float y, uint32_t *r_start_poly, float *r_destx, float *r_desty, int *r_other_poly)
+  bool lookup_pixel_polygon_neighbourhood(float x,
+                                          float y,
+                                          uint32_t *r_start_poly,
+                                          float *r_destx,
+                                          float *r_desty,
+                                          int *r_other_poly) const
   {
     float found_dist;
     if (lookup_pixel(x, y, *r_start_poly, r_destx, r_desty, r_other_poly, &found_dist)) {
@@ -371,7 +409,7 @@ class TextureMarginMap {
                     float *r_destx,
                     float *r_desty,
                     int *r_other_poly,
-                    float *r_dist_to_edge)
+                    float *r_dist_to_edge) const
   {
     float2 point(x, y);
 
@@ -86,6 +86,8 @@ typedef struct SeqDiskCache {
   ListBase files;
   ThreadMutex read_write_mutex;
   size_t size_total;
+  /** Reused for all writes, so the compression threads are only started once. */
+  struct ZSTD_CCtx_s *compress_ctx;
 } SeqDiskCache;
 
 typedef struct DiskCacheFile {
@@ -419,7 +421,8 @@ void seq_disk_cache_invalidate(SeqDiskCache *disk_cache,
   BLI_mutex_unlock(&disk_cache->read_write_mutex);
 }
 
-static size_t deflate_imbuf_to_file(ImBuf *ibuf,
+static size_t deflate_imbuf_to_file(SeqDiskCache *disk_cache,
+                                    ImBuf *ibuf,
                                     FILE *file,
                                     int level,
                                     DiskCacheHeaderEntry *header_entry)
@@ -428,8 +431,15 @@ static size_t deflate_imbuf_to_file(ImBuf *ibuf,
 
   /* Apply compression if wanted, otherwise just write directly to the file. */
   if (level > 0) {
-    return BLI_file_zstd_from_mem_at_pos(
-        data, header_entry->size_raw, file, header_entry->offset, level);
+    if (disk_cache->compress_ctx == NULL) {
+      disk_cache->compress_ctx = BLI_file_zstd_compress_context_create();
+    }
+    return BLI_file_zstd_from_mem_at_pos_ex(disk_cache->compress_ctx,
+                                            data,
+                                            header_entry->size_raw,
+                                            file,
+                                            header_entry->offset,
+                                            level);
   }
 
   fseek(file, header_entry->offset, SEEK_SET);
@@ -577,7 +587,7 @@ bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf
   int entry_index = seq_disk_cache_add_header_entry(key, ibuf, &header);
 
   size_t bytes_written = deflate_imbuf_to_file(
-      ibuf, file, seq_disk_cache_compression_level(), &header.entry[entry_index]);
+      disk_cache, ibuf, file, seq_disk_cache_compression_level(), &header.entry[entry_index]);
 
   if (bytes_written != 0) {
     /* Last step is writing header, as image data can be overwritten,
@@ -679,6 +689,9 @@ SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
 void seq_disk_cache_free(SeqDiskCache *disk_cache)
 {
   BLI_freelistN(&disk_cache->files);
+  if (disk_cache->compress_ctx != NULL) {
+    BLI_file_zstd_compress_context_free(disk_cache->compress_ctx);
+  }
   BLI_mutex_end(&disk_cache->read_write_mutex);
   MEM_freeN(disk_cache);
 }
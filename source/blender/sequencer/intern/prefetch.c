@@ -18,6 +18,7 @@
 #include "DNA_windowmanager_types.h"
 
 #include "BLI_listbase.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "IMB_imbuf.h"
@@ -465,7 +466,7 @@ static void seq_prefetch_do_suspend(PrefetchJob *pfjob)
   BLI_mutex_unlock(&pfjob->prefetch_suspend_mutex);
 }
 
-static void *seq_prefetch_frames(void *job)
+static void seq_prefetch_frames_run(void *job)
 {
   PrefetchJob *pfjob = (PrefetchJob *)job;
 
@@ -517,7 +518,12 @@ static void *seq_prefetch_frames(void *job)
   seq_cache_free_temp_cache(pfjob->scene, pfjob->context.task_id, seq_prefetch_cfra(pfjob));
   pfjob->running = false;
   pfjob->scene_eval->ed->prefetch_job = NULL;
+}
 
+static void *seq_prefetch_frames(void *job)
+{
+  /* Render with low priority, so that threads prefer interactive evaluation and drawing. */
+  BLI_task_run_with_priority(TASK_PRIORITY_LOW, seq_prefetch_frames_run, job);
   return NULL;
 }
 
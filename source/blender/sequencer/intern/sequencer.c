@@ -722,6 +722,7 @@ static bool seq_read_data_cb(Sequence *seq, void *user_data)
 
   /* Do as early as possible, so that other parts of reading can rely on valid session UUID. */
   SEQ_relations_session_uuid_generate(seq);
+  seq->runtime.sound_entry = NULL;
 
   BLO_read_data_address(reader, &seq->seq1);
   BLO_read_data_address(reader, &seq->seq2);
@@ -889,10 +890,41 @@ static bool seq_disable_sound_strips_cb(Sequence *seq, void *user_data)
   return true;
 }
 
+/**
+ * Send volume, pitch and pan of the strip to its sound entry. Animated values are written for the
+ * current frame every time, static ones only when they differ from the values sent last.
+ */
+static void seq_update_sound_properties(Sequence *seq)
+{
+  SequenceRuntime *runtime = &seq->runtime;
+  const bool volume_animated = (seq->flag & SEQ_AUDIO_VOLUME_ANIMATED) != 0;
+  const bool pitch_animated = (seq->flag & SEQ_AUDIO_PITCH_ANIMATED) != 0;
+  const bool pan_animated = (seq->flag & SEQ_AUDIO_PAN_ANIMATED) != 0;
+  const bool is_static = !(volume_animated || pitch_animated || pan_animated);
+
+  if (is_static && runtime->sound_entry == seq->scene_sound &&
+      runtime->sound_volume == seq->volume && runtime->sound_pitch == seq->pitch &&
+      runtime->sound_pan == seq->pan) {
+    return;
+  }
+
+  BKE_sound_set_scene_sound_volume(seq->scene_sound, seq->volume, volume_animated);
+  BKE_sound_set_scene_sound_pitch(seq->scene_sound, seq->pitch, pitch_animated);
+  BKE_sound_set_scene_sound_pan(seq->scene_sound, seq->pan, pan_animated);
+
+  runtime->sound_entry = is_static ? seq->scene_sound : NULL;
+  runtime->sound_volume = seq->volume;
+  runtime->sound_pitch = seq->pitch;
+  runtime->sound_pan = seq->pan;
+}
+
 static bool seq_update_seq_cb(Sequence *seq, void *user_data)
 {
   Scene *scene = (Scene *)user_data;
   if (seq->scene_sound == NULL) {
+    /* A new entry may reuse the address of a freed one. */
+    seq->runtime.sound_entry = NULL;
+
     if (seq->sound != NULL) {
       seq->scene_sound = BKE_sound_add_scene_sound_defaults(scene, seq);
     }
@@ -920,12 +952,7 @@ static bool seq_update_seq_cb(Sequence *seq, void *user_data)
         BKE_sound_update_scene_sound(seq->scene_sound, seq->sound);
       }
     }
-    BKE_sound_set_scene_sound_volume(
-        seq->scene_sound, seq->volume, (seq->flag & SEQ_AUDIO_VOLUME_ANIMATED) != 0);
-    BKE_sound_set_scene_sound_pitch(
-        seq->scene_sound, seq->pitch, (seq->flag & SEQ_AUDIO_PITCH_ANIMATED) != 0);
-    BKE_sound_set_scene_sound_pan(
-        seq->scene_sound, seq->pan, (seq->flag & SEQ_AUDIO_PAN_ANIMATED) != 0);
+    seq_update_sound_properties(seq);
   }
   return true;
 }
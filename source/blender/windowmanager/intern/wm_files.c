@@ -1828,6 +1828,8 @@ static bool wm_file_write(bContext *C,
                          .use_save_versions = true,
                          .use_save_as_copy = use_save_as_copy,
                          .thumb = thumb,
+                         .compress_threads = U.file_compress_threads,
+                         .compress_frame_size = U.file_compress_frame_size * 1024 * 1024,
                      },
                      reports)) {
     const bool do_history_file_update = (G.background == false) &&
@@ -1918,6 +1920,78 @@ static void wm_autosave_location(char *filepath)
   BLI_join_dirfile(filepath, FILE_MAX, BKE_tempdir_base(), path);
 }
 
+/** Custom-data of the #WM_JOB_TYPE_AUTOSAVE job. */
+typedef struct AutosaveJob {
+  char filepath[FILE_MAX];
+  /** Private copy of the undo memory, the undo stack may change while the job runs. */
+  MemFile memfile;
+} AutosaveJob;
+
+static void wm_autosave_job_startjob(void *customdata,
+                                     short *UNUSED(stop),
+                                     short *do_update,
+                                     float *progress)
+{
+  AutosaveJob *autosave_job = customdata;
+
+  /* Write to a temporary file first, so an interrupted write never replaces a valid autosave. */
+  char filepath_tmp[FILE_MAX + 1];
+  BLI_snprintf(filepath_tmp, sizeof(filepath_tmp), "%s@", autosave_job->filepath);
+  if (BLO_memfile_write_file(&autosave_job->memfile, filepath_tmp)) {
+    if (BLI_rename(filepath_tmp, autosave_job->filepath) != 0) {
+      CLOG_WARN(&LOG, "unable to move autosave file into place '%s'", autosave_job->filepath);
+    }
+  }
+
+  *progress = 1.0f;
+  *do_update = true;
+}
+
+static void wm_autosave_job_free(void *customdata)
+{
+  AutosaveJob *autosave_job = customdata;
+  BLO_memfile_free(&autosave_job->memfile);
+  MEM_freeN(autosave_job);
+}
+
+/**
+ * Writing from a job needs a copy of the undo memory, which temporarily doubles its memory usage.
+ * Undo memory larger than this fraction of the system memory is written directly instead,
+ * blocking the UI for the whole write.
+ */
+#define AUTOSAVE_JOB_MEMFILE_MAX_FRACTION 8
+
+static bool wm_autosave_use_job(const MemFile *memfile)
+{
+  /* #MemFile.size only counts memory owned by this undo step, the copy includes shared chunks. */
+  size_t size = 0;
+  LISTBASE_FOREACH (const MemFileChunk *, chunk, &memfile->chunks) {
+    size += chunk->size;
+  }
+  const size_t memory_max = BLI_system_memory_max_in_megabytes() * 1024 * 1024;
+  return size <= memory_max / AUTOSAVE_JOB_MEMFILE_MAX_FRACTION;
+}
+
+/**
+ * Write the undo memory from a job, so the UI is only blocked while copying it in memory
+ * instead of for the whole disk write (which can be slow, e.g. on network storage).
+ * The copy is a single pass over the undo memory on the main thread, see #wm_autosave_use_job
+ * for the memory it uses.
+ */
+static void wm_autosave_write_job(wmWindowManager *wm, MemFile *memfile, const char *filepath)
+{
+  AutosaveJob *autosave_job = MEM_callocN(sizeof(AutosaveJob), __func__);
+  BLI_strncpy(autosave_job->filepath, filepath, sizeof(autosave_job->filepath));
+  BLO_memfile_copy_flat(memfile, &autosave_job->memfile);
+
+  wmJob *wm_job = WM_jobs_get(
+      wm, wm->winactive, wm, "Auto Save", WM_JOB_PROGRESS, WM_JOB_TYPE_AUTOSAVE);
+  WM_jobs_customdata_set(wm_job, autosave_job, wm_autosave_job_free);
+  WM_jobs_timer(wm_job, 0.1, 0, 0);
+  WM_jobs_callbacks(wm_job, wm_autosave_job_startjob, NULL, NULL, NULL);
+  WM_jobs_start(wm, wm_job);
+}
+
 static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
 {
   char filepath[FILE_MAX];
@@ -1928,7 +2002,18 @@ static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
   const bool use_memfile = (U.uiflag & USER_GLOBALUNDO) != 0;
   MemFile *memfile = use_memfile ? ED_undosys_stack_memfile_get_active(wm->undo_stack) : NULL;
   if (memfile != NULL) {
-    BLO_memfile_write_file(memfile, filepath);
+    if (G.background) {
+      BLO_memfile_write_file(memfile, filepath);
+    }
+    else if (WM_jobs_test(wm, wm, WM_JOB_TYPE_AUTOSAVE)) {
+      /* The previous autosave is still being written, skip this one. */
+    }
+    else if (wm_autosave_use_job(memfile)) {
+      wm_autosave_write_job(wm, memfile, filepath);
+    }
+    else {
+      BLO_memfile_write_file(memfile, filepath);
+    }
   }
   else {
     if (use_memfile) {
@@ -27,6 +27,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_path_util.h"
+#include "BLI_profile.h"
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
@@ -617,6 +618,9 @@ void WM_exit_ex(bContext *C, const bool do_python)
 
   DNA_sdna_current_free();
 
+  /* All jobs and threads have stopped, so no scopes are recorded anymore. */
+  BLI_profile_trace_end();
+
   BLI_threadapi_exit();
   BLI_task_scheduler_exit();
 
@@ -1502,6 +1502,27 @@ static bool wm_window_timer(const bContext *C)
   return has_event;
 }
 
+/**
+ * \return Seconds until the first timer that is not sleeping fires, or a negative value when
+ * there are no timers.
+ */
+static double wm_window_timer_time_remaining(const wmWindowManager *wm)
+{
+  const double time = PIL_check_seconds_timer();
+  double time_remaining = -1.0;
+
+  LISTBASE_FOREACH (const wmTimer *, wt, &wm->timers) {
+    if (wt->sleep != 0) {
+      continue;
+    }
+    const double wt_remaining = max_dd(wt->ntime - time, 0.0);
+    if (time_remaining < 0.0 || wt_remaining < time_remaining) {
+      time_remaining = wt_remaining;
+    }
+  }
+  return time_remaining;
+}
+
 void wm_window_process_events(const bContext *C)
 {
   BLI_assert(BLI_thread_is_main());
@@ -1519,11 +1540,20 @@ void wm_window_process_events(const bContext *C)
 #endif
 
   /* When there is no event, sleep 5 milliseconds not to use too much CPU when idle.
+   * Don't sleep past the next timer though, otherwise timers such as the one of animation
+   * playback fire up to 5 milliseconds late, which makes the frame rate uneven.
    *
    * Skip sleeping when simulating events so tests don't idle unnecessarily as simulated
    * events are typically generated from a timer that runs in the main loop. */
   if ((has_event == false) && !(G.f & G_FLAG_EVENT_SIMULATE)) {
-    PIL_sleep_ms(5);
+    int sleep_ms = 5;
+    const double time_remaining = wm_window_timer_time_remaining(CTX_wm_manager(C));
+    if (time_remaining >= 0.0 && time_remaining < 0.005) {
+      sleep_ms = (int)(time_remaining * 1000.0);
+    }
+    if (sleep_ms > 0) {
+      PIL_sleep_ms(sleep_ms);
+    }
   }
 }
 
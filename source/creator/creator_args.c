@@ -23,6 +23,7 @@
 #  include "BLI_listbase.h"
 #  include "BLI_mempool.h"
 #  include "BLI_path_util.h"
+#  include "BLI_profile.h"
 #  include "BLI_string.h"
 #  include "BLI_string_utf8.h"
 #  include "BLI_system.h"
@@ -546,6 +547,7 @@ static int arg_handle_print_help(int UNUSED(argc), const char **UNUSED(argv), vo
   BLI_args_print_arg_doc(ba, "--log-show-backtrace");
   BLI_args_print_arg_doc(ba, "--log-show-timestamp");
   BLI_args_print_arg_doc(ba, "--log-file");
+  BLI_args_print_arg_doc(ba, "--profile-trace");
 
   printf("\n");
   printf("Debug Options:\n");
@@ -853,6 +855,22 @@ static int arg_handle_log_file_set(int argc, const char **argv, void *UNUSED(dat
   return 0;
 }
 
+static const char arg_handle_profile_trace_set_doc[] =
+    "<filepath>\n"
+    "\tRecord the time spent in annotated scopes (dependency graph evaluation, modifiers,\n"
+    "\tdrawing, file I/O...) and write it as a Chrome trace on exit,\n"
+    "\twhich can be viewed with 'chrome://tracing' or 'https://ui.perfetto.dev'.";
+static int arg_handle_profile_trace_set(int argc, const char **argv, void *UNUSED(data))
+{
+  const char *arg_id = "--profile-trace";
+  if (argc > 1) {
+    BLI_profile_trace_begin(argv[1]);
+    return 1;
+  }
+  printf("\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_log_set_doc[] =
     "<match>\n"
     "\tEnable logging categories, taking a single comma separated argument.\n"
@@ -2056,6 +2074,8 @@ void main_args_setup(bContext *C, bArgs *ba)
   BLI_args_add(ba, NULL, "--log-show-backtrace", CB(arg_handle_log_show_backtrace_set), ba);
   BLI_args_add(ba, NULL, "--log-show-timestamp", CB(arg_handle_log_show_timestamp_set), ba);
   BLI_args_add(ba, NULL, "--log-file", CB(arg_handle_log_file_set), ba);
+  /* Start recording early, so that initializing subsystems and loading files is included. */
+  BLI_args_add(ba, NULL, "--profile-trace", CB(arg_handle_profile_trace_set), NULL);
 
   /* Pass: Background Mode & Settings
    *
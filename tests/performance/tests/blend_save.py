@@ -0,0 +1,47 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import time
+
+    filepath = args['filepath']
+
+    # Save once to ensure the file exists and is cached by OS
+    bpy.ops.wm.save_as_mainfile(filepath=filepath, copy=True)
+
+    # Measure saving the second time
+    start_time = time.time()
+    bpy.ops.wm.save_as_mainfile(filepath=filepath, copy=True)
+    elapsed_time = time.time() - start_time
+
+    os.remove(filepath)
+
+    result = {'time': elapsed_time}
+    return result
+
+
+class BlendSaveTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "blend_save"
+
+    def run(self, env, device_id):
+        import tempfile
+        with tempfile.TemporaryDirectory() as tmpdir:
+            args = {'filepath': os.path.join(tmpdir, self.filepath.name)}
+            result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('*/*')
+    return [BlendSaveTest(filepath) for filepath in filepaths]
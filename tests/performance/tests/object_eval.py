@@ -0,0 +1,66 @@
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+import os
+
+
+def _run(args):
+    import bpy
+    import time
+
+    # Objects with any modifier when no types are specified.
+    modifier_types = set(args['modifier_types'])
+    objects = [ob for ob in bpy.context.scene.objects
+               if any(not modifier_types or md.type in modifier_types for md in ob.modifiers)]
+
+    if not objects:
+        return {}
+
+    depsgraph = bpy.context.evaluated_depsgraph_get()
+
+    start_time = time.time()
+    elapsed_time = 0.0
+    num_evaluations = 0
+
+    # Only evaluate the geometry of the objects again, so that the time is spent in the modifier
+    # stack rather than in other parts of the dependency graph.
+    while elapsed_time < 10.0:
+        for ob in objects:
+            ob.update_tag(refresh={'DATA'})
+        depsgraph.update()
+
+        num_evaluations += 1
+        elapsed_time = time.time() - start_time
+
+    time_per_evaluation = elapsed_time / num_evaluations
+
+    result = {'time': time_per_evaluation}
+    return result
+
+
+class ObjectEvalTest(api.Test):
+    def __init__(self, filepath, category, modifier_types):
+        self.filepath = filepath
+        self.category_name = category
+        self.modifier_types = modifier_types
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return self.category_name
+
+    def run(self, env, device_id):
+        args = {'modifier_types': self.modifier_types}
+        result, _ = env.run_in_blender(_run, args, [self.filepath])
+        return result
+
+
+def generate(env):
+    # Any modifier for the modifier stack files, only geometry nodes for the node tree files.
+    tests = []
+    for filepath in env.find_blend_files('modifiers/*'):
+        tests.append(ObjectEvalTest(filepath, "modifiers", []))
+    for filepath in env.find_blend_files('geometry_nodes/*'):
+        tests.append(ObjectEvalTest(filepath, "geometry_nodes", ['NODES']))
+    return tests